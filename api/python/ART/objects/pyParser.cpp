@@ -30,13 +30,15 @@ void create<Parser>(py::module& m) {
     static_cast<std::unique_ptr<File> (*) (const std::string&)>(&Parser::parse),
     "Parse the given filename and return an " RST_CLASS_REF(lief.ART.File) " object",
     "filename"_a,
-    py::return_value_policy::take_ownership);
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
 
   m.def("parse",
     static_cast<std::unique_ptr<File> (*) (const std::vector<uint8_t>&, const std::string&)>(&Parser::parse),
     "Parse the given raw data and return an " RST_CLASS_REF(lief.ART.File) " object",
     "raw"_a, py::arg("name") = "",
-    py::return_value_policy::take_ownership);
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
 
 
   m.def("parse",
@@ -70,6 +72,7 @@ void create<Parser>(py::module& m) {
           std::make_move_iterator(std::begin(raw_str)),
           std::make_move_iterator(std::end(raw_str))};
 
+        py::gil_scoped_release release;
         return LIEF::ART::Parser::parse(std::move(raw), name);
       },
       "io"_a,
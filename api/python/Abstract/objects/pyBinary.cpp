@@ -184,6 +184,19 @@ void create<Binary>(py::module& m) {
         "Return all **virtual addresses** that *use* the ``address`` given in parameter",
         "virtual_address"_a)
 
+    .def("xrefs",
+        &Binary::xrefs,
+        "Batched version of :meth:`~lief.Binary.xref`: the sections are scanned once for all the "
+        "``addresses``. It returns, for each address, the list of the virtual addresses that *use* it",
+        "addresses"_a)
+
+    .def("extract_strings",
+        &Binary::extract_strings,
+        "Extract the printable strings (ASCII and, if ``utf16`` is set, UTF-16LE) of at least "
+        "``min_size`` characters from the content of the sections.\n\n"
+        "It returns a list of " RST_CLASS_REF(lief.StringEntry) " sorted by section and then by offset.",
+        "min_size"_a = 4, "utf16"_a = true)
+
     .def("offset_to_virtual_address", &Binary::offset_to_virtual_address,
         "Convert an offset into a virtual address.",
         "offset"_a, "slide"_a = 0)
@@ -17,6 +17,7 @@
 
 #include "LIEF/Abstract/Parser.hpp"
 
+#include <chrono>
 #include <string>
 #include <stdexcept>
 
@@ -25,27 +26,29 @@ template<>
 void create<Parser>(py::module& m) {
 
   m.def("parse",
-      [] (py::bytes bytes, const std::string& name) {
-        std::string raw_str = bytes;
-        std::vector<uint8_t> raw = {
-          std::make_move_iterator(std::begin(raw_str)),
-          std::make_move_iterator(std::end(raw_str))
-        };
+      [] (py::buffer buffer, const std::string& name) {
+        // The memoryview holds the buffer (e.g. it prevents a bytearray from being
+        // resized) as long as the binary which may read from it is alive.
+        const contiguous_buffer_t raw = contiguous_buffer(buffer);
+        const uint8_t* data = raw.data;
+        const size_t size   = raw.size;
+
         std::unique_ptr<Binary> binary;
         std::exception_ptr ep;
         Py_BEGIN_ALLOW_THREADS
         try {
-          binary = Parser::parse(std::move(raw), name);
+          binary = Parser::parse(data, size, name);
         } catch (...) {
           ep = std::current_exception();
         }
         Py_END_ALLOW_THREADS
         if (ep) std::rethrow_exception(ep);
-        return binary;
+        return keep_alive(py::cast(std::move(binary)), raw.owner);
       },
-      "Parse the given binary and return a " RST_CLASS_REF(lief.Binary) " object",
-      "raw"_a, "name"_a = "",
-      py::return_value_policy::take_ownership);
+      "Parse the given binary from a bytes-like object (``bytes``, ``bytearray``, ``memoryview``, ``mmap``, ...) "
+      "and return a " RST_CLASS_REF(lief.Binary) " object.\n\n"
+      "ELF binaries are parsed without copying the buffer which must not be modified while the binary is alive",
+      "raw"_a, "name"_a = "");
 
   m.def("parse",
       [] (const std::string& name) {
@@ -87,50 +90,47 @@ void create<Parser>(py::module& m) {
 
   m.def("parse",
       [] (py::object byteio, const std::string& name) {
-        auto&& io = py::module::import("io");
-        auto&& RawIOBase = io.attr("RawIOBase");
-        auto&& BufferedIOBase = io.attr("BufferedIOBase");
-        auto&& TextIOBase = io.attr("TextIOBase");
-
-        py::object rawio;
-
-
-        if (py::isinstance(byteio, RawIOBase)) {
-          rawio = byteio;
-        }
-
-        else if (py::isinstance(byteio, BufferedIOBase)) {
-          rawio = byteio.attr("raw");
-        }
-
-        else if (py::isinstance(byteio, TextIOBase)) {
-          rawio = byteio.attr("buffer").attr("raw");
-        }
-
-        else {
-          throw py::type_error(py::repr(byteio).cast<std::string>().c_str());
-        }
-
-        std::string raw_str = static_cast<py::bytes>(rawio.attr("readall")());
-        std::vector<uint8_t> raw = {
-          std::make_move_iterator(std::begin(raw_str)),
-          std::make_move_iterator(std::end(raw_str))
-        };
+        py::bytes raw = read_io(byteio);
+        char* data = nullptr;
+        py::ssize_t size = 0;
+        PYBIND11_BYTES_AS_STRING_AND_SIZE(raw.ptr(), &data, &size);
 
         std::unique_ptr<Binary> binary;
         std::exception_ptr ep;
         Py_BEGIN_ALLOW_THREADS
         try {
-          binary = Parser::parse(std::move(raw), name);
+          binary = Parser::parse(reinterpret_cast<const uint8_t*>(data), size, name);
         } catch (...) {
           ep = std::current_exception();
         }
         Py_END_ALLOW_THREADS
         if (ep) std::rethrow_exception(ep);
-        return binary;
+        return keep_alive(py::cast(std::move(binary)), raw);
       },
       "io"_a,
-      "name"_a = "",
-      py::return_value_policy::take_ownership);
+      "name"_a = "");
+
+  m.def("parse_many",
+      [] (const std::vector<std::string>& paths, py::function callback, size_t threads) {
+        ParseManyOptions options;
+        options.threads = threads;
+
+        py::gil_scoped_release release;
+        parse_many(paths,
+            [&callback] (ParseResult& result) {
+              // The parsing runs without the GIL, only the callback needs it
+              py::gil_scoped_acquire acquire;
+              py::object binary = result.binary == nullptr ? py::none() : py::cast(std::move(result.binary));
+              callback(result.index, result.path, binary, result.error,
+                       std::chrono::duration<double>(result.duration).count());
+            }, options);
+      },
+      "Parse the files given in the first parameter on ``threads`` threads "
+      "(``0`` for all the hardware threads) **without holding the GIL**.\n\n"
+      "For each file, ``callback`` is called with ``(index, path, binary, error, duration)`` where "
+      "``binary`` is ``None`` if the file can't be parsed and ``duration`` is the parsing time in seconds. "
+      "The calls to ``callback`` are serialized but their order is not deterministic. "
+      "An exception raised by ``callback`` stops the parsing and is re-raised",
+      "paths"_a, "callback"_a, "threads"_a = 0);
 }
 }
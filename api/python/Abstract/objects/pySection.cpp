@@ -58,13 +58,33 @@ void create<Section>(py::module& m) {
 
     .def_property("content",
         static_cast<getter_t<std::vector<uint8_t>>>(&Section::content),
-        static_cast<setter_t<const std::vector<uint8_t>&>>(&Section::content),
-        "Section's content")
+        [] (Section& section, py::object content) {
+          section.content(to_vector(content));
+        },
+        "Section's content. The setter also accepts bytes-like objects")
+
+    .def_property_readonly("content_view",
+        [] (py::object self) {
+          const Section& section = self.cast<const Section&>();
+          std::vector<uint8_t> buffer;
+          return to_memoryview(self, section.content_view(buffer), buffer);
+        },
+        "Read-only ``memoryview`` on the section's content, without copy.\n\n"
+        ".. warning::\n\n"
+        "    The view points to LIEF's memory. It must not be used once the section "
+        "or the binary has been modified (e.g. new content, section removed, binary rebuilt). "
+        "Use :attr:`~lief.Section.content` or ``bytes(section.content_view)`` to keep a copy.")
 
     .def_property_readonly("entropy",
         &Section::entropy,
         "Section's entropy")
 
+    .def("entropy_profile",
+        &Section::entropy_profile,
+        "Entropy of the windows of ``window`` bytes that start every ``stride`` bytes "
+        "of the section's content (see: :func:`lief.entropy_profile`)",
+        "window"_a, "stride"_a)
+
     .def("search",
         static_cast<size_t (Section::*)(uint64_t, size_t, size_t) const>(&Section::search),
         "Look for **integer** within the current section",
@@ -85,6 +105,12 @@ void create<Section>(py::module& m) {
         "Look for all **strings** within the current section",
         "str"_a)
 
+    .def("search_patterns",
+        &Section::search_patterns,
+        "Look for all the occurrences of the given list of **bytes** patterns in a single pass "
+        "over the content. It returns, for each pattern, the list of the offsets found",
+        "patterns"_a)
+
     .def("__str__",
         [] (const Section& section)
         {
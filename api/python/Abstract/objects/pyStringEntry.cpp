@@ -0,0 +1,62 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <sstream>
+#include "pyAbstract.hpp"
+
+#include "LIEF/Abstract/StringEntry.hpp"
+
+namespace LIEF {
+
+template<>
+void create<StringEntry>(py::module& m) {
+  py::class_<StringEntry> entry(m, "StringEntry",
+      "Location of a string found by :meth:`lief.Binary.extract_strings` or :func:`lief.extract_strings`");
+
+  py::enum_<StringEntry::ENCODING>(entry, "ENCODING")
+    .value("ASCII",    StringEntry::ENCODING::ASCII)
+    .value("UTF16_LE", StringEntry::ENCODING::UTF16_LE);
+
+  entry
+    .def_readonly("offset",
+        &StringEntry::offset,
+        "Offset of the string in the file (or in the buffer given to :func:`lief.extract_strings`)")
+
+    .def_readonly("virtual_address",
+        &StringEntry::virtual_address,
+        "Virtual address of the string (0 if it is not mapped)")
+
+    .def_readonly("encoding",
+        &StringEntry::encoding,
+        "Encoding (" RST_CLASS_REF(lief.StringEntry.ENCODING) ") of the string")
+
+    .def_readonly("length",
+        &StringEntry::length,
+        "Number of characters")
+
+    .def_property_readonly("size",
+        &StringEntry::size,
+        "Number of bytes used by the string")
+
+    .def("__str__",
+        [] (const StringEntry& entry)
+        {
+          std::ostringstream stream;
+          stream << entry;
+          std::string str =  stream.str();
+          return str;
+        });
+}
+}
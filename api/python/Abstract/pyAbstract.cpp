@@ -23,6 +23,7 @@ void init_python_module(py::module& m) {
 }
 
 void init_objects(py::module& m) {
+  CREATE(StringEntry, m);
   CREATE(Header, m);
   CREATE(Binary, m);
   CREATE(Section, m);
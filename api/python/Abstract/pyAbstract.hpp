@@ -39,5 +39,6 @@ SPECIALIZE_CREATE(Symbol);
 SPECIALIZE_CREATE(Parser);
 SPECIALIZE_CREATE(Relocation);
 SPECIALIZE_CREATE(Function);
+SPECIALIZE_CREATE(StringEntry);
 }
 #endif
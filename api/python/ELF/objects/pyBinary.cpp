@@ -400,9 +400,10 @@ void create<Binary>(py::module& m) {
 
     .def("write",
         &Binary::write,
-        "Rebuild the binary and write it in a file",
+        "Rebuild the binary and write it in a file" RST_GIL_RELEASED,
         "output"_a,
-        py::return_value_policy::reference_internal)
+        py::return_value_policy::reference_internal,
+        py::call_guard<py::gil_scoped_release>())
 
     .def_property_readonly("last_offset_section",
         &Binary::last_offset_section,
@@ -448,6 +449,24 @@ void create<Binary>(py::module& m) {
         "symbol_name"_a,
         py::return_value_policy::reference)
 
+    .def("lookup_dynamic_symbol",
+        static_cast<const Symbol* (Binary::*)(const std::string&) const>(&Binary::lookup_dynamic_symbol),
+        "Resolve the dynamic symbol with the given name through the ``DT_GNU_HASH`` or the ``DT_HASH`` "
+        "table, as the loader does. Like ``ld.so``, only the symbols defined by the binary are found "
+        "(never the imports).\n\n"
+        "It falls back on a name index, restricted to the same symbols, if the binary doesn't have "
+        "a hash table or if the dynamic symbols have been modified.\n\n"
+        "Return None if the symbol can't be found",
+        "symbol_name"_a,
+        py::return_value_policy::reference)
+
+    .def("lookup_dynamic_symbols",
+        &Binary::lookup_dynamic_symbols,
+        "Batched version of :meth:`~lief.ELF.Binary.lookup_dynamic_symbol`. The returned list is "
+        "aligned with ``names`` and contains None for the names that can't be resolved",
+        "names"_a,
+        py::return_value_policy::reference)
+
     .def("has_static_symbol",
         &Binary::has_static_symbol,
         "Check if the symbol with the given ``name`` exists in the **static** symbol table",
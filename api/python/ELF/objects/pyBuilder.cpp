@@ -31,17 +31,51 @@ void create<Builder>(py::module& m) {
 
     .def("build",
         static_cast<void (Builder::*)(void)>(&Builder::build),
-        "Perform the build process")
+        "Perform the build process" RST_GIL_RELEASED,
+        py::call_guard<py::gil_scoped_release>())
 
     .def("empties_gnuhash",
         &Builder::empties_gnuhash,
         "Disable the " RST_CLASS_REF(lief.ELF.GnuHash) "",
         py::return_value_policy::reference)
 
+    .def("threads",
+        &Builder::threads,
+        "Number of threads used to serialize the static symbols, the notes and "
+        "the object relocations (``0`` for all the hardware threads)",
+        "nb_threads"_a,
+        py::return_value_policy::reference)
+
+    .def("in_place",
+        &Builder::in_place,
+        "Build the modifications **in place** when they fit in the original file. "
+        "In this mode, :meth:`~lief.ELF.Builder.build` computes a list of patches "
+        "instead of a new image and falls back on a full rebuild if the layout has to change",
+        "flag"_a = true,
+        py::return_value_policy::reference)
+
+    .def_property_readonly("is_in_place",
+        &Builder::is_in_place,
+        "True if the last build has been done in place")
+
+    .def_property_readonly("patches",
+        &Builder::patches,
+        "Patches computed by the last in-place build as a ``list`` of ``(offset, bytes)``")
+
+    .def("apply_in_place",
+        &Builder::apply_in_place,
+        "Write the build result into the **original** file ``path``. "
+        "Only the patches are written if the build has been done in place, otherwise "
+        "the file is entirely rewritten (without truncating it if the binary maps it).\n\n"
+        "Return ``False`` if the file can't be written" RST_GIL_RELEASED,
+        "path"_a,
+        py::call_guard<py::gil_scoped_release>())
+
     .def("write",
-        &Builder::write,
-        "Write the build result into the ``output`` file",
-        "output"_a)
+        static_cast<void (Builder::*)(const std::string&) const>(&Builder::write),
+        "Write the build result into the ``output`` file" RST_GIL_RELEASED,
+        "output"_a,
+        py::call_guard<py::gil_scoped_release>())
 
     .def("get_build",
         &Builder::get_build,
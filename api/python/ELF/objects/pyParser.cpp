@@ -32,7 +32,24 @@ void create<Parser>(py::module& m) {
     "For *weird* binaries (e.g sectionless) you can choose the method to use to count dynamic symbols "
     " (" RST_CLASS_REF(lief.ELF.DYNSYM_COUNT_METHODS) ")",
     "filename"_a, py::arg("dynsym_count_method") = DYNSYM_COUNT_METHODS::COUNT_AUTO,
-    py::return_value_policy::take_ownership);
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
+
+  m.def("parse",
+      [] (py::buffer buffer, const std::string& name, const ParserConfig& config) {
+        // The memoryview holds the buffer as long as the binary (which reads from it) is alive
+        const contiguous_buffer_t raw = contiguous_buffer(buffer);
+        std::unique_ptr<Binary> binary;
+        {
+          py::gil_scoped_release release;
+          binary = Parser::parse(raw.data, raw.size, name, config);
+        }
+        return keep_alive(py::cast(std::move(binary)), raw.owner);
+      },
+    "Parse the given bytes-like object (``bytes``, ``bytearray``, ``memoryview``, ``mmap``, ...) **without copying it** "
+    "and return a " RST_CLASS_REF(lief.ELF.Binary) " object\n\n"
+    "The buffer must not be modified while the binary is alive",
+    "raw"_a, py::arg("name") = "", py::arg("config") = ParserConfig::all());
 
   m.def("parse",
     static_cast<std::unique_ptr<Binary> (*) (const std::vector<uint8_t>&, const std::string&, DYNSYM_COUNT_METHODS)>(&Parser::parse),
@@ -40,45 +57,44 @@ void create<Parser>(py::module& m) {
     "For *weird* binaries (e.g sectionless) you can choose the method to use to count dynamic symbols "
     " (" RST_CLASS_REF(lief.ELF.DYNSYM_COUNT_METHODS) ")",
     "raw"_a, py::arg("name") = "", py::arg("dynsym_count_method") = DYNSYM_COUNT_METHODS::COUNT_AUTO,
-    py::return_value_policy::take_ownership);
-
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
 
   m.def("parse",
-      [] (py::object byteio, const std::string& name) {
-        auto&& io = py::module::import("io");
-        auto&& RawIOBase = io.attr("RawIOBase");
-        auto&& BufferedIOBase = io.attr("BufferedIOBase");
-        auto&& TextIOBase = io.attr("TextIOBase");
-
-        py::object rawio;
+    static_cast<std::unique_ptr<Binary> (*) (const std::string&, const ParserConfig&)>(&Parser::parse),
+    "Parse the given binary with the given " RST_CLASS_REF(lief.ELF.ParserConfig) " and return a "
+    RST_CLASS_REF(lief.ELF.Binary) " object\n\n"
+    "The tables that are skipped by the configuration are parsed on their first access",
+    "filename"_a, "config"_a,
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
 
+  m.def("parse",
+    static_cast<std::unique_ptr<Binary> (*) (const std::vector<uint8_t>&, const std::string&, const ParserConfig&)>(&Parser::parse),
+    "Parse the given binary with the given " RST_CLASS_REF(lief.ELF.ParserConfig) " and return a "
+    RST_CLASS_REF(lief.ELF.Binary) " object\n\n"
+    "The tables that are skipped by the configuration are parsed on their first access",
+    "raw"_a, "name"_a, "config"_a,
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
 
-        if (py::isinstance(byteio, RawIOBase)) {
-          rawio = byteio;
-        }
-
-        else if (py::isinstance(byteio, BufferedIOBase)) {
-          rawio = byteio.attr("raw");
-        }
-
-        else if (py::isinstance(byteio, TextIOBase)) {
-          rawio = byteio.attr("buffer").attr("raw");
-        }
 
-        else {
-          throw py::type_error(py::repr(byteio).cast<std::string>().c_str());
+  m.def("parse",
+      [] (py::object byteio, const std::string& name) {
+        py::bytes raw = read_io(byteio);
+        char* data = nullptr;
+        py::ssize_t size = 0;
+        PYBIND11_BYTES_AS_STRING_AND_SIZE(raw.ptr(), &data, &size);
+
+        std::unique_ptr<Binary> binary;
+        {
+          py::gil_scoped_release release;
+          binary = LIEF::ELF::Parser::parse(reinterpret_cast<const uint8_t*>(data), size, name);
         }
-
-        std::string raw_str = static_cast<py::bytes>(rawio.attr("readall")());
-        std::vector<uint8_t> raw = {
-          std::make_move_iterator(std::begin(raw_str)),
-          std::make_move_iterator(std::end(raw_str))};
-
-        return LIEF::ELF::Parser::parse(std::move(raw), name);
+        return keep_alive(py::cast(std::move(binary)), raw);
       },
       "io"_a,
-      "name"_a = "",
-      py::return_value_policy::take_ownership);
+      "name"_a = "");
 }
 }
 }
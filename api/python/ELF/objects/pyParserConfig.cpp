@@ -0,0 +1,50 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string>
+
+#include "LIEF/ELF/ParserConfig.hpp"
+
+#include "pyELF.hpp"
+
+namespace LIEF {
+namespace ELF {
+
+template<>
+void create<ParserConfig>(py::module& m) {
+
+  py::class_<ParserConfig>(m, "ParserConfig",
+      "Configuration of the ELF parser. The tables that are not parsed "
+      "are parsed on their first access")
+    .def(py::init<>())
+    .def_readwrite("parse_static_symbols",  &ParserConfig::parse_static_symbols)
+    .def_readwrite("parse_relocations",     &ParserConfig::parse_relocations)
+    .def_readwrite("parse_symbol_versions", &ParserConfig::parse_symbol_versions)
+    .def_readwrite("parse_notes",           &ParserConfig::parse_notes)
+    .def_readwrite("count_mtd",             &ParserConfig::count_mtd,
+        "Method used to count the dynamic symbols (" RST_CLASS_REF(lief.ELF.DYNSYM_COUNT_METHODS) ")")
+
+    .def_property_readonly_static("all",
+      [] (py::object /* self */) { return ParserConfig::all(); },
+      "Configuration which parses all the ELF structures")
+
+    .def_property_readonly_static("quick",
+      [] (py::object /* self */) { return ParserConfig::quick(); },
+      "Configuration which only parses the header, the sections, the segments, "
+      "the dynamic entries and the dynamic symbols");
+}
+
+}
+}
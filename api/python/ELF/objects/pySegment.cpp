@@ -91,8 +91,31 @@ void create<Segment>(py::module& m) {
 
     .def_property("content",
         static_cast<getter_t<std::vector<uint8_t>>>(&Segment::content),
-        static_cast<setter_t<const std::vector<uint8_t>&>>(&Segment::content),
-        "Segment's raw data")
+        [] (Segment& segment, py::object content) {
+          segment.content(to_vector(content));
+        },
+        "Segment's raw data. The setter also accepts bytes-like objects")
+
+    .def_property_readonly("content_view",
+        [] (py::object self) {
+          const Segment& segment = self.cast<const Segment&>();
+          std::vector<uint8_t> buffer;
+          return to_memoryview(self, segment.content_view(buffer), buffer);
+        },
+        "Read-only ``memoryview`` on the segment's raw data, without copy.\n\n"
+        ".. warning::\n\n"
+        "    The view points to LIEF's memory. It must not be used once the segment "
+        "or the binary has been modified. Use :attr:`~lief.ELF.Segment.content` to get a copy.")
+
+    .def_property_readonly("entropy",
+        &Segment::entropy,
+        "Segment's entropy")
+
+    .def("entropy_profile",
+        &Segment::entropy_profile,
+        "Entropy of the windows of ``window`` bytes that start every ``stride`` bytes "
+        "of the segment's content (see: :func:`lief.entropy_profile`)",
+        "window"_a, "stride"_a)
 
     .def("add",
         &Segment::add,
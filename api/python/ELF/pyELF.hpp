@@ -32,6 +32,7 @@ namespace LIEF {
 namespace ELF {
 
 class Parser;
+struct ParserConfig;
 class Binary;
 class Header;
 class Section;
@@ -75,6 +76,7 @@ void init_ELF32_sizes(py::module&);
 void init_ELF64_sizes(py::module&);
 
 SPECIALIZE_CREATE(Parser);
+SPECIALIZE_CREATE(ParserConfig);
 SPECIALIZE_CREATE(Binary);
 SPECIALIZE_CREATE(Header);
 SPECIALIZE_CREATE(Section);
@@ -377,9 +377,10 @@ void create<Binary>(py::module& m) {
 
     .def("write",
         &Binary::write,
-        "Rebuild the binary and write it in a file",
+        "Rebuild the binary and write it in a file" RST_GIL_RELEASED,
         "output"_a,
-        py::return_value_policy::reference_internal)
+        py::return_value_policy::reference_internal,
+        py::call_guard<py::gil_scoped_release>())
 
     .def("add",
         static_cast<LoadCommand& (Binary::*)(const DylibCommand&)>(&Binary::add),
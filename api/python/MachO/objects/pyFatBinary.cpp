@@ -48,12 +48,14 @@ void create<FatBinary>(py::module& m) {
 
     .def("write",
         &FatBinary::write,
-        "Build a Mach-O universal binary",
-        "filename"_a)
+        "Build a Mach-O universal binary" RST_GIL_RELEASED,
+        "filename"_a,
+        py::call_guard<py::gil_scoped_release>())
 
     .def("raw",
         &FatBinary::raw,
-        "Build a Mach-O universal binary and return its bytes")
+        "Build a Mach-O universal binary and return its bytes" RST_GIL_RELEASED,
+        py::call_guard<py::gil_scoped_release>())
 
     .def("__len__",
         &FatBinary::size)
@@ -34,8 +34,24 @@ void create<Parser>(py::module& m) {
     "One can configure the parsing with the ``config`` parameter. See " RST_CLASS_REF(lief.MachO.ParserConfig) "",
     "filename"_a,
     "config"_a = ParserConfig::deep(),
-    py::return_value_policy::take_ownership);
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
+
+
+  m.def("parse",
+      [] (py::buffer buffer, const std::string& name, const ParserConfig& config) {
+        const std::vector<uint8_t> raw = to_vector(buffer);
+        py::gil_scoped_release release;
+        return LIEF::MachO::Parser::parse(raw, name, config);
+      },
+    "Parse the given bytes-like object (``bytes``, ``bytearray``, ``memoryview``, ``mmap``, ...) "
+    "and return a " RST_CLASS_REF(lief.MachO.FatBinary) " object\n\n"
 
+    "One can configure the parsing with the ``config`` parameter. See " RST_CLASS_REF(lief.MachO.ParserConfig) "",
+    "raw"_a,
+    "name"_a = "",
+    "config"_a = ParserConfig::quick(),
+    py::return_value_policy::take_ownership);
 
   m.def("parse",
     static_cast<std::unique_ptr<FatBinary> (*) (const std::vector<uint8_t>&, const std::string&, const ParserConfig&)>(&LIEF::MachO::Parser::parse),
@@ -45,41 +61,15 @@ void create<Parser>(py::module& m) {
     "raw"_a,
     "name"_a = "",
     "config"_a = ParserConfig::quick(),
-    py::return_value_policy::take_ownership);
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
 
 
     m.def("parse",
       [] (py::object byteio, std::string name, const ParserConfig& config) {
-        auto&& io = py::module::import("io");
-        auto&& RawIOBase = io.attr("RawIOBase");
-        auto&& BufferedIOBase = io.attr("BufferedIOBase");
-        auto&& TextIOBase = io.attr("TextIOBase");
-
-        py::object rawio;
-
-
-        if (py::isinstance(byteio, RawIOBase)) {
-          rawio = byteio;
-        }
-
-        else if (py::isinstance(byteio, BufferedIOBase)) {
-          rawio = byteio.attr("raw");
-        }
-
-        else if (py::isinstance(byteio, TextIOBase)) {
-          rawio = byteio.attr("buffer").attr("raw");
-        }
-
-        else {
-          throw py::type_error(py::repr(byteio).cast<std::string>().c_str());
-        }
-
-        std::string raw_str = static_cast<py::bytes>(rawio.attr("readall")());
-        std::vector<uint8_t> raw = {
-          std::make_move_iterator(std::begin(raw_str)),
-          std::make_move_iterator(std::end(raw_str))};
-
-        return LIEF::MachO::Parser::parse(std::move(raw), name, config);
+        const std::vector<uint8_t> raw = to_vector(read_io(byteio));
+        py::gil_scoped_release release;
+        return LIEF::MachO::Parser::parse(raw, name, config);
       },
       "io"_a,
       "name"_a = "",
@@ -30,6 +30,8 @@ void create<ParserConfig>(py::module& m) {
     .def_readwrite("parse_dyld_exports",  &ParserConfig::parse_dyld_exports)
     .def_readwrite("parse_dyld_bindings", &ParserConfig::parse_dyld_bindings)
     .def_readwrite("parse_dyld_rebases",  &ParserConfig::parse_dyld_rebases)
+    .def_readwrite("parallel_fat",        &ParserConfig::parallel_fat,
+        "Parse the architectures of a FAT binary concurrently")
 
     .def("full_dyldinfo",  &ParserConfig::full_dyldinfo)
 
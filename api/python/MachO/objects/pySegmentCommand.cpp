@@ -107,10 +107,33 @@ void create<SegmentCommand>(py::module& m) {
 
     .def_property("content",
         static_cast<getter_t<const SegmentCommand::content_t&>>(&SegmentCommand::content),
-        static_cast<setter_t<const SegmentCommand::content_t&>>(&SegmentCommand::content),
-        "Segment's content"
+        [] (SegmentCommand& segment, py::object content) {
+          segment.content(to_vector(content));
+        },
+        "Segment's content. The setter also accepts bytes-like objects"
+        )
+
+    .def_property_readonly("content_view",
+        [] (py::object self) {
+          const SegmentCommand::content_t& content = self.cast<const SegmentCommand&>().content();
+          return to_memoryview(self, {content.data(), content.size()}, {});
+        },
+        "Read-only ``memoryview`` on the segment's content, without copy.\n\n"
+        ".. warning::\n\n"
+        "    The view points to LIEF's memory. It must not be used once the segment "
+        "or the binary has been modified. Use :attr:`~lief.MachO.SegmentCommand.content` to get a copy."
         )
 
+    .def_property_readonly("entropy",
+        &SegmentCommand::entropy,
+        "Segment's entropy")
+
+    .def("entropy_profile",
+        &SegmentCommand::entropy_profile,
+        "Entropy of the windows of ``window`` bytes that start every ``stride`` bytes "
+        "of the segment's content (see: :func:`lief.entropy_profile`)",
+        "window"_a, "stride"_a)
+
 
     .def_property("flags",
         static_cast<getter_t<uint32_t>>(&SegmentCommand::flags),
@@ -30,19 +30,22 @@ void create<Parser>(py::module& m) {
     static_cast<std::unique_ptr<Binary> (*) (const std::string&)>(&Parser::parse),
     "Parse the given OAT file and return a " RST_CLASS_REF(lief.OAT.Binary) " object",
     "oat_file"_a,
-    py::return_value_policy::take_ownership);
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
 
   m.def("parse",
     static_cast<std::unique_ptr<Binary> (*) (const std::string&, const std::string&)>(&Parser::parse),
     "Parse the given OAT with its VDEX file and return a " RST_CLASS_REF(lief.OAT.Binary) " object",
     "oat_file"_a, "vdex_file"_a,
-    py::return_value_policy::take_ownership);
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
 
   m.def("parse",
     static_cast<std::unique_ptr<Binary> (*) (const std::vector<uint8_t>&, const std::string&)>(&Parser::parse),
     "Parse the given raw data and return a " RST_CLASS_REF(lief.OAT.Binary) " object",
     "raw"_a, py::arg("name") = "",
-    py::return_value_policy::take_ownership);
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
 
 
   m.def("parse",
@@ -76,6 +79,7 @@ void create<Parser>(py::module& m) {
           std::make_move_iterator(std::begin(raw_str)),
           std::make_move_iterator(std::end(raw_str))};
 
+        py::gil_scoped_release release;
         return LIEF::OAT::Parser::parse(std::move(raw), name);
       },
       "io"_a,
@@ -16,6 +16,7 @@
 #include "LIEF/PE/Parser.hpp"
 #include "LIEF/PE/Builder.hpp"
 #include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/signature/VerificationCache.hpp"
 #include "LIEF/Abstract/Binary.hpp"
 
 #include "pyPE.hpp"
@@ -158,15 +159,42 @@ void create<Binary>(py::module& m) {
 
     .def("authentihash",
         [] (const Binary& bin, ALGORITHMS algo) {
-          const std::vector<uint8_t>& data = bin.authentihash(algo);
+          std::vector<uint8_t> data;
+          {
+            py::gil_scoped_release release;
+            data = bin.authentihash(algo);
+          }
           return py::bytes(reinterpret_cast<const char*>(data.data()), data.size());
         },
         "Compute the authentihash according to the " RST_CLASS_REF(lief.PE.ALGORITHMS) " "
-        "given in the first parameter",
+        "given in the first parameter" RST_GIL_RELEASED,
         "algorithm"_a)
 
+    .def("authentihash",
+        [] (const Binary& bin, const std::vector<ALGORITHMS>& algos) {
+          std::vector<std::vector<uint8_t>> hashes;
+          {
+            py::gil_scoped_release release;
+            hashes = bin.authentihash(algos);
+          }
+          py::list result;
+          for (const std::vector<uint8_t>& data : hashes) {
+            result.append(py::bytes(reinterpret_cast<const char*>(data.data()), data.size()));
+          }
+          return result;
+        },
+        "Compute the authentihashes for the list of " RST_CLASS_REF(lief.PE.ALGORITHMS) " "
+        "given in the first parameter in a single pass over the binary. "
+        "The digests are returned as a ``list`` of ``bytes`` in the same order" RST_GIL_RELEASED,
+        "algorithms"_a)
+
     .def("verify_signature",
-        static_cast<Signature::VERIFICATION_FLAGS(Binary::*)(Signature::VERIFICATION_CHECKS) const>(&Binary::verify_signature),
+        [] (const Binary& bin, Signature::VERIFICATION_CHECKS checks, VerificationCache* cache) {
+          if (cache == nullptr) {
+            return bin.verify_signature(checks);
+          }
+          return bin.verify_signature(checks, *cache);
+        },
         R"delim(
         Verify the binary against the embedded signature(s) (if any)
         Firstly, it checks that the embedded signatures are correct (c.f. :meth:`lief.PE.Signature.check`)
@@ -174,14 +202,28 @@ void create<Binary>(py::module& m) {
 
         One can tweak the verification process with the :class:`lief.PE.Signature.VERIFICATION_CHECKS` flags
 
+        A :class:`lief.PE.VerificationCache` can be provided to share the public keys of the
+        signers across the signatures and the binaries
+
         .. seealso::
 
             :meth:`lief.PE.Signature.check`
+
+        .. warning::
+
+            The GIL is released while this function runs: the binary must not be modified
+            (or deleted) by another thread until it returns.
         )delim",
-        "checks"_a = Signature::VERIFICATION_CHECKS::DEFAULT)
+        "checks"_a = Signature::VERIFICATION_CHECKS::DEFAULT, "cache"_a = nullptr,
+        py::call_guard<py::gil_scoped_release>())
 
     .def("verify_signature",
-        static_cast<Signature::VERIFICATION_FLAGS(Binary::*)(const Signature&, Signature::VERIFICATION_CHECKS) const>(&Binary::verify_signature),
+        [] (const Binary& bin, const Signature& sig, Signature::VERIFICATION_CHECKS checks, VerificationCache* cache) {
+          if (cache == nullptr) {
+            return bin.verify_signature(sig, checks);
+          }
+          return bin.verify_signature(sig, checks, *cache);
+        },
         R"delim(
         Verify the binary with the Signature object provided in the first parameter
         It can be used to verify a detached signature:
@@ -190,33 +232,55 @@ void create<Binary>(py::module& m) {
 
             detached = lief.PE.Signature.parse("sig.pkcs7")
             binary.verify_signature(detached)
+
+        .. warning::
+
+            The GIL is released while this function runs: the binary must not be modified
+            (or deleted) by another thread until it returns.
         )delim",
-        "signature"_a, "checks"_a = Signature::VERIFICATION_CHECKS::DEFAULT)
+        "signature"_a, "checks"_a = Signature::VERIFICATION_CHECKS::DEFAULT, "cache"_a = nullptr,
+        py::call_guard<py::gil_scoped_release>())
 
     .def_property_readonly("authentihash_md5",
         [] (const Binary& bin) {
-          const std::vector<uint8_t>& data = bin.authentihash(ALGORITHMS::MD5);
+          std::vector<uint8_t> data;
+          {
+            py::gil_scoped_release release;
+            data = bin.authentihash(ALGORITHMS::MD5);
+          }
           return py::bytes(reinterpret_cast<const char*>(data.data()), data.size());
         },
         "Authentihash **MD5** value")
 
     .def_property_readonly("authentihash_sha1",
         [] (const Binary& bin) {
-          const std::vector<uint8_t>& data = bin.authentihash(ALGORITHMS::SHA_1);
+          std::vector<uint8_t> data;
+          {
+            py::gil_scoped_release release;
+            data = bin.authentihash(ALGORITHMS::SHA_1);
+          }
           return py::bytes(reinterpret_cast<const char*>(data.data()), data.size());
         },
         "Authentihash **SHA1** value")
 
     .def_property_readonly("authentihash_sha256",
         [] (const Binary& bin) {
-          const std::vector<uint8_t>& data = bin.authentihash(ALGORITHMS::SHA_256);
+          std::vector<uint8_t> data;
+          {
+            py::gil_scoped_release release;
+            data = bin.authentihash(ALGORITHMS::SHA_256);
+          }
           return py::bytes(reinterpret_cast<const char*>(data.data()), data.size());
         },
         "Authentihash **SHA-256** value")
 
     .def_property_readonly("authentihash_sha512",
         [] (const Binary& bin) {
-          const std::vector<uint8_t>& data = bin.authentihash(ALGORITHMS::SHA_512);
+          std::vector<uint8_t> data;
+          {
+            py::gil_scoped_release release;
+            data = bin.authentihash(ALGORITHMS::SHA_512);
+          }
           return py::bytes(reinterpret_cast<const char*>(data.data()), data.size());
         },
         "Authentihash **SHA-512** value")
@@ -358,8 +422,9 @@ void create<Binary>(py::module& m) {
 
     .def("write",
         &Binary::write,
-        "Build the binary and write the result to the given ``output``",
-        "output_path"_a)
+        "Build the binary and write the result to the given ``output``" RST_GIL_RELEASED,
+        "output_path"_a,
+        py::call_guard<py::gil_scoped_release>())
 
     .def("__str__",
         [] (const Binary& binary)
@@ -34,7 +34,8 @@ void create<Builder>(py::module& m) {
 
     .def("build",
         &Builder::build,
-        "Perform the build process")
+        "Perform the build process" RST_GIL_RELEASED,
+        py::call_guard<py::gil_scoped_release>())
 
     .def("build_imports",
         &Builder::build_imports,
@@ -81,9 +82,10 @@ void create<Builder>(py::module& m) {
         py::return_value_policy::reference)
 
     .def("write",
-        &Builder::write,
-        "Write the build result into the ``output`` file",
-        "output"_a)
+        static_cast<void (Builder::*)(const std::string&) const>(&Builder::write),
+        "Write the build result into the ``output`` file" RST_GIL_RELEASED,
+        "output"_a,
+        py::call_guard<py::gil_scoped_release>())
 
     .def("get_build",
         &Builder::get_build,
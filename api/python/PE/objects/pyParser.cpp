@@ -29,47 +29,33 @@ void create<Parser>(py::module& m) {
     static_cast<std::unique_ptr<Binary> (*) (const std::string&)>(&Parser::parse),
     "Parse the given binary and return a " RST_CLASS_REF(lief.PE.Binary) " object",
     py::arg("filename"),
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
+
+    m.def("parse",
+      [] (py::buffer buffer, const std::string& name) {
+        const std::vector<uint8_t> raw = to_vector(buffer);
+        py::gil_scoped_release release;
+        return Parser::parse(raw, name);
+      },
+    "Parse the given bytes-like object (``bytes``, ``bytearray``, ``memoryview``, ``mmap``, ...) "
+    "and return a " RST_CLASS_REF(lief.PE.Binary) " object",
+    py::arg("raw"), py::arg("name") = "",
     py::return_value_policy::take_ownership);
 
     m.def("parse",
     static_cast<std::unique_ptr<Binary> (*) (const std::vector<uint8_t>&, const std::string&)>(&Parser::parse),
     "Parse the given binary and return a " RST_CLASS_REF(lief.PE.Binary) " object",
     py::arg("raw"), py::arg("name") = "",
-    py::return_value_policy::take_ownership);
+    py::return_value_policy::take_ownership,
+    py::call_guard<py::gil_scoped_release>());
 
 
     m.def("parse",
       [] (py::object byteio, const std::string& name) {
-        auto&& io = py::module::import("io");
-        auto&& RawIOBase = io.attr("RawIOBase");
-        auto&& BufferedIOBase = io.attr("BufferedIOBase");
-        auto&& TextIOBase = io.attr("TextIOBase");
-
-        py::object rawio;
-
-
-        if (py::isinstance(byteio, RawIOBase)) {
-          rawio = byteio;
-        }
-
-        else if (py::isinstance(byteio, BufferedIOBase)) {
-          rawio = byteio.attr("raw");
-        }
-
-        else if (py::isinstance(byteio, TextIOBase)) {
-          rawio = byteio.attr("buffer").attr("raw");
-        }
-
-        else {
-          throw py::type_error(py::repr(byteio).cast<std::string>().c_str());
-        }
-
-        std::string raw_str = static_cast<py::bytes>(rawio.attr("readall")());
-        std::vector<uint8_t> raw = {
-          std::make_move_iterator(std::begin(raw_str)),
-          std::make_move_iterator(std::end(raw_str))};
-
-        return LIEF::PE::Parser::parse(std::move(raw), name);
+        const std::vector<uint8_t> raw = to_vector(read_io(byteio));
+        py::gil_scoped_release release;
+        return LIEF::PE::Parser::parse(raw, name);
       },
       "io"_a,
       "name"_a = "",
@@ -21,6 +21,7 @@
 #include "LIEF/PE/hash.hpp"
 #include "LIEF/PE/signature/Signature.hpp"
 #include "LIEF/PE/signature/SignatureParser.hpp"
+#include "LIEF/PE/signature/VerificationCache.hpp"
 
 #define LIEF_PE_FORCE_UNDEF
 #include "LIEF/PE/undef.h"
@@ -167,7 +168,12 @@ void create<Signature>(py::module& m) {
         "issuer"_a, "serialno"_a)
 
     .def("check",
-        &Signature::check,
+        [] (const Signature& sig, Signature::VERIFICATION_CHECKS checks, VerificationCache* cache) {
+          if (cache == nullptr) {
+            return sig.check(checks);
+          }
+          return sig.check(checks, *cache);
+        },
         // Note: This documentation needs to be sync with LIEF::PE::Signature::check
         R"delim(
         Check the integrity of the signature and return a :class:`lief.PE.Signature.VERIFICATION_FLAGS`
@@ -195,8 +201,11 @@ void create<Signature>(py::module& m) {
 
         See: :class:`lief.PE.Signature.VERIFICATION_CHECKS` to tweak the behavior
 
+        If a :class:`lief.PE.VerificationCache` is provided, the public keys of the signers are memoized in this cache
+
         )delim",
-        "checks"_a = Signature::VERIFICATION_CHECKS::DEFAULT
+        "checks"_a = Signature::VERIFICATION_CHECKS::DEFAULT, "cache"_a = nullptr,
+        py::call_guard<py::gil_scoped_release>()
     )
 
     .def_property_readonly("raw_der",
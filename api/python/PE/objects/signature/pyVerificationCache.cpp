@@ -0,0 +1,123 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string>
+#include <sstream>
+
+#include "LIEF/PE/signature/VerificationCache.hpp"
+
+#include "pyPE.hpp"
+
+namespace LIEF {
+namespace PE {
+
+template<>
+void create<VerificationCache>(py::module& m) {
+
+  py::class_<VerificationCache> cache(m, "VerificationCache",
+      R"delim(
+      Thread-safe cache for the x509 verifications.
+
+      The chain validations (:meth:`lief.PE.x509.is_trusted_by`, :meth:`lief.PE.x509.verify`) are keyed by
+      the fingerprints of the certificate and of the CA set. The public keys of the signers are
+      keyed by the fingerprint of their certificate: the signature checks
+      (:meth:`lief.PE.x509.check_signature`) are not cached as their hash is unique to each signed file.
+
+      The same cache can be shared by several threads and given to :meth:`lief.PE.Signature.check`
+      or :meth:`lief.PE.Binary.verify_signature`:
+
+      .. code-block:: python
+
+          cache = lief.PE.VerificationCache()
+          for path in paths:
+              pe = lief.parse(path)
+              print(pe.verify_signature(cache=cache))
+          print(cache.stats)
+
+      .. warning::
+
+          The validity period of the certificates is checked against the current time.
+          A long-running process should :meth:`~lief.PE.VerificationCache.clear` the cache periodically.
+      )delim");
+
+  py::class_<VerificationCache::stats_t>(cache, "stats_t", "Hit/miss statistics of the cache")
+    .def_readonly("hits",
+        &VerificationCache::stats_t::hits,
+        "Number of validations and signer keys served from the cache")
+
+    .def_readonly("misses",
+        &VerificationCache::stats_t::misses,
+        "Number of validations computed and signer keys parsed")
+
+    .def_readonly("evictions",
+        &VerificationCache::stats_t::evictions,
+        "Number of entries evicted to honor :attr:`~lief.PE.VerificationCache.max_entries`")
+
+    .def_readonly("entries",
+        &VerificationCache::stats_t::entries,
+        "Number of validations and signer keys currently cached")
+
+    .def("__str__",
+        [] (const VerificationCache::stats_t& stats)
+        {
+          std::ostringstream stream;
+          stream << stats;
+          return stream.str();
+        });
+
+  cache
+    .def(py::init<size_t>(),
+        "Create a cache that keeps at most ``max_entries`` chain validations and ``max_entries`` "
+        "signer keys (0 for no limit). The least recently used validations are evicted first",
+        "max_entries"_a = static_cast<size_t>(VerificationCache::DEFAULT_MAX_ENTRIES))
+
+    .def("is_trusted_by",
+        &VerificationCache::is_trusted_by,
+        "Cached version of :meth:`lief.PE.x509.is_trusted_by`",
+        "cert"_a, "ca_list"_a,
+        py::call_guard<py::gil_scoped_release>())
+
+    .def("verify",
+        &VerificationCache::verify,
+        "Cached version of :meth:`lief.PE.x509.verify`: check that ``ca`` has been used **to trust** ``child``",
+        "ca"_a, "child"_a,
+        py::call_guard<py::gil_scoped_release>())
+
+    .def("check_signature",
+        &VerificationCache::check_signature,
+        ":meth:`lief.PE.x509.check_signature` with the memoized public key of ``cert``. "
+        "The result is not cached",
+        "cert"_a, "hash"_a, "signature"_a, "digest"_a,
+        py::call_guard<py::gil_scoped_release>())
+
+    .def_property_readonly("stats",
+        &VerificationCache::stats,
+        "Current " RST_CLASS_REF(lief.PE.VerificationCache.stats_t) "")
+
+    .def_property_readonly("max_entries",
+        &VerificationCache::max_entries,
+        "Maximum number of chain validations and of signer keys kept in the cache (0 for no limit)")
+
+    .def("reset_stats",
+        &VerificationCache::reset_stats,
+        "Reset the hits/misses/evictions counters")
+
+    .def("clear",
+        &VerificationCache::clear,
+        "Drop all the cached validations and signer keys");
+}
+
+}
+}
@@ -138,6 +138,13 @@ void create<x509>(py::module& m) {
         },
         "The raw bytes associated with this x509 cert (DER encoded)")
 
+    .def_property_readonly("fingerprint",
+        [] (const x509& crt) -> py::bytes {
+          const std::vector<uint8_t>& fp = crt.fingerprint();
+          return py::bytes(reinterpret_cast<const char*>(fp.data()), fp.size());
+        },
+        "SHA-256 of the DER encoded certificate")
+
     .def_property_readonly("key_type",
         &x509::key_type,
         "Return the underlying public-key scheme (" RST_CLASS_REF(lief.PE.x509.KEY_TYPES) ")")
@@ -169,6 +176,13 @@ void create<x509>(py::module& m) {
           return py::bytes(reinterpret_cast<const char*>(sig.data()), sig.size());
         }, "The signature of the certificate")
 
+    .def("check_signature",
+        &x509::check_signature,
+        "Try to decrypt the given signature and check if it matches the given hash according to "
+        "the hash algorithm (" RST_CLASS_REF(lief.PE.ALGORITHMS) ") provided",
+        "hash"_a, "signature"_a, "digest"_a,
+        py::call_guard<py::gil_scoped_release>())
+
     .def("verify",
         static_cast<x509::VERIFICATION_FLAGS(x509::*)(const x509&) const>(&x509::verify),
         R"delim(
@@ -185,7 +199,8 @@ void create<x509>(py::module& m) {
             print(ca.verify(signer))  # lief.PE.x509.VERIFICATION_FLAGS.OK
 
         )delim",
-        "ca"_a)
+        "ca"_a,
+        py::call_guard<py::gil_scoped_release>())
 
     .def("is_trusted_by",
         &x509::is_trusted_by,
@@ -78,6 +78,7 @@ void init_objects(py::module& m) {
   CREATE(Signature, m);
   CREATE(RsaInfo, m);
   CREATE(x509, m);
+  CREATE(VerificationCache, m);
   CREATE(ContentInfo, m);
   CREATE(SignerInfo, m);
   CREATE(CodeIntegrity, m);
@@ -85,6 +85,7 @@ SPECIALIZE_CREATE(ResourceAccelerator);
 SPECIALIZE_CREATE(Signature);
 SPECIALIZE_CREATE(RsaInfo);
 SPECIALIZE_CREATE(x509);
+SPECIALIZE_CREATE(VerificationCache);
 SPECIALIZE_CREATE(SignerInfo);
 SPECIALIZE_CREATE(Attribute);
 SPECIALIZE_CREATE(ContentInfo);
@@ -0,0 +1,106 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "pyLIEF.hpp"
+
+namespace {
+//! Read-only buffer over memory owned by ``owner`` (e.g. a section).
+//! The memoryviews created on this buffer keep ``owner`` alive but they
+//! don't prevent the owner from modifying (or freeing) the memory.
+struct ContentBuffer {
+  py::object     owner;
+  const uint8_t* data;
+  size_t         size;
+};
+}
+
+void init_buffer_class(py::module& m) {
+  py::class_<ContentBuffer>(m, "_ContentBuffer", py::buffer_protocol())
+    .def_buffer([] (ContentBuffer& buffer) {
+        return py::buffer_info(
+            const_cast<uint8_t*>(buffer.data),
+            sizeof(uint8_t),
+            py::format_descriptor<uint8_t>::format(),
+            1,
+            {static_cast<py::ssize_t>(buffer.size)},
+            {static_cast<py::ssize_t>(sizeof(uint8_t))},
+            /* readonly */ true);
+      });
+}
+
+py::memoryview to_memoryview(py::handle owner, const LIEF::Section::content_view_t& content,
+                             const std::vector<uint8_t>& buffer) {
+  if (content.size == 0 or content.data == buffer.data()) {
+    // The content is not contiguous and it has been copied in ``buffer``
+    return py::memoryview(py::bytes(reinterpret_cast<const char*>(content.data), content.size));
+  }
+  return py::memoryview(py::cast(ContentBuffer{py::reinterpret_borrow<py::object>(owner), content.data, content.size}));
+}
+
+contiguous_buffer_t contiguous_buffer(py::handle obj) {
+  py::memoryview view{py::reinterpret_borrow<py::object>(obj)};
+  const Py_buffer* buffer = PyMemoryView_GET_BUFFER(view.ptr());
+  if (not PyBuffer_IsContiguous(buffer, 'C')) {
+    auto&& copy = py::reinterpret_steal<py::object>(PyObject_Bytes(obj.ptr()));
+    if (not copy) {
+      throw py::error_already_set();
+    }
+    view   = py::memoryview{copy};
+    buffer = PyMemoryView_GET_BUFFER(view.ptr());
+  }
+  return {view, static_cast<const uint8_t*>(buffer->buf), static_cast<size_t>(buffer->len)};
+}
+
+py::bytes read_io(py::object byteio) {
+  auto&& io = py::module::import("io");
+  auto&& RawIOBase = io.attr("RawIOBase");
+  auto&& BufferedIOBase = io.attr("BufferedIOBase");
+  auto&& TextIOBase = io.attr("TextIOBase");
+
+  py::object rawio;
+
+  if (py::isinstance(byteio, RawIOBase)) {
+    rawio = byteio;
+  }
+
+  else if (py::isinstance(byteio, BufferedIOBase)) {
+    rawio = byteio.attr("raw");
+  }
+
+  else if (py::isinstance(byteio, TextIOBase)) {
+    rawio = byteio.attr("buffer").attr("raw");
+  }
+
+  else {
+    throw py::type_error(py::repr(byteio).cast<std::string>().c_str());
+  }
+
+  return rawio.attr("readall")();
+}
+
+std::vector<uint8_t> to_vector(py::object obj) {
+  if (not py::isinstance<py::buffer>(obj)) {
+    return obj.cast<std::vector<uint8_t>>();
+  }
+  const contiguous_buffer_t buffer = contiguous_buffer(obj);
+  return {buffer.data, buffer.data + buffer.size};
+}
+
+py::object keep_alive(py::object nurse, py::handle patient) {
+  if (not nurse.is_none()) {
+    py::detail::keep_alive_impl(nurse, patient);
+  }
+  return nurse;
+}
@@ -63,6 +63,8 @@ PYBIND11_MODULE(lief, LIEF_module) {
 
   init_LIEF_Object_class(LIEF_module);
 
+  init_buffer_class(LIEF_module);
+
   init_LIEF_iterators(LIEF_module);
 
   init_LIEF_Logger(LIEF_module);
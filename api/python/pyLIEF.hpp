@@ -22,6 +22,7 @@
 #include <functional>
 
 #include <LIEF/config.h>
+#include <LIEF/Abstract/Section.hpp>
 
 #include "encoding.hpp"
 
@@ -36,6 +37,14 @@
 #define RST_METH_REF(X) ":class:`~"#X"`"
 #define RST_METH_REF_FULL(X) ":class:`"#X"`"
 
+//! Appended to the docstrings of the functions that release the GIL while they
+//! work on an existing object. Nothing prevents another thread from modifying
+//! this object in the meantime: it is up to the caller.
+#define RST_GIL_RELEASED "\n\n" \
+  ".. warning::\n\n" \
+  "    The GIL is released while this function runs: the binary must not be modified " \
+  "(or deleted) by another thread until it returns."
+
 namespace py = pybind11;
 
 using namespace pybind11::literals;
@@ -45,6 +54,35 @@ void init_LIEF_Logger(py::module&);
 void init_LIEF_exceptions(py::module&);
 void init_LIEF_module(py::module&);
 void init_hash_functions(py::module&);
+void init_buffer_class(py::module&);
+
+//! Read-only ``memoryview`` on ``content`` that keeps ``owner`` alive (but is
+//! invalidated if ``owner`` modifies its memory). If ``content`` points to ``buffer``
+//! (i.e. a copy of a non-contiguous content), the memoryview is created on a copy of the bytes.
+py::memoryview to_memoryview(py::handle owner, const LIEF::Section::content_view_t& content,
+                             const std::vector<uint8_t>& buffer);
+
+//! Bytes of a bytes-like object as a contiguous range.
+//!
+//! ``owner`` holds the buffer: a memoryview on the object or, if the object is not
+//! C-contiguous (e.g. ``memoryview(raw)[::2]``), on a copy of its bytes.
+//! It must be kept alive as long as ``data`` is used.
+struct contiguous_buffer_t {
+  py::object     owner;
+  const uint8_t* data;
+  size_t         size;
+};
+contiguous_buffer_t contiguous_buffer(py::handle obj);
+
+//! Read the whole content of a Python IO object (file, BytesIO, ...)
+py::bytes read_io(py::object byteio);
+
+//! Convert a bytes-like object (with a single ``memcpy``) or a list of integers
+//! into a vector of bytes
+std::vector<uint8_t> to_vector(py::object obj);
+
+//! Keep ``patient`` alive as long as ``nurse`` is alive and return ``nurse``
+py::object keep_alive(py::object nurse, py::handle patient);
 
 
 void init_utils_functions(py::module&);
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "LIEF/utils.hpp"
+#include "LIEF/Abstract/StringEntry.hpp"
 #include "LIEF/PE/utils.hpp"
 #include "LIEF/MachO/utils.hpp"
 #include "LIEF/ELF/utils.hpp"
@@ -62,6 +64,47 @@ void init_utils_functions(py::module& m) {
       },
       "Trigger 'pdb.set_trace()'");
 
+  m.def("entropy",
+      [] (py::buffer buffer) {
+        const contiguous_buffer_t raw = contiguous_buffer(buffer);
+        return LIEF::entropy(raw.data, raw.size);
+      },
+      "Shannon entropy (between 0 and 8) of the given bytes-like object "
+      "(e.g. a range of a file read with ``f.read()``)",
+      "data"_a);
+
+  m.def("entropy",
+      static_cast<double (*)(const std::vector<uint8_t>&)>(&LIEF::entropy),
+      "Shannon entropy (between 0 and 8) of the given list of bytes",
+      "data"_a);
+
+  m.def("entropy_profile",
+      [] (py::buffer buffer, size_t window, size_t stride) {
+        const contiguous_buffer_t raw = contiguous_buffer(buffer);
+        return LIEF::entropy_profile(raw.data, raw.size, window, stride);
+      },
+      "Entropy of the windows of ``window`` bytes that start every ``stride`` bytes of "
+      "the given bytes-like object. Only the complete windows are considered, unless the "
+      "data is smaller than ``window`` in which case the entropy of the whole data is returned.\n\n"
+      "It can be used to locate packed or encrypted regions in a file.",
+      "data"_a, "window"_a, "stride"_a);
+
+  m.def("entropy_profile",
+      static_cast<std::vector<double> (*)(const std::vector<uint8_t>&, size_t, size_t)>(&LIEF::entropy_profile),
+      "Entropy of the windows of ``window`` bytes that start every ``stride`` bytes of "
+      "the given list of bytes",
+      "data"_a, "window"_a, "stride"_a);
+
+  m.def("extract_strings",
+      [] (py::buffer buffer, size_t min_size, bool utf16) {
+        const contiguous_buffer_t raw = contiguous_buffer(buffer);
+        return LIEF::extract_strings(raw.data, raw.size, min_size, utf16);
+      },
+      "Look for the runs of at least ``min_size`` printable characters in the given bytes-like object "
+      "and, if ``utf16`` is set, for the same characters encoded in UTF-16LE (as ``strings -el``).\n\n"
+      "It returns a list of " RST_CLASS_REF(lief.StringEntry) " sorted by offset.",
+      "data"_a, "min_size"_a = 4, "utf16"_a = true);
+
 #if defined(LIEF_PE_SUPPORT)
     m.def("is_pe",
         static_cast<bool (*)(const std::string&)>(&LIEF::PE::is_pe),
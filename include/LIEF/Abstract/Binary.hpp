@@ -29,6 +29,7 @@
 #include "LIEF/Abstract/Section.hpp"
 #include "LIEF/Abstract/Relocation.hpp"
 #include "LIEF/Abstract/Function.hpp"
+#include "LIEF/Abstract/StringEntry.hpp"
 
 //! LIEF namespace
 namespace LIEF {
@@ -110,6 +111,17 @@ class LIEF_API Binary : public Object {
 
   std::vector<uint64_t> xref(uint64_t address) const;
 
+  //! Batched version of xref: the sections are scanned once for all the
+  //! ``addresses``. The result is aligned with ``addresses``
+  std::vector<std::vector<uint64_t>> xrefs(const std::vector<uint64_t>& addresses) const;
+
+  //! Extract the printable strings (ASCII and, if ``utf16`` is set, UTF-16LE)
+  //! of at least ``min_size`` characters from the content of the sections.
+  //!
+  //! The entries are sorted by section and then by offset.
+  //! See: LIEF::extract_strings
+  std::vector<StringEntry> extract_strings(size_t min_size = 4, bool utf16 = true) const;
+
   //! @brief Patch the content at virtual address @p address with @p patch_value
   //!
   //! @param[in] address Address to patch
@@ -19,6 +19,8 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <functional>
+#include <chrono>
 
 #include "LIEF/visibility.h"
 
@@ -44,6 +46,15 @@ class LIEF_API Parser {
   //! @see LIEF::MachO::Parser::parse
   static std::unique_ptr<Binary> parse(const std::vector<uint8_t>& raw, const std::string& name = "");
 
+  //! @brief Construct an LIEF::Binary from the ``size`` bytes at ``data``
+  //!
+  //! ELF binaries are parsed **without copying** ``data``: in this case ``data``
+  //! must outlive the binary and it must not be modified while the binary is alive.
+  //! The other formats are parsed from a copy.
+  //!
+  //! @see LIEF::ELF::Parser::parse
+  static std::unique_ptr<Binary> parse(const uint8_t* data, size_t size, const std::string& name = "");
+
   protected:
   Parser(const std::string& file);
   uint64_t    binary_size_;
@@ -52,6 +63,46 @@ class LIEF_API Parser {
   ~Parser();
   Parser();
 };
+
+//! Options of LIEF::parse_many
+struct ParseManyOptions {
+  //! Number of threads used to parse the files (0 means all the hardware threads)
+  size_t threads = 0;
+};
+
+//! Outcome of the parsing of one file by LIEF::parse_many
+struct ParseResult {
+  //! Index of the file in the list given to LIEF::parse_many
+  size_t index = 0;
+
+  //! Path of the file
+  std::string path;
+
+  //! The parsed binary or a nullptr if the parsing failed
+  std::unique_ptr<Binary> binary;
+
+  //! Error message if the parsing failed (empty otherwise)
+  std::string error;
+
+  //! Time spent to parse the file
+  std::chrono::nanoseconds duration{0};
+
+  inline bool ok() const {
+    return this->binary != nullptr;
+  }
+};
+
+//! Parse the given files with LIEF::Parser::parse on a pool of threads and
+//! stream the outcome of each file to ``callback``.
+//!
+//! The files are scheduled with work stealing and the callback is called
+//! as soon as a file is processed, in the completion order. The calls to the
+//! callback are serialized (but they can come from different threads).
+//! An exception raised by the callback stops the processing and it is
+//! re-thrown by this function.
+LIEF_API void parse_many(const std::vector<std::string>& paths,
+                         const std::function<void(ParseResult&)>& callback,
+                         const ParseManyOptions& options = ParseManyOptions{});
 }
 
 #endif
@@ -29,6 +29,18 @@ class LIEF_API Section : public Object {
   public:
   static constexpr size_t npos = -1;
 
+  //! Non-owning view on the content of a section
+  struct content_view_t {
+    content_view_t() = default;
+    content_view_t(const uint8_t* ptr, size_t len) :
+      data{ptr},
+      size{len}
+    {}
+
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+  };
+
   Section();
   Section(const std::string& name);
 
@@ -63,11 +75,23 @@ class LIEF_API Section : public Object {
   //! @brief Set section content
   virtual void content(const std::vector<uint8_t>& data);
 
+  //! Read-only view on the section's content which avoids the copy made by content().
+  //! If the content can't be exposed as a contiguous buffer, it is copied in ``buffer``.
+  //!
+  //! The view is invalidated by a modification of the section or of ``buffer``
+  virtual content_view_t content_view(std::vector<uint8_t>& buffer) const;
+
   virtual void offset(uint64_t offset);
 
   //! @brief Section's entropy
   double entropy() const;
 
+  //! Entropy of the windows of ``window`` bytes that start every ``stride`` bytes
+  //! of the section's content
+  //!
+  //! @see LIEF::entropy_profile
+  std::vector<double> entropy_profile(size_t window, size_t stride) const;
+
   // Search functions
   // ================
   size_t search(uint64_t integer, size_t pos, size_t size) const;
@@ -83,6 +107,10 @@ class LIEF_API Section : public Object {
 
   std::vector<size_t> search_all(const std::string& v) const;
 
+  //! Look for all the occurrences of the given patterns in a single pass over the
+  //! content. The result is aligned with ``patterns``
+  std::vector<std::vector<size_t>> search_patterns(const std::vector<std::vector<uint8_t>>& patterns) const;
+
   //! @brief Method so that the ``visitor`` can visit us
   virtual void accept(Visitor& visitor) const override;
 
@@ -0,0 +1,76 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ABSTRACT_STRING_ENTRY_H_
+#define LIEF_ABSTRACT_STRING_ENTRY_H_
+#include <cstdint>
+#include <vector>
+#include <iostream>
+
+#include "LIEF/visibility.h"
+
+namespace LIEF {
+
+//! Location of a string found by Binary::extract_strings or LIEF::extract_strings.
+//!
+//! The entry doesn't hold the characters: they can be read from the
+//! buffer (or the section content) at the given offset.
+struct LIEF_API StringEntry {
+  enum class ENCODING : uint8_t {
+    ASCII    = 0,
+    UTF16_LE = 1,
+  };
+
+  StringEntry() = default;
+  StringEntry(uint64_t off, uint64_t va, ENCODING enc, uint64_t len) :
+    offset{off},
+    virtual_address{va},
+    encoding{enc},
+    length{len}
+  {}
+
+  //! Offset of the string: in the file for Binary::extract_strings
+  //! or in the buffer for LIEF::extract_strings
+  uint64_t offset = 0;
+
+  //! Virtual address of the string (0 if it is not mapped)
+  uint64_t virtual_address = 0;
+
+  ENCODING encoding = ENCODING::ASCII;
+
+  //! Number of characters
+  uint64_t length = 0;
+
+  //! Number of bytes used by the string
+  inline uint64_t size() const {
+    return this->encoding == ENCODING::UTF16_LE ? 2 * this->length : this->length;
+  }
+
+  LIEF_API friend std::ostream& operator<<(std::ostream& os, const StringEntry& entry);
+};
+
+//! Look for the runs of at least ``min_size`` printable characters (ASCII
+//! printable characters and tabulations) in the given buffer and, if ``utf16``
+//! is set, for the same characters encoded in UTF-16LE (as ``strings -el``).
+//!
+//! The entries are sorted by offset and their virtual address is 0.
+LIEF_API std::vector<StringEntry> extract_strings(const uint8_t* data, size_t size,
+                                                  size_t min_size = 4, bool utf16 = true);
+
+LIEF_API std::vector<StringEntry> extract_strings(const std::vector<uint8_t>& data,
+                                                  size_t min_size = 4, bool utf16 = true);
+
+}
+#endif
@@ -22,7 +22,16 @@
 #include "LIEF/visibility.h"
 
 namespace LIEF {
+class IndexTracker;
+
+template<class SYM>
+class SymbolsIndex;
+
 class LIEF_API Symbol : public Object {
+
+  template<class SYM>
+  friend class SymbolsIndex;
+
   public:
   Symbol();
   Symbol(const std::string& name);
@@ -37,6 +46,10 @@ class LIEF_API Symbol : public Object {
   //! @brief Return symbol name
   virtual const std::string& name() const;
 
+  //! @brief Return a mutable reference on the symbol name
+  //!
+  //! @deprecated Renaming a symbol through this reference is not seen by the
+  //! symbol lookups of the binary. Use name(const std::string&) instead.
   virtual std::string& name();
 
   //! @brief Set symbol name
@@ -56,8 +69,15 @@ class LIEF_API Symbol : public Object {
 
   protected:
   std::string name_;
+  //! Name interned in the string pool of the binary. If set, it takes precedence
+  //! over name_ and it is copied into name_ before the name is modified.
+  const std::string* interned_name_ = nullptr;
   uint64_t value_ = 0;
   uint64_t size_ = 0;
+
+  private:
+  IndexTracker* index_tracker_ = nullptr;
+  uint32_t      index_kind_    = 0;
 };
 }
 
@@ -36,6 +36,8 @@ class BinaryStream {
     UNKNOWN = 0,
     FILE,
     MEMORY,
+    MMAP,
+    SPAN,
   };
 
   BinaryStream();
@@ -0,0 +1,63 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_MMAP_STREAM_H
+#define LIEF_MMAP_STREAM_H
+
+#include <string>
+
+#include "LIEF/BinaryStream/SpanStream.hpp"
+
+namespace LIEF {
+//! Read-only stream backed by a memory mapping of the file.
+//!
+//! Contrary to the VectorStream, the file is not copied in memory: the
+//! pages are loaded by the kernel as they are accessed.
+class MmapStream : public SpanStream {
+  public:
+  MmapStream(const std::string& filename);
+
+  MmapStream(const MmapStream&)            = delete;
+  MmapStream& operator=(const MmapStream&) = delete;
+
+  inline STREAM_TYPE type() const override {
+    return STREAM_TYPE::MMAP;
+  }
+
+  virtual ~MmapStream();
+
+  //! Check if ``path`` is the file mapped by this stream (e.g. through a
+  //! different name or a link)
+  bool is_mapping(const std::string& path) const;
+
+  //! File descriptor (opened in read-only) of the mapped file or -1 if it is
+  //! not available (e.g. on Windows). It is owned by the stream.
+  int fd() const;
+
+  private:
+  // Identity of the mapped file: (device, inode) or (volume, file index) on Windows
+  uint64_t device_ = 0;
+  uint64_t inode_  = 0;
+
+#if defined(_WIN32)
+  void* file_handle_    = nullptr;
+  void* mapping_handle_ = nullptr;
+#else
+  int fd_ = -1;
+#endif
+};
+}
+
+#endif
@@ -0,0 +1,80 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_SPAN_STREAM_H
+#define LIEF_SPAN_STREAM_H
+
+#include <vector>
+#include <string>
+
+#include "LIEF/BinaryStream/BinaryStream.hpp"
+
+namespace LIEF {
+//! Read-only stream over a buffer that is **not** owned by the stream.
+//!
+//! It is used to expose a sub-range of another stream (e.g. a slice of a
+//! FAT MachO) without copying it. The buffer must outlive the stream.
+class SpanStream : public BinaryStream {
+  public:
+  SpanStream(const uint8_t* data, uint64_t size);
+
+  SpanStream(const SpanStream&)            = delete;
+  SpanStream& operator=(const SpanStream&) = delete;
+
+  inline STREAM_TYPE type() const override {
+    return STREAM_TYPE::SPAN;
+  }
+
+  virtual uint64_t size() const override;
+
+  //! Return a **copy** of the underlying buffer
+  std::vector<uint8_t> content() const;
+
+  inline const uint8_t* p() const {
+    return this->data_ + this->pos();
+  }
+
+  inline const uint8_t* start() const {
+    return this->data_;
+  }
+
+  inline const uint8_t* end() const {
+    return this->data_ + this->size_;
+  }
+
+  virtual result<size_t> asn1_read_tag(int tag) override;
+  virtual result<size_t> asn1_read_len() override;
+  result<size_t> asn1_peek_len();
+  virtual result<std::string> asn1_read_alg() override;
+  virtual result<std::string> asn1_read_oid() override;
+  virtual result<int32_t> asn1_read_int() override;
+  virtual result<std::vector<uint8_t>> asn1_read_bitstring() override;
+  virtual result<std::vector<uint8_t>> asn1_read_octet_string() override;
+  virtual result<std::unique_ptr<mbedtls_x509_crt>> asn1_read_cert() override;
+  virtual result<std::string> x509_read_names() override;
+  virtual result<std::vector<uint8_t>> x509_read_serial() override;
+  virtual result<std::unique_ptr<mbedtls_x509_time>> x509_read_time() override;
+
+  virtual ~SpanStream();
+
+  protected:
+  SpanStream();
+  virtual const void* read_at(uint64_t offset, uint64_t size, bool throw_error = true) const override;
+  const uint8_t* data_ = nullptr;
+  uint64_t size_ = 0;
+};
+}
+
+#endif
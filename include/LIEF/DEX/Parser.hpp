@@ -113,7 +113,7 @@ class LIEF_API Parser {
 
     std::unordered_multimap<std::string, Type*> class_type_map_;
 
-    std::unique_ptr<VectorStream> stream_;
+    std::unique_ptr<BinaryStream> stream_;
 };
 
 
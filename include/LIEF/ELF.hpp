@@ -23,6 +23,7 @@
 #include "LIEF/ELF/enums.hpp"
 
 #include "LIEF/ELF/Parser.hpp"
+#include "LIEF/ELF/ParserConfig.hpp"
 #include "LIEF/ELF/Header.hpp"
 #include "LIEF/ELF/Section.hpp"
 #include "LIEF/ELF/Binary.hpp"
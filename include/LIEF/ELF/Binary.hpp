@@ -18,6 +18,8 @@
 
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <atomic>
 
 #include "LIEF/visibility.h"
 
@@ -32,6 +34,16 @@
 
 
 namespace LIEF {
+class IndexTracker;
+
+template<class SYM>
+class SymbolsIndex;
+
+template<class T>
+class ObjectPool;
+
+class StringPool;
+
 namespace ELF {
 namespace DataHandler {
 class Handler;
@@ -48,8 +60,13 @@ class Note;
 class Relocation;
 class Parser;
 class Builder;
+class AddressIndex;
 
 //! Class which represent an ELF binary
+//!
+//! The const member functions can be called concurrently from several
+//! threads, including the ones that load the tables skipped by the ParserConfig.
+//! Modifying a binary while another thread accesses it is not supported.
 class LIEF_API Binary : public LIEF::Binary {
   friend class Parser;
   friend class Builder;
@@ -269,6 +286,24 @@ class LIEF_API Binary : public LIEF::Binary {
 
   Symbol& get_dynamic_symbol(const std::string& name);
 
+  //! Resolve the dynamic symbol with the given name as the loader does: with the
+  //! ``DT_GNU_HASH`` table (bloom filter, bucket and hash chain) or, if the binary
+  //! only has a ``DT_HASH`` table, with the SYSV buckets and chains.
+  //!
+  //! Like ``ld.so``, only the symbols defined by the binary are found: the imports
+  //! (undefined symbols) are never returned.
+  //! If the binary doesn't have a hash table or if dynamic symbols have been added,
+  //! removed, reordered or renamed since the parsing, the lookup falls back on the
+  //! name index, restricted to the same defined symbols. Reading or modifying other
+  //! attributes of the symbols (e.g. through dynamic_symbols()) keeps the hash tables in use.
+  //!
+  //! @return nullptr if the symbol can't be found
+  const Symbol* lookup_dynamic_symbol(const std::string& name) const;
+
+  //! Batched version of lookup_dynamic_symbol. The returned vector is aligned
+  //! with ``names`` and contains a nullptr for the names that can't be resolved.
+  std::vector<const Symbol*> lookup_dynamic_symbols(const std::vector<std::string>& names) const;
+
   //! Check if the symbol with the given ``name`` exists in the static symbol table
   bool has_static_symbol(const std::string& name) const;
 
@@ -392,6 +427,8 @@ class LIEF_API Binary : public LIEF::Binary {
 
 
   //! Strip the binary by removing static symbols
+  //!
+  //! The object relocations that reference a static symbol are detached from it
   void strip();
 
   //! Remove a binary's section.
@@ -554,6 +591,22 @@ class LIEF_API Binary : public LIEF::Binary {
   const Section& operator[](ELF_SECTION_TYPES type) const;
 
   protected:
+  //! Tables tracked by the Binary so that the Builder only regenerates
+  //! the ones that have been modified since the parsing (or the last build)
+  enum MODIFIED : uint32_t {
+    MODIFIED_NONE            = 0,
+    MODIFIED_DYNAMIC_ENTRIES = 1 << 0,
+    MODIFIED_DYNAMIC_SYMBOLS = 1 << 1,
+    MODIFIED_STATIC_SYMBOLS  = 1 << 2,
+    MODIFIED_RELOCATIONS     = 1 << 3,
+    MODIFIED_SYMBOL_VERSIONS = 1 << 4,
+    MODIFIED_NOTES           = 1 << 5,
+    MODIFIED_INTERPRETER     = 1 << 6,
+    //! Sections or segments added, removed or resized
+    MODIFIED_LAYOUT          = 1 << 7,
+    MODIFIED_ALL             = 0xFF,
+  };
+
   Binary();
 
   //! Return an abstraction of binary's section: LIEF::Section
@@ -599,6 +652,46 @@ class LIEF_API Binary : public LIEF::Binary {
 
   LIEF::Binary::functions_t tor_functions(DYNAMIC_TAGS tag) const;
 
+  //! Return the sorted index of the sections, segments and relocations.
+  //! The parts used by the given IndexTracker::KIND are updated if they are stale.
+  const AddressIndex& address_index(uint32_t kinds) const;
+
+  //! Flag the whole address index as stale. Must be called when the sections,
+  //! the segments or the relocations containers are modified
+  void invalidate_address_index();
+
+  //! Return the name -> symbol index of the dynamic / static symbols.
+  //! They are rebuilt by the lookups if they are stale.
+  SymbolsIndex<Symbol>& dynamic_symbols_index() const;
+  SymbolsIndex<Symbol>& static_symbols_index() const;
+
+  //! Flag the symbols indexes (and the parsed hash tables) as stale. Must be
+  //! called when the symbol tables are reordered
+  void invalidate_symbols_index();
+
+  //! Return the table used by lookup_dynamic_symbol: DT_GNU_HASH, DT_HASH or
+  //! DT_NULL when the name index must be used
+  DYNAMIC_TAGS dynamic_symbols_lookup_table() const;
+  const Symbol* lookup_dynamic_symbol(const std::string& name, DYNAMIC_TAGS table) const;
+  const Symbol* gnu_hash_lookup(const std::string& name) const;
+  const Symbol* sysv_hash_lookup(const std::string& name) const;
+
+  //! Parse the tables skipped by the ParserConfig used to create the binary.
+  //! They are no-op when the tables are already parsed.
+  void load_static_symbols() const;
+  void load_relocations() const;
+  void load_symbol_versions() const;
+  void load_notes() const;
+  void load_deferred() const;
+  void load_deferred(void (Parser::*parse)()) const;
+
+  //! Flag the given tables (MODIFIED bits) as modified. It must be called by
+  //! the functions that modify a table or that return a mutable reference on it.
+  //!
+  //! The deferred tables are loaded first since they are linked to the
+  //! symbols and the sections of the original binary
+  void mark_modified(uint32_t tables);
+
   //! The binary type
   //! (i.e. `ELF32` or `ELF64`)
   ELF_CLASS type_;
@@ -621,6 +714,10 @@ class LIEF_API Binary : public LIEF::Binary {
   //! A list of static symbols
   symbols_t static_symbols_;
 
+  //! Static symbols removed by strip(). They are destroyed with the binary
+  //! since they can still be referenced (e.g. by the Python bindings)
+  symbols_t stripped_symbols_;
+
   relocations_t relocations_;
 
   //! .gnu.version
@@ -644,6 +741,34 @@ class LIEF_API Binary : public LIEF::Binary {
   //! object used to manage segments/sections
   DataHandler::Handler* datahandler_{nullptr};
 
+  //! Staleness of the indexes below
+  std::unique_ptr<IndexTracker> index_tracker_;
+
+  //! Index used by the address/offset lookups
+  std::unique_ptr<AddressIndex> address_index_;
+
+  //! Name -> symbol indexes used by the symbols lookups
+  std::unique_ptr<SymbolsIndex<Symbol>> dynamic_symbols_index_;
+  std::unique_ptr<SymbolsIndex<Symbol>> static_symbols_index_;
+
+  //! Parser kept alive to parse the tables skipped by the ParserConfig
+  mutable std::unique_ptr<Parser> parser_;
+  mutable std::atomic<bool> has_deferred_{false};
+  //! Serialize the loading of the deferred tables. It is recursive since the
+  //! parser uses the accessors of the binary
+  mutable std::recursive_mutex deferred_mutex_;
+
+  //! Pools used to allocate the symbols, the relocations and the symbol versions
+  std::unique_ptr<ObjectPool<Symbol>>        symbols_pool_;
+  std::unique_ptr<ObjectPool<Relocation>>    relocations_pool_;
+  std::unique_ptr<ObjectPool<SymbolVersion>> symbol_versions_pool_;
+
+  //! Names of the symbols shared by ``.dynsym`` and ``.symtab``
+  std::unique_ptr<StringPool> names_pool_;
+
+  //! Tables (MODIFIED bits) to regenerate in the Builder
+  mutable uint32_t modified_ = MODIFIED_ALL;
+
   std::string interpreter_;
   overlay_t overlay_;
 };
@@ -19,6 +19,10 @@
 
 #include <vector>
 #include <string>
+#include <utility>
+#include <iosfwd>
+#include <map>
+#include <memory>
 #include <unordered_map>
 #include <functional>
 
@@ -26,6 +30,7 @@
 #include "LIEF/iostream.hpp"
 
 #include "LIEF/ELF/enums.hpp"
+#include "LIEF/ELF/DataHandler/Handler.hpp"
 
 struct Profiler;
 
@@ -37,11 +42,17 @@ class Note;
 class DynamicEntryArray;
 class DynamicEntry;
 class Section;
+class Symbol;
 
 //! @brief Class which take a ELF::Binary object and reconstruct a valid binary
 class LIEF_API Builder {
   public:
   friend struct ::Profiler;
+
+  //! Patch produced by an in-place build: ``(file offset, bytes)``
+  using patch_t   = std::pair<uint64_t, std::vector<uint8_t>>;
+  using patches_t = std::vector<patch_t>;
+
   Builder(Binary *binary);
 
   Builder() = delete;
@@ -51,24 +62,142 @@ class LIEF_API Builder {
 
   Builder& empties_gnuhash(bool flag = true);
 
+  //! Number of threads used to serialize the static symbols, the notes and
+  //! the object relocations. ``0`` means all the hardware threads.
+  Builder& threads(size_t nb_threads);
+
+  //! Build the modifications **in place** when they fit in the original file
+  //! (e.g. Binary::patch_address, modified DynamicEntry values, ...).
+  //!
+  //! In this mode, build() computes a list of patches on the original file
+  //! instead of a new image. It falls back on a full rebuild if the layout
+  //! of the binary has to change.
+  Builder& in_place(bool flag = true);
+
+  //! True if the last build() has been done in place
+  bool is_in_place() const;
+
+  //! Patches computed by the last in-place build()
+  const patches_t& patches() const;
+
+  //! Write the build result into the **original** file ``path``.
+  //!
+  //! Only the patches are written if the build has been done in place,
+  //! otherwise the file is entirely rewritten. When ``path`` is the file
+  //! mapped by the binary, it is never truncated: the new content is written
+  //! in a temporary file that replaces ``path``.
+  //!
+  //! @return false if the file can't be written (the error is logged)
+  bool apply_in_place(const std::string& path) const;
+
+  //! Return the build result in a single buffer.
+  //!
+  //! The result is assembled (and then cached) by this function: write() does
+  //! not need it.
   const std::vector<uint8_t>& get_build();
+
+  //! Write the build result into the file ``filename``.
+  //!
+  //! The build result is a list of extents (see: extent_t) whose unmodified
+  //! ranges are still read from the original file. On Linux, these ranges are
+  //! copied by the kernel (``copy_file_range``) and the other ones are written
+  //! with ``pwritev``.
+  //!
+  //! If ``filename`` is the file that is mapped by the binary, the content
+  //! that is still read from the mapping is first copied in memory so that
+  //! the binary remains valid once the file is overwritten.
+  //!
+  //! @warning The binary must not be modified between build() and write()
   void write(const std::string& filename) const;
 
+  //! Write the build result into the given stream (without intermediate copy)
+  void write(std::ostream& os) const;
+
   protected:
+  //! Range of the build result. The bytes are either owned by the builder
+  //! (``buffer``) or read from the content of the binary when the result is
+  //! written (``buffer == nullptr``), so that the unmodified ranges of the
+  //! original file are not copied
+  struct extent_t {
+    extent_t(uint64_t size, std::shared_ptr<const std::vector<uint8_t>> buffer, uint64_t source);
+
+    uint64_t size;
+    std::shared_ptr<const std::vector<uint8_t>> buffer;
+    uint64_t source; ///< Offset in ``buffer`` or in the content of the binary
+  };
+  //! Extents indexed by their offset in the build result. The gaps are zeros
+  using extents_t = std::map<uint64_t, extent_t>;
+
+  //! Place ``data`` at ``offset`` in the build result. It overrides the bytes
+  //! previously placed in this range
+  void emit(uint64_t offset, std::vector<uint8_t> data);
+
+  //! Place the ``size`` bytes of the binary's content at ``content_offset``
+  //! in the build result at ``offset``
+  void emit_content(uint64_t offset, uint64_t content_offset, uint64_t size);
+
+  void place(uint64_t offset, extent_t extent);
+
+  //! Split the extent that covers ``offset`` and return the first extent
+  //! that starts at (or after) ``offset``
+  extents_t::iterator split(uint64_t offset);
+
+  //! Flatten the extents into contiguous ranges of the build result: the
+  //! content extents are resolved into the chunks of the DataHandler
+  std::vector<DataHandler::Handler::Extent> ranges() const;
+
+  //! Size of the build result
+  uint64_t build_size() const;
+
+  //! Write the build result into the file ``path`` (which is truncated)
+  bool write_file(const std::string& path) const;
+
+  //! Replace the file ``path``, mapped by the binary, with the build result
+  bool replace(const std::string& path) const;
+
   template<typename ELF_T>
   void build();
 
   template<typename ELF_T>
   void build(const Header& header);
 
+  template<typename ELF_T>
+  bool build_in_place();
+
+  //! Serialize the ELF header, the program headers table and the
+  //! section headers table
+  template<typename ELF_T>
+  std::vector<uint8_t> raw_header(const Header& header) const;
+
+  template<typename ELF_T>
+  std::vector<uint8_t> raw_program_headers() const;
+
+  template<typename ELF_T>
+  std::vector<uint8_t> raw_section_headers(const std::vector<uint8_t>& section_names) const;
+
   template<typename ELF_T>
   void build_sections();
 
   template<typename ELF_T>
   void build_segments();
 
+  //! Index of the symbols in the dynamic symbol table (or in the static one)
+  using symbols_idx_t = std::unordered_map<const Symbol*, uint32_t>;
+
+  //! Serialize the static symbols, the notes and the object relocations
+  //! in parallel and then place them in the binary.
+  //! Return true if the binary has been rebuilt by a nested build()
+  template<typename ELF_T>
+  bool build_static_tables(bool static_symbols, bool notes, bool relocations);
+
+  template<typename ELF_T>
+  void build_static_symbols(std::vector<uint8_t> symtab, std::vector<uint8_t> strtab,
+                            uint32_t first_exported_symbol_index);
+
   template<typename ELF_T>
-  void build_static_symbols();
+  void serialize_static_symbols(std::vector<uint8_t>& symtab, std::vector<uint8_t>& strtab) const;
+
+  uint32_t sort_static_symbols();
 
   template<typename ELF_T>
   void build_dynamic();
@@ -86,7 +215,18 @@ class LIEF_API Builder {
   void build_pltgot_relocations();
 
   template<typename ELF_T>
-  void build_section_relocations();
+  void build_section_relocations(const std::vector<std::pair<Section*, const Section*>>& sections,
+                                 bool is_rela, std::vector<std::vector<uint8_t>> contents);
+
+  template<typename ELF_T>
+  std::vector<uint8_t> serialize_section_relocations(const Section& section, bool is_rela,
+                                                     const symbols_idx_t& symbols_idx) const;
+
+  //! Return the SHT_REL(A) sections of the object relocations associated
+  //! with the section they relocate
+  std::vector<std::pair<Section*, const Section*>> object_relocations_sections(bool& is_rela);
+
+  symbols_idx_t symbols_index() const;
 
   template<typename ELF_T>
   void build_hash_table();
@@ -107,11 +247,6 @@ class LIEF_API Builder {
   template<typename ELF_T>
   void build_symbol_definition();
 
-  template<typename T, typename HANDLER>
-  std::vector<std::string> optimize(const HANDLER& e,
-                                    std::function<std::string(const typename HANDLER::value_type)> getter,
-                                    std::unordered_map<std::string, size_t> *of_map_p=nullptr);
-
   template<typename ELF_T>
   void build_symbol_version();
 
@@ -119,7 +254,9 @@ class LIEF_API Builder {
   void build_interpreter();
 
   template<typename ELF_T>
-  void build_notes();
+  void build_notes(std::vector<uint8_t> raw_notes);
+
+  std::vector<uint8_t> serialize_notes() const;
 
   void build(NOTE_TYPES type);
 
@@ -137,8 +274,17 @@ class LIEF_API Builder {
 
   Section& array_section(uint64_t addr);
 
+  //! Cache of get_build()
   mutable vector_iostream ios_;
+  extents_t extents_;
   Binary* binary_{nullptr};
+
+  size_t threads_{1};
+  size_t nb_builds_{0};
+
+  bool in_place_{false};
+  bool is_in_place_{false};
+  patches_t patches_;
 };
 
 } // namespace ELF
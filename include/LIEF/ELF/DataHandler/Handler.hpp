@@ -16,6 +16,11 @@
 #ifndef ELF_DATA_HANDLER_HANDLER_H_
 #define ELF_DATA_HANDLER_HANDLER_H_
 #include <vector>
+#include <map>
+#include <array>
+#include <tuple>
+#include <memory>
+#include <utility>
 
 #include "LIEF/visibility.h"
 #include "LIEF/utils.hpp"
@@ -27,20 +32,100 @@ class BinaryStream;
 namespace ELF {
 namespace DataHandler {
 
+//! Manage the raw content of an ELF binary.
+//!
+//! When it is created from a stream, the handler does not copy the
+//! original bytes: it keeps a reference on the stream and works as a
+//! copy-on-write overlay. Only the chunks (aligned on Handler::PAGE_GRANULARITY)
+//! that are modified are materialized in memory.
 class LIEF_API Handler {
   public:
-  static constexpr size_t MAX_SIZE = 1_GB;
+  static constexpr size_t MAX_SIZE         = 1_GB;
+  static constexpr size_t PAGE_GRANULARITY = 0x1000;
+
+  //! Contiguous range of the content (see: extents())
+  struct Extent {
+    Extent(uint64_t offset, uint64_t size, const uint8_t* data, bool from_stream, uint64_t stream_offset);
+
+    uint64_t offset;        ///< Offset in the content
+    uint64_t size;          ///< Size of the range
+    const uint8_t* data;    ///< Bytes of the range or a nullptr if they are zeros
+    bool from_stream;       ///< Whether the bytes are still read from the original stream
+    uint64_t stream_offset; ///< Offset of the bytes in the original stream (if from_stream)
+  };
+
   Handler(const std::vector<uint8_t>& content);
   Handler(std::vector<uint8_t>&& content);
+
+  //! Create an handler which **copies** the stream's content
   Handler(BinaryStream& stream);
+
+  //! Create an handler on top of the stream's content (no copy)
+  Handler(std::shared_ptr<BinaryStream> stream);
   ~Handler();
 
   Handler& operator=(const Handler&);
   Handler(const Handler&);
 
+  //! Size of the (possibly modified) content
+  uint64_t size() const;
+
+  //! Return the whole content in a single buffer.
+  //!
+  //! @deprecated The content is materialized and flattened in memory by this
+  //! function, which defeats the copy-on-write overlay. Use read(), view() and
+  //! write() instead. The size of the returned buffer must not be changed.
   const std::vector<uint8_t>& content() const;
   std::vector<uint8_t>& content();
 
+  //! Copy ``size`` bytes at the given offset into ``out``.
+  //! Bytes out of the content are zero-filled
+  void read(uint64_t offset, uint64_t size, uint8_t* out) const;
+  std::vector<uint8_t> read(uint64_t offset, uint64_t size) const;
+
+  //! Return a pointer on the ``size`` bytes at the given offset if they are
+  //! stored contiguously (no copy). Otherwise, return a nullptr and read()
+  //! must be used
+  const uint8_t* view(uint64_t offset, uint64_t size) const;
+
+  //! Split ``[offset, offset + size)`` into the ranges that are read from the
+  //! original stream, owned by the handler or zeros, without copying them.
+  //! Bytes out of the content are zeros
+  std::vector<Extent> extents(uint64_t offset, uint64_t size) const;
+
+  //! File descriptor of the file from which the ranges Extent::from_stream
+  //! are read, or -1 if they can only be read from memory
+  int stream_fd() const;
+
+  //! Write ``size`` bytes at the given offset. The content is extended if needed
+  void write(uint64_t offset, const uint8_t* data, uint64_t size);
+
+  //! Fill ``size`` bytes at the given offset with ``value``
+  void fill(uint64_t offset, uint64_t size, uint8_t value);
+
+  //! Number of bytes that are materialized by the overlay
+  uint64_t materialized_size() const;
+
+  //! Whether the content can be expressed as byte patches of the original
+  //! stream: the handler is created on top of a stream and the content has
+  //! neither been shifted nor extended
+  bool is_patchable() const;
+
+  //! Return the ranges of the content that differ from the original stream
+  //! as ``(offset, bytes)`` pairs sorted by offset. It requires is_patchable()
+  std::vector<std::pair<uint64_t, std::vector<uint8_t>>> diff() const;
+
+  //! Whether the content still references the file ``path`` through a
+  //! memory mapping
+  bool is_mapping(const std::string& path) const;
+
+  //! Copy the bytes that are still read from the original stream and release
+  //! the stream, so that its file can be modified or overwritten.
+  //!
+  //! The content can no longer be expressed as patches afterwards
+  //! (see: is_patchable())
+  void detach();
+
   Node& add(const Node& node);
 
   bool has(uint64_t offset, uint64_t size, Node::Type type);
@@ -51,14 +136,60 @@ class LIEF_API Handler {
 
   void remove(uint64_t offset, uint64_t size, Node::Type type);
 
+  //! Change the offset of a node owned by the handler.
+  //!
+  //! Nodes must not be modified directly since they are indexed on
+  //! their type, offset and size
+  Node& move(Node& node, uint64_t offset);
+
+  //! Change the size of a node owned by the handler
+  Node& resize(Node& node, uint64_t size);
+
+  //! Return the nodes of the given type that overlap ``[offset, offset + size)``
+  std::vector<Node*> overlapping(uint64_t offset, uint64_t size, Node::Type type) const;
+
   void make_hole(uint64_t offset, uint64_t size);
 
   void reserve(uint64_t offset, uint64_t size);
 
   private:
+  //! Contiguous range of the content which is either a view on the
+  //! original buffer, zeros or bytes owned by the handler
+  struct Chunk {
+    enum class KIND {
+      BASE = 0,
+      ZERO,
+      OWNED,
+    };
+    KIND kind;
+    uint64_t size;
+    uint64_t base_offset;
+    std::vector<uint8_t> data;
+  };
+  using chunks_t = std::map<uint64_t, Chunk>;
+
+  // Nodes are indexed on (type, offset, size)
+  using node_key_t = std::tuple<uint8_t, uint64_t, uint64_t>;
+  using nodes_t    = std::multimap<node_key_t, Node*>;
+
   Handler();
-  std::vector<uint8_t> data_;
-  std::vector<Node*> nodes_;
+  chunks_t::iterator split(uint64_t offset);
+  void materialize(uint64_t offset, uint64_t size);
+  nodes_t::iterator find(const Node& node);
+  Node& insert(Node* node);
+
+  std::shared_ptr<BinaryStream> stream_;
+  std::vector<uint8_t> empty_;
+  const uint8_t* base_ = nullptr;
+  uint64_t size_ = 0;
+  uint64_t base_size_ = 0;
+  bool shifted_ = false;
+  chunks_t chunks_;
+  nodes_t nodes_;
+
+  // Upper bound on the size of the nodes (per type) used to
+  // limit the range of the overlap queries
+  std::array<uint64_t, Node::UNKNOWN + 1> max_node_size_{{0, 0, 0}};
 };
 } // namespace DataHandler
 } // namespace ELF
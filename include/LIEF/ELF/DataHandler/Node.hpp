@@ -24,6 +24,8 @@
 namespace LIEF {
 namespace ELF {
 namespace DataHandler {
+class Handler;
+
 class LIEF_API Node {
   public:
     enum Type : uint8_t {
@@ -41,10 +43,6 @@ class LIEF_API Node {
     uint64_t offset() const;
     Type     type() const;
 
-    void size(uint64_t size);
-    void type(Type type);
-    void offset(uint64_t offset);
-
     bool operator==(const Node& rhs) const;
     bool operator!=(const Node& rhs) const;
 
@@ -55,6 +53,13 @@ class LIEF_API Node {
     bool operator>=(const Node& rhs) const;
 
   private:
+    // The nodes are indexed by the Handler on their type, offset and size:
+    // they must be changed through Handler::move() and Handler::resize()
+    friend class Handler;
+    void size(uint64_t size);
+    void type(Type type);
+    void offset(uint64_t offset);
+
     uint64_t size_;
     uint64_t offset_;
     Type     type_;
@@ -22,6 +22,7 @@
 #include "LIEF/Abstract/Parser.hpp"
 
 #include "LIEF/ELF/enums.hpp"
+#include "LIEF/ELF/ParserConfig.hpp"
 
 struct Profiler;
 
@@ -40,6 +41,7 @@ class Binary;
 //! Class which parse an ELF file and transform into a ELF::Binary
 class LIEF_API Parser : public LIEF::Parser {
   friend class OAT::Parser;
+  friend class Binary;
   public:
   friend struct ::Profiler;
 
@@ -78,17 +80,61 @@ class LIEF_API Parser : public LIEF::Parser {
   //! @return LIEF::ELF::Binary
   static std::unique_ptr<Binary> parse(const std::vector<uint8_t>& data, const std::string& name = "", DYNSYM_COUNT_METHODS count_mtd = DYNSYM_COUNT_METHODS::COUNT_AUTO);
 
+  //! Parse an ELF file with the given configuration
+  //!
+  //! The tables skipped by the configuration are parsed on their first access
+  //!
+  //! @param[in] file Path to the ELF binary
+  //! @param[in] conf Parser configuration (e.g. ParserConfig::quick())
+  static std::unique_ptr<Binary> parse(const std::string& file, const ParserConfig& conf);
+
+  //! Parse the given raw data as an ELF binary with the given configuration
+  //!
+  //! @param[in] data Raw ELF
+  //! @param[in] name Binary name
+  //! @param[in] conf Parser configuration (e.g. ParserConfig::quick())
+  static std::unique_ptr<Binary> parse(const std::vector<uint8_t>& data, const std::string& name, const ParserConfig& conf);
+
+  //! Parse the ``size`` bytes at ``data`` as an ELF binary **without copying them**
+  //!
+  //! The binary reads its content from ``data`` which must outlive it and
+  //! which must not be modified while the binary is alive.
+  //!
+  //! @param[in] data Raw ELF
+  //! @param[in] size Size of the raw ELF
+  //! @param[in] name Binary name
+  //! @param[in] conf Parser configuration (e.g. ParserConfig::quick())
+  static std::unique_ptr<Binary> parse(const uint8_t* data, size_t size, const std::string& name = "",
+                                       const ParserConfig& conf = ParserConfig::all());
+
   Parser& operator=(const Parser&) = delete;
   Parser(const Parser&)            = delete;
 
+  ~Parser();
+
   private:
   Parser();
-  Parser(const std::string& file, DYNSYM_COUNT_METHODS count_mtd = DYNSYM_COUNT_METHODS::COUNT_AUTO, Binary* output = nullptr);
-  Parser(const std::vector<uint8_t>& data, const std::string& name, DYNSYM_COUNT_METHODS count_mtd = DYNSYM_COUNT_METHODS::COUNT_AUTO, Binary* output = nullptr);
-  ~Parser();
+  Parser(const std::string& file, const ParserConfig& conf = ParserConfig::all(), Binary* output = nullptr);
+  Parser(const std::vector<uint8_t>& data, const std::string& name, const ParserConfig& conf = ParserConfig::all(), Binary* output = nullptr);
+  Parser(const uint8_t* data, size_t size, const std::string& name, const ParserConfig& conf);
 
   void init(const std::string& name = "");
 
+  //! Return the parsed binary. If some tables have been skipped,
+  //! the binary takes the ownership of the parser.
+  static std::unique_ptr<Binary> take_binary(std::unique_ptr<Parser> parser);
+
+  //! Whether some tables have been skipped by the configuration
+  bool has_deferred() const;
+
+  //! Parse the tables skipped by the configuration. They are called by the
+  //! Binary on the first access to these tables and they do nothing if the
+  //! table is already parsed.
+  void parse_deferred_static_symbols();
+  void parse_deferred_relocations();
+  void parse_deferred_symbol_versions();
+  void parse_deferred_notes();
+
   bool should_swap() const;
 
   // map, dynamic_symbol.version <----> symbol_version
@@ -159,7 +205,29 @@ class LIEF_API Parser : public LIEF::Parser {
   //!
   //! The section containing symbols name is found with the `link` attribute.
   template<typename ELF_T>
-  void parse_static_symbols(uint64_t offset, uint32_t nbSymbols, const Section* string_section);
+  void parse_static_symbols(uint64_t offset, uint32_t nbSymbols, uint64_t string_table_offset);
+
+  //! Resolve the location of the static symbols, the relocations, the symbol
+  //! versions and the notes from the sections, segments and dynamic entries.
+  //!
+  //! It is done when the binary is parsed so that the tables skipped by the
+  //! configuration are loaded from the original layout, whatever the
+  //! modifications done on the binary in the meantime
+  template<typename ELF_T>
+  void locate_tables();
+
+  //! Parse the static symbols from the ELF_SECTION_TYPES::SHT_SYMTAB Section
+  template<typename ELF_T>
+  void parse_static_symbols_table();
+
+  //! Parse the dynamic, PLT/GOT and sections relocations
+  template<typename ELF_T>
+  void parse_relocations();
+
+  //! Parse the symbol versions, requirements and definitions
+  //! and link them with the dynamic symbols
+  template<typename ELF_T>
+  void parse_symbol_versions();
 
   //! Parse Dynamic relocations
   //!
@@ -182,7 +250,7 @@ class LIEF_API Parser : public LIEF::Parser {
   //! use parse relocations by using LIEF::ELF::Segment. This method parse relocations
   //! that are not reachable through segments (For example Object file).
   template<typename ELF_T, typename REL_T>
-  void parse_section_relocations(const Section& section);
+  void parse_section_relocations(uint64_t offset, uint64_t size, Section* applies_to);
 
   //! Parse SymbolVersionRequirement
   //!
@@ -219,6 +287,9 @@ class LIEF_API Parser : public LIEF::Parser {
   //! Parse Note (.gnu.note)
   void parse_notes(uint64_t offset, uint64_t size);
 
+  //! Parse the notes from the PT_NOTE segment and the SHT_NOTE sections
+  void parse_notes();
+
   //! Parse Symbols's SYSV hash
   void parse_symbol_sysv_hash(uint64_t offset);
 
@@ -227,10 +298,45 @@ class LIEF_API Parser : public LIEF::Parser {
   template<typename ELF_T, typename REL_T>
   uint32_t max_relocation_index(uint64_t relocations_offset, uint64_t size) const;
 
-  std::unique_ptr<BinaryStream> stream_;
+  //! File range of a table
+  struct table_t {
+    bool     present;
+    uint64_t offset;
+    uint64_t size;
+  };
+
+  //! SHT_REL / SHT_RELA section
+  struct relocation_section_t {
+    std::string name;
+    table_t     table;
+    bool        is_rela;
+    bool        is_allocated;
+    Section*    applies_to;
+  };
+
+  //! Tables resolved by locate_tables()
+  struct tables_t {
+    table_t  symtab;         //!< .symtab: offset and number of symbols
+    uint64_t strtab_offset;  //!< Offset of the string table linked to the .symtab
+
+    table_t rela;            //!< DT_RELA / DT_RELASZ
+    table_t rel;             //!< DT_REL / DT_RELSZ
+    table_t jmprel;          //!< DT_JMPREL / DT_PLTRELSZ
+    bool    jmprel_is_rela;
+    std::vector<relocation_section_t> relocation_sections;
+
+    table_t versym;          //!< DT_VERSYM
+    table_t verneed;         //!< DT_VERNEED: offset and number of entries
+    table_t verdef;          //!< DT_VERDEF: offset and number of entries
+
+    std::vector<table_t> notes;
+  };
+
+  std::shared_ptr<BinaryStream> stream_;
   Binary*                       binary_{nullptr};
   ELF_CLASS                     type_;
-  DYNSYM_COUNT_METHODS          count_mtd_;
+  ParserConfig                  config_;
+  tables_t                      tables_ = tables_t();
 };
 
 
@@ -0,0 +1,57 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ELF_PARSER_CONFIG_H_
+#define LIEF_ELF_PARSER_CONFIG_H_
+#include <cstddef>
+
+#include "LIEF/visibility.h"
+#include "LIEF/ELF/enums.hpp"
+
+namespace LIEF {
+namespace ELF {
+
+//! Configuration of the ELF parser
+//!
+//! The tables that are not parsed by the parser are not lost: they are parsed
+//! on the first access (e.g. Binary::static_symbols(), Binary::relocations(),
+//! Binary::notes(), ...). The deferred parsing uses the original content
+//! of the file.
+struct LIEF_API ParserConfig {
+  //! Return a configuration so that all the ELF structures are parsed
+  static ParserConfig all();
+
+  //! Return a configuration so that only the header, the sections, the segments,
+  //! the dynamic entries and the dynamic symbols are parsed
+  //!
+  //! With this configuration:
+  //! * ``parse_static_symbols`` is set to ``false``
+  //! * ``parse_relocations`` is set to ``false``
+  //! * ``parse_symbol_versions`` is set to ``false``
+  //! * ``parse_notes`` is set to ``false``
+  static ParserConfig quick();
+
+  bool parse_static_symbols  = true;
+  bool parse_relocations     = true;
+  bool parse_symbol_versions = true;
+  bool parse_notes           = true;
+
+  //! Method used to count the dynamic symbols
+  DYNSYM_COUNT_METHODS count_mtd = DYNSYM_COUNT_METHODS::COUNT_AUTO;
+};
+
+}
+}
+#endif
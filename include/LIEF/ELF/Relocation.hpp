@@ -28,6 +28,8 @@
 #include "LIEF/ELF/enums.hpp"
 
 namespace LIEF {
+class IndexTracker;
+
 namespace ELF {
 
 class Parser;
@@ -35,6 +37,7 @@ class Binary;
 class Builder;
 class Symbol;
 class Section;
+class AddressIndex;
 
 struct Elf32_Rel;
 struct Elf32_Rela;
@@ -47,6 +50,7 @@ class LIEF_API Relocation : public LIEF::Relocation {
   friend class Parser;
   friend class Binary;
   friend class Builder;
+  friend class AddressIndex;
 
   public:
   Relocation(const Elf32_Rel*  header);
@@ -68,7 +72,7 @@ class LIEF_API Relocation : public LIEF::Relocation {
   Relocation(const Relocation& other);
   void swap(Relocation& other);
 
-  //uint64_t address() const;
+  virtual uint64_t address() const override;
   int64_t  addend() const;
   uint32_t type() const;
   bool     is_rela() const;
@@ -93,6 +97,7 @@ class LIEF_API Relocation : public LIEF::Relocation {
   Section&       section();
   const Section& section() const;
 
+  virtual void address(uint64_t address) override;
   void addend(int64_t addend);
   void type(uint32_t type);
   void purpose(RELOCATION_PURPOSES purpose);
@@ -116,6 +121,7 @@ class LIEF_API Relocation : public LIEF::Relocation {
   RELOCATION_PURPOSES purpose_;
   Section*            section_{nullptr};
   uint32_t            info_;
+  IndexTracker*       index_tracker_{nullptr};
 };
 
 
@@ -30,6 +30,8 @@
 
 
 namespace LIEF {
+class IndexTracker;
+
 namespace ELF {
 
 namespace DataHandler {
@@ -40,6 +42,7 @@ class Segment;
 class Parser;
 class Binary;
 class Builder;
+class AddressIndex;
 
 struct Elf64_Shdr;
 struct Elf32_Shdr;
@@ -52,6 +55,7 @@ class LIEF_API Section : public LIEF::Section {
   friend class Parser;
   friend class Binary;
   friend class Builder;
+  friend class AddressIndex;
 
   public:
   Section(uint8_t *data, ELF_CLASS type);
@@ -81,6 +85,8 @@ class LIEF_API Section : public LIEF::Section {
 
   void content(std::vector<uint8_t>&& data);
 
+  virtual content_view_t content_view(std::vector<uint8_t>& buffer) const override;
+
   //! @brief Section flags LIEF::ELF::ELF_SECTION_FLAGS
   uint64_t flags() const;
 
@@ -103,6 +109,10 @@ class LIEF_API Section : public LIEF::Section {
 
   virtual uint64_t offset() const override;
 
+  virtual void virtual_address(uint64_t virtual_address) override;
+
+  virtual uint64_t virtual_address() const override;
+
 
   //! @see offset
   uint64_t file_offset() const;
@@ -152,6 +162,7 @@ class LIEF_API Section : public LIEF::Section {
   uint64_t              entry_size_;
   segments_t            segments_;
   DataHandler::Handler* datahandler_{nullptr};
+  IndexTracker*         index_tracker_{nullptr};
   std::vector<uint8_t>  content_c_;
 };
 
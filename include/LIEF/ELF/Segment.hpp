@@ -22,12 +22,15 @@
 #include <memory>
 
 #include "LIEF/Object.hpp"
+#include "LIEF/Abstract/Section.hpp"
 #include "LIEF/visibility.h"
 
 #include "LIEF/ELF/type_traits.hpp"
 #include "LIEF/ELF/enums.hpp"
 
 namespace LIEF {
+class IndexTracker;
+
 namespace ELF {
 namespace DataHandler {
 class Handler;
@@ -36,6 +39,7 @@ class Handler;
 class Parser;
 class Binary;
 class Section;
+class AddressIndex;
 
 struct Elf64_Phdr;
 struct Elf32_Phdr;
@@ -46,6 +50,8 @@ class LIEF_API Segment : public Object {
   friend class Parser;
   friend class Section;
   friend class Binary;
+  friend class Builder;
+  friend class AddressIndex;
 
   public:
   Segment();
@@ -91,6 +97,21 @@ class LIEF_API Segment : public Object {
   template<typename T> void set_content_value(size_t offset, T value);
   size_t get_content_size() const;
 
+  //! Pointer on the content (without copy if possible) and its size.
+  //! ``buffer`` holds a copy of the content if it is not contiguous
+  //!
+  //! The view is invalidated by a modification of the segment or of ``buffer``
+  LIEF::Section::content_view_t content_view(std::vector<uint8_t>& buffer) const;
+
+  //! Entropy of the segment's content
+  double entropy() const;
+
+  //! Entropy of the windows of ``window`` bytes that start every ``stride`` bytes
+  //! of the segment's content
+  //!
+  //! @see LIEF::entropy_profile
+  std::vector<double> entropy_profile(size_t window, size_t stride) const;
+
   it_sections       sections();
   it_const_sections sections() const;
 
@@ -105,6 +126,7 @@ class LIEF_API Segment : public Object {
   LIEF_API friend std::ostream& operator<<(std::ostream& os, const Segment& segment);
 
   private:
+
   SEGMENT_TYPES         type_;
   ELF_SEGMENT_FLAGS     flags_;
   uint64_t              file_offset_;
@@ -115,6 +137,7 @@ class LIEF_API Segment : public Object {
   uint64_t              alignment_;
   sections_t            sections_;
   DataHandler::Handler* datahandler_{nullptr};
+  IndexTracker*         index_tracker_{nullptr};
   std::vector<uint8_t>  content_c_;
 };
 
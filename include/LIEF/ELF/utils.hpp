@@ -31,6 +31,9 @@ LIEF_API bool is_elf(const std::string& file);
 //! @brief check if the raw data is a ELF file
 LIEF_API bool is_elf(const std::vector<uint8_t>& raw);
 
+//! @brief check if the ``size`` bytes at ``data`` are an ELF file
+LIEF_API bool is_elf(const uint8_t* data, size_t size);
+
 LIEF_API unsigned long hash32(const char* name);
 LIEF_API unsigned long hash64(const char* name);
 LIEF_API uint32_t dl_new_hash(const char* name);
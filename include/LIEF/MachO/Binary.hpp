@@ -28,6 +28,11 @@
 #include "LIEF/MachO/Header.hpp"
 
 namespace LIEF {
+class IndexTracker;
+
+template<class SYM>
+class SymbolsIndex;
+
 namespace MachO {
 
 class BinaryParser;
@@ -40,6 +45,7 @@ class SubFramework;
 class SegmentSplitInfo;
 class DataInCode;
 class CodeSignature;
+class AddressIndex;
 class RPathCommand;
 class ThreadCommand;
 class VersionMin;
@@ -486,6 +492,17 @@ class LIEF_API Binary : public LIEF::Binary  {
   //! and keep a consistent state of the indexes.
   size_t add_cached_segment(SegmentCommand& segment);
 
+  //! Return the name -> symbol index. It is rebuilt by the lookups if it is stale.
+  SymbolsIndex<Symbol>& symbols_index() const;
+
+  //! Return the address -> section / segment index. The parts used by the
+  //! given IndexTracker::KIND are updated if they are stale.
+  const AddressIndex& address_index(uint32_t kinds) const;
+
+  //! Flag the address index as stale. Must be called when sections or segments
+  //! are added, removed or moved without going through their setters
+  void invalidate_address_index();
+
   template<class T>
   LIEF_LOCAL void patch_relocation(Relocation& relocation, uint64_t from, uint64_t shift);
 
@@ -527,6 +544,17 @@ class LIEF_API Binary : public LIEF::Binary  {
   // offset_to_virtual_address
   std::map<uint64_t, SegmentCommand*> offset_seg_;
 
+  // Staleness of the indexes below
+  std::unique_ptr<IndexTracker> index_tracker_;
+
+  // This is used to improve performances of
+  // get_symbol / has_symbol
+  std::unique_ptr<SymbolsIndex<Symbol>> symbols_index_;
+
+  // This is used to improve performances of
+  // section_from_virtual_address / segment_from_virtual_address
+  std::unique_ptr<AddressIndex> address_index_;
+
 
   protected:
   uint64_t fat_offset_ = 0;
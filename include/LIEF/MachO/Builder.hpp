@@ -20,6 +20,7 @@
 #include <vector>
 #include <vector>
 #include <memory>
+#include <iosfwd>
 #include <functional>
 #include <unordered_map>
 
@@ -70,15 +71,13 @@ class LIEF_API Builder {
   const std::vector<uint8_t>& get_build();
   void write(const std::string& filename) const;
 
+  //! Write the build result into the given stream (without intermediate copy)
+  void write(std::ostream& os) const;
+
   private:
   template<typename T>
   void build();
 
-  template<typename T, typename HANDLER>
-  std::vector<std::string> optimize(const HANDLER& e,
-                                    std::function<std::string(const typename HANDLER::value_type)> getter,
-                                    std::unordered_map<std::string, size_t> *of_map_p=nullptr);
-
   void build_fat();
   void build_fat_header();
   void build_header();
@@ -44,6 +44,11 @@ struct LIEF_API ParserConfig {
   bool parse_dyld_exports  = true;
   bool parse_dyld_bindings = true;
   bool parse_dyld_rebases  = true;
+
+  //! Parse the architectures of a FAT binary concurrently (one thread per
+  //! architecture). The slices are read in-place from the input and the
+  //! binaries are returned in the same order as the sequential parsing.
+  bool parallel_fat = false;
 };
 
 }
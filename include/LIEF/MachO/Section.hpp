@@ -29,11 +29,14 @@
 #include "LIEF/MachO/type_traits.hpp"
 
 namespace LIEF {
+class IndexTracker;
+
 namespace MachO {
 
 class BinaryParser;
 class SegmentCommand;
 class Binary;
+class AddressIndex;
 
 struct section_32;
 struct section_64;
@@ -43,6 +46,7 @@ class LIEF_API Section : public LIEF::Section {
   friend class BinaryParser;
   friend class Binary;
   friend class SegmentCommand;
+  friend class AddressIndex;
 
   public:
   using content_t   = std::vector<uint8_t>;
@@ -68,9 +72,20 @@ class LIEF_API Section : public LIEF::Section {
   // ============================
   virtual content_t content() const override;
 
+  virtual content_view_t content_view(std::vector<uint8_t>& buffer) const override;
+
   //! @brief Set section content
   virtual void content(const content_t& data) override;
 
+  virtual uint64_t size() const override;
+  virtual void size(uint64_t size) override;
+
+  virtual uint64_t offset() const override;
+  virtual void offset(uint64_t offset) override;
+
+  virtual uint64_t virtual_address() const override;
+  virtual void virtual_address(uint64_t virtual_address) override;
+
   //! @brief Return the name of the segment holding this section
   const std::string& segment_name() const;
 
@@ -142,6 +157,7 @@ class LIEF_API Section : public LIEF::Section {
   //! @brief Pointer to the segment holding this section.
   SegmentCommand *segment_{nullptr};
   relocations_t relocations_;
+  IndexTracker* index_tracker_{nullptr};
 };
 
 }
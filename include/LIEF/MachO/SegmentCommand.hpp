@@ -28,11 +28,14 @@
 
 
 namespace LIEF {
+class IndexTracker;
+
 namespace MachO {
 
 class BinaryParser;
 class Binary;
 class Section;
+class AddressIndex;
 
 struct segment_command_32;
 struct segment_command_64;
@@ -43,6 +46,7 @@ class LIEF_API SegmentCommand : public LoadCommand {
 
   friend class BinaryParser;
   friend class Binary;
+  friend class AddressIndex;
 
   public:
   using content_t = std::vector<uint8_t>;
@@ -81,6 +85,15 @@ class LIEF_API SegmentCommand : public LoadCommand {
 
   const content_t& content() const;
 
+  //! Entropy of the segment's content
+  double entropy() const;
+
+  //! Entropy of the windows of ``window`` bytes that start every ``stride`` bytes
+  //! of the segment's content
+  //!
+  //! @see LIEF::entropy_profile
+  std::vector<double> entropy_profile(size_t window, size_t stride) const;
+
   inline int8_t index() const {
     return this->index_;
   }
@@ -130,6 +143,7 @@ class LIEF_API SegmentCommand : public LoadCommand {
   content_t data_;
   sections_t    sections_;
   relocations_t relocations_;
+  IndexTracker* index_tracker_{nullptr};
 
 
 };
@@ -69,6 +69,7 @@
 #include "LIEF/PE/signature/Signature.hpp"
 #include "LIEF/PE/signature/SignerInfo.hpp"
 #include "LIEF/PE/signature/types.hpp"
+#include "LIEF/PE/signature/VerificationCache.hpp"
 #include "LIEF/PE/signature/x509.hpp"
 
 #include "LIEF/PE/hash.hpp"
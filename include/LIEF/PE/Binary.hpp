@@ -17,6 +17,7 @@
 #define LIEF_PE_BINARY_H_
 
 #include <map>
+#include <memory>
 
 #include "LIEF/PE/Header.hpp"
 #include "LIEF/PE/OptionalHeader.hpp"
@@ -34,9 +35,13 @@
 #include "LIEF/visibility.h"
 
 namespace LIEF {
+class IndexTracker;
+
 namespace PE {
 class Parser;
 class Builder;
+class SectionsIndex;
+class VerificationCache;
 
 //! Class which represent a PE binary object
 class LIEF_API Binary : public LIEF::Binary {
@@ -163,6 +168,12 @@ class LIEF_API Binary : public LIEF::Binary {
   Signature::VERIFICATION_FLAGS verify_signature(
       Signature::VERIFICATION_CHECKS checks = Signature::VERIFICATION_CHECKS::DEFAULT) const;
 
+  //! Same as verify_signature(Signature::VERIFICATION_CHECKS) but the public keys of the
+  //! signers are memoized in ``cache``, which can be shared across the signatures
+  //! and the binaries
+  Signature::VERIFICATION_FLAGS verify_signature(Signature::VERIFICATION_CHECKS checks,
+                                                 VerificationCache& cache) const;
+
   //! Verify the binary with the Signature object provided in the first parameter
   //! It can be used to verify a detached signature:
   //!
@@ -175,10 +186,26 @@ class LIEF_API Binary : public LIEF::Binary {
   Signature::VERIFICATION_FLAGS verify_signature(const Signature& sig,
       Signature::VERIFICATION_CHECKS checks = Signature::VERIFICATION_CHECKS::DEFAULT) const;
 
+  //! Same as verify_signature(const Signature&, Signature::VERIFICATION_CHECKS) with
+  //! a VerificationCache
+  Signature::VERIFICATION_FLAGS verify_signature(const Signature& sig, Signature::VERIFICATION_CHECKS checks,
+                                                 VerificationCache& cache) const;
+
   //! Compute the authentihash according to the algorithm provided in the first
   //! parameter
   std::vector<uint8_t> authentihash(ALGORITHMS algo) const;
 
+  //! Compute the authentihash for each algorithm of the given list in a
+  //! **single pass** over the binary.
+  //!
+  //! The returned digests are in the same order as ``algos`` (an empty digest
+  //! is returned for an unsupported algorithm):
+  //!
+  //! \code{.cpp}
+  //! auto hashes = pe->authentihash({ALGORITHMS::MD5, ALGORITHMS::SHA_1, ALGORITHMS::SHA_256});
+  //! \endcode
+  std::vector<std::vector<uint8_t>> authentihash(const std::vector<ALGORITHMS>& algos) const;
+
   //! Try to predict the RVA of the function `function` in the import library `library`
   //!
   //! @warning
@@ -425,6 +452,11 @@ class LIEF_API Binary : public LIEF::Binary {
   private:
   Binary();
 
+  Signature::VERIFICATION_FLAGS verify_signature(Signature::VERIFICATION_CHECKS checks,
+                                                 VerificationCache* cache) const;
+  Signature::VERIFICATION_FLAGS verify_signature(const Signature& sig, Signature::VERIFICATION_CHECKS checks,
+                                                 VerificationCache* cache) const;
+
   //! Make space between the last section header and the beginning of the
   //! content of first section
   void make_space_for_new_section();
@@ -446,6 +478,13 @@ class LIEF_API Binary : public LIEF::Binary {
   void update_lookup_address_table_offset();
   void update_iat();
 
+  //! Return the sorted index of the sections used to translate RVAs and offsets.
+  //! It is updated if the layout changed since the last call.
+  const SectionsIndex& sections_index() const;
+
+  //! Flag the sections index as stale. Must be called when a section is added or removed
+  void invalidate_sections_index();
+
   PE_TYPE        type_;
   DosHeader      dos_header_;
   RichHeader     rich_header_;
@@ -483,6 +522,9 @@ class LIEF_API Binary : public LIEF::Binary {
 
   LoadConfiguration*   load_configuration_{nullptr};
 
+  std::unique_ptr<IndexTracker>  index_tracker_;
+  std::unique_ptr<SectionsIndex> sections_index_;
+
   std::map<std::string, std::map<std::string, uint64_t>> hooks_;
 };
 
@@ -92,6 +92,9 @@ class LIEF_API Builder {
     //! @brief Write the build result into the ``output`` file
     void write(const std::string& filename) const;
 
+    //! Write the build result into the given stream (without intermediate copy)
+    void write(std::ostream& os) const;
+
     LIEF_API friend std::ostream& operator<<(std::ostream& os, const Builder& b);
 
     Builder& operator<<(const DosHeader& dos_header);
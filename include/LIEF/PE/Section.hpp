@@ -25,11 +25,14 @@
 #include "LIEF/PE/enums.hpp"
 
 namespace LIEF {
+class IndexTracker;
+
 namespace PE {
 
 class Parser;
 class Builder;
 class Binary;
+class SectionsIndex;
 struct pe_section;
 
 class LIEF_API Section : public LIEF::Section {
@@ -37,9 +40,13 @@ class LIEF_API Section : public LIEF::Section {
   friend class Parser;
   friend class Builder;
   friend class Binary;
+  friend class SectionsIndex;
 
   public:
   using LIEF::Section::name;
+  using LIEF::Section::size;
+  using LIEF::Section::offset;
+  using LIEF::Section::virtual_address;
 
   Section(const pe_section* header);
   Section();
@@ -59,6 +66,8 @@ class LIEF_API Section : public LIEF::Section {
   // ============================
   virtual std::vector<uint8_t> content() const override;
 
+  virtual content_view_t content_view(std::vector<uint8_t>& buffer) const override;
+
   //! Content of the section's padding
   inline const std::vector<uint8_t>& padding() const {
     return this->padding_;
@@ -85,6 +94,9 @@ class LIEF_API Section : public LIEF::Section {
 
   virtual void name(const std::string& name) override;
   virtual void content(const std::vector<uint8_t>& data) override;
+  virtual void size(uint64_t size) override;
+  virtual void offset(uint64_t offset) override;
+  virtual void virtual_address(uint64_t virtual_address) override;
   void virtual_size(uint32_t virtualSize);
   void pointerto_raw_data(uint32_t pointerToRawData);
   void pointerto_relocation(uint32_t pointerToRelocation);
@@ -118,6 +130,7 @@ class LIEF_API Section : public LIEF::Section {
   uint16_t number_of_linenumbers_  = 0;
   uint32_t characteristics_        = 0;
   std::set<PE_SECTION_TYPES> types_ = {PE_SECTION_TYPES::UNKNOWN};
+  IndexTracker* index_tracker_ = nullptr;
 };
 
 } // namespace PE
@@ -32,6 +32,7 @@ namespace PE {
 
 class SignatureParser;
 class Binary;
+class VerificationCache;
 
 //! Main interface for the PKCS #7 signature scheme
 class LIEF_API Signature : public Object {
@@ -139,6 +140,9 @@ class LIEF_API Signature : public Object {
   //! See: LIEF::PE::Signature::VERIFICATION_CHECKS to tweak the behavior
   VERIFICATION_FLAGS check(VERIFICATION_CHECKS checks = VERIFICATION_CHECKS::DEFAULT) const;
 
+  //! Same as check(VERIFICATION_CHECKS) but the public keys of the signers are memoized in ``cache``
+  VERIFICATION_FLAGS check(VERIFICATION_CHECKS checks, VerificationCache& cache) const;
+
   virtual void accept(Visitor& visitor) const override;
 
   virtual ~Signature();
@@ -146,6 +150,8 @@ class LIEF_API Signature : public Object {
   LIEF_API friend std::ostream& operator<<(std::ostream& os, const Signature& signature);
 
   private:
+  VERIFICATION_FLAGS check(VERIFICATION_CHECKS checks, VerificationCache* cache) const;
+
   uint32_t                version_ = 0;
   ALGORITHMS              digest_algorithm_ = ALGORITHMS::UNKNOWN;
   ContentInfo             content_info_;
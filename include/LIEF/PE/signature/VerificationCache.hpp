@@ -0,0 +1,123 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_PE_SIGNATURE_VERIFICATION_CACHE_H_
+#define LIEF_PE_SIGNATURE_VERIFICATION_CACHE_H_
+#include <vector>
+#include <list>
+#include <string>
+#include <mutex>
+#include <memory>
+#include <unordered_map>
+#include <ostream>
+
+#include "LIEF/types.hpp"
+#include "LIEF/visibility.h"
+
+#include "LIEF/PE/enums.hpp"
+#include "LIEF/PE/signature/x509.hpp"
+
+namespace LIEF {
+namespace PE {
+
+//! Thread-safe cache for the x509 verifications
+//!
+//! A small set of certificates signs most of the binaries of a corpus. This cache
+//! memoizes what can be reused from one binary to another:
+//!
+//! * The chain validations (x509::is_trusted_by, x509::verify) keyed by the
+//!   fingerprint of the certificate and the fingerprints of the CA set.
+//! * The public keys of the signers keyed by the fingerprint of their certificate.
+//!   The signature checks (x509::check_signature) themselves are not cached as
+//!   their hash is unique to each signed file.
+//!
+//! The same cache can be shared by several threads and given to
+//! Signature::check or Binary::verify_signature.
+//!
+//! @warning mbedtls checks the validity period of the certificates against the
+//!          current time. A long-running process should VerificationCache::clear
+//!          the cache periodically.
+class LIEF_API VerificationCache {
+  public:
+  static constexpr size_t DEFAULT_MAX_ENTRIES = 4096;
+
+  //! Hit/miss statistics of the cache
+  struct stats_t {
+    size_t hits      = 0; ///< Number of validations and signer keys served from the cache
+    size_t misses    = 0; ///< Number of validations computed and signer keys parsed
+    size_t evictions = 0; ///< Number of entries evicted to honor max_entries
+    size_t entries   = 0; ///< Number of validations and signer keys currently cached
+  };
+
+  //! @param[in] max_entries Maximum number of chain validations and of signer
+  //!                        keys kept in the cache (0 for no limit). The least
+  //!                        recently used validations are evicted first.
+  VerificationCache(size_t max_entries = DEFAULT_MAX_ENTRIES);
+
+  VerificationCache(const VerificationCache&) = delete;
+  VerificationCache& operator=(const VerificationCache&) = delete;
+
+  //! Cached version of x509::is_trusted_by
+  x509::VERIFICATION_FLAGS is_trusted_by(const x509& cert, const std::vector<x509>& ca);
+
+  //! Cached version of x509::verify: check that ``ca`` has been used
+  //! **to trust** ``child``
+  x509::VERIFICATION_FLAGS verify(const x509& ca, const x509& child);
+
+  //! x509::check_signature with the memoized public key of ``cert``
+  //!
+  //! The key is parsed once per certificate and keeps the values that mbedtls
+  //! precomputes on the first RSA operation. The result is not cached.
+  bool check_signature(const x509& cert, const std::vector<uint8_t>& hash,
+                       const std::vector<uint8_t>& signature, ALGORITHMS digest);
+
+  //! Current statistics
+  stats_t stats() const;
+
+  //! Reset the hits/misses/evictions counters
+  void reset_stats();
+
+  //! Drop all the cached results
+  void clear();
+
+  //! Maximum number of chain validations and of signer keys kept in the cache
+  //! (0 for no limit)
+  size_t max_entries() const;
+
+  ~VerificationCache();
+
+  private:
+  using key_t   = std::string;
+  using entry_t = std::pair<key_t, uint32_t>;
+
+  bool lookup(const key_t& key, uint32_t& value);
+  void insert(key_t key, uint32_t value);
+
+  std::shared_ptr<const x509> signer(const x509& cert);
+
+  mutable std::mutex lock_;
+  size_t max_entries_ = DEFAULT_MAX_ENTRIES;
+  std::list<entry_t> lru_;
+  std::unordered_map<key_t, std::list<entry_t>::iterator> entries_;
+  std::unordered_map<key_t, std::shared_ptr<const x509>> signers_;
+  stats_t stats_;
+};
+
+LIEF_API std::ostream& operator<<(std::ostream& os, const VerificationCache::stats_t& stats);
+
+}
+}
+
+#endif
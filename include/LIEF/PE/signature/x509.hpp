@@ -44,6 +44,7 @@ class LIEF_API x509 : public Object {
   friend class Parser;
   friend class SignatureParser;
   friend class Signature;
+  friend class VerificationCache;
 
   public:
   //! Tuple (Year, Month, Day, Hour, Minute, Second)
@@ -150,6 +151,9 @@ class LIEF_API x509 : public Object {
   //! The raw x509 bytes (DER encoded)
   std::vector<uint8_t> raw() const;
 
+  //! SHA-256 of the DER encoded certificate
+  const std::vector<uint8_t>& fingerprint() const;
+
   //! Return the underlying public-key scheme
   KEY_TYPES key_type() const;
 
@@ -186,6 +190,7 @@ class LIEF_API x509 : public Object {
   private:
   x509();
   mbedtls_x509_crt* x509_cert_ = nullptr;
+  std::vector<uint8_t> fingerprint_;
 
 };
 
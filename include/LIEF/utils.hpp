@@ -78,6 +78,19 @@ LIEF_API bool is_printable(const std::string& str);
 
 //! Check if the given number is a hex-like string
 LIEF_API bool is_hex_number(const std::string& nb);
+
+//! Shannon entropy of the given bytes (between 0 and 8 bits per byte)
+LIEF_API double entropy(const uint8_t* data, size_t size);
+LIEF_API double entropy(const std::vector<uint8_t>& data);
+
+//! Entropy of the windows of ``window`` bytes that start every ``stride`` bytes.
+//! Only the complete windows are considered, unless the data is smaller than
+//! ``window`` in which case the entropy of the whole data is returned.
+//!
+//! Overlapping windows (``stride < window``) are computed in a single pass
+//! by updating the histogram with the bytes that leave and enter the window.
+LIEF_API std::vector<double> entropy_profile(const uint8_t* data, size_t size, size_t window, size_t stride);
+LIEF_API std::vector<double> entropy_profile(const std::vector<uint8_t>& data, size_t window, size_t stride);
 }
 
 namespace LIEF {
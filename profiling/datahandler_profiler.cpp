@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <LIEF/ELF/DataHandler/Handler.hpp>
+
+using namespace LIEF::ELF::DataHandler;
+
+// Layout of an object with one section per function (-ffunction-sections)
+static constexpr uint64_t SECTION_SIZE = 0x40;
+static constexpr uint64_t SHIFT        = 0x1000;
+
+// Keep the lookups from being optimized out
+static volatile uintptr_t sink = 0;
+
+// Previous implementation of the handler's nodes: a vector scanned with find_if
+struct LegacyNode {
+  uint64_t offset;
+  uint64_t size;
+  Node::Type type;
+};
+
+class LegacyHandler {
+  public:
+  LegacyHandler(const std::vector<uint8_t>& content) :
+    content_{content}
+  {}
+
+  ~LegacyHandler() {
+    for (LegacyNode* node : this->nodes_) {
+      delete node;
+    }
+  }
+
+  LegacyNode& create(uint64_t offset, uint64_t size, Node::Type type) {
+    this->nodes_.push_back(new LegacyNode{offset, size, type});
+    return *this->nodes_.back();
+  }
+
+  LegacyNode& get(uint64_t offset, uint64_t size, Node::Type type) {
+    auto it = std::find_if(std::begin(this->nodes_), std::end(this->nodes_),
+        [offset, size, type] (const LegacyNode* node) {
+          return node->offset == offset and node->size == size and node->type == type;
+        });
+    return **it;
+  }
+
+  private:
+  std::vector<uint8_t> content_;
+  std::vector<LegacyNode*> nodes_;
+};
+
+template<class F>
+static double measure(F&& f) {
+  const auto start = std::chrono::steady_clock::now();
+  f();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Mimic the parser (create), Section::content() (get) and
+// Binary::shift_sections (move) on ``nb_sections`` sections
+template<class H, class MOVE>
+static void run(const std::string& name, size_t nb_sections, MOVE&& move_node) {
+  H handler{std::vector<uint8_t>(nb_sections * SECTION_SIZE)};
+  const double create = measure([&] {
+    for (size_t i = 0; i < nb_sections; ++i) {
+      handler.create(i * SECTION_SIZE, SECTION_SIZE, Node::SECTION);
+    }
+  });
+
+  const double get = measure([&] {
+    for (size_t i = 0; i < nb_sections; ++i) {
+      sink = sink + reinterpret_cast<uintptr_t>(&handler.get(i * SECTION_SIZE, SECTION_SIZE, Node::SECTION));
+    }
+  });
+
+  // Shift the second half of the sections (in reverse order, as
+  // Binary::shift_sections does, to avoid transient collisions)
+  const double shift = measure([&] {
+    for (size_t i = nb_sections; i > nb_sections / 2; --i) {
+      const uint64_t offset = (i - 1) * SECTION_SIZE;
+      move_node(handler, handler.get(offset, SECTION_SIZE, Node::SECTION), offset + SHIFT);
+    }
+  });
+
+  std::cout << name << ": create " << create << " ms, "
+            << "get " << get << " ms, "
+            << "shift " << shift << " ms" << std::endl;
+}
+
+int main(int argc, char** argv) {
+  const size_t nb_sections = argc > 1 ? std::stoul(argv[1]) : 0x10000;
+  std::cout << nb_sections << " sections" << std::endl;
+
+  run<Handler>("Handler", nb_sections,
+      [] (Handler& handler, Node& node, uint64_t offset) {
+        handler.move(node, offset);
+      });
+
+  run<LegacyHandler>("Legacy ", nb_sections,
+      [] (LegacyHandler&, LegacyNode& node, uint64_t offset) {
+        node.offset = offset;
+      });
+
+  // Overlap queries used by the segments to find their sections
+  Handler handler{std::vector<uint8_t>(nb_sections * SECTION_SIZE)};
+  for (size_t i = 0; i < nb_sections; ++i) {
+    handler.create(i * SECTION_SIZE, SECTION_SIZE, Node::SECTION);
+  }
+  size_t nb_found = 0;
+  const double overlap = measure([&] {
+    for (size_t i = 0; i < nb_sections; ++i) {
+      nb_found += handler.overlapping(i * SECTION_SIZE, 2 * SECTION_SIZE, Node::SECTION).size();
+    }
+  });
+  std::cout << "Handler: overlapping " << overlap << " ms (" << nb_found << " nodes)" << std::endl;
+  return 0;
+}
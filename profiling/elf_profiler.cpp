@@ -1,6 +1,49 @@
 #include <LIEF/LIEF.hpp>
 
+#include <chrono>
+
+static double parse(const std::string& path, const LIEF::ELF::ParserConfig& config, size_t nb_runs) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < nb_runs; ++i) {
+    std::unique_ptr<LIEF::ELF::Binary> binary{LIEF::ELF::Parser::parse(path, config)};
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count() / nb_runs;
+}
+
+static double build(const std::string& path, size_t nb_threads, size_t nb_runs) {
+  double total = 0;
+  for (size_t i = 0; i < nb_runs; ++i) {
+    std::unique_ptr<LIEF::ELF::Binary> binary{LIEF::ELF::Parser::parse(path)};
+    // Flag the static tables as modified so that they are rebuilt
+    binary->static_symbols();
+    binary->object_relocations();
+    binary->notes();
+
+    const auto start = std::chrono::steady_clock::now();
+    LIEF::ELF::Builder builder{binary.get()};
+    builder.threads(nb_threads);
+    builder.build();
+    const auto end = std::chrono::steady_clock::now();
+    total += std::chrono::duration<double, std::milli>(end - start).count();
+  }
+  return total / nb_runs;
+}
+
 int main(int argc, char** argv) {
-  std::unique_ptr<LIEF::ELF::Binary> binary{LIEF::ELF::Parser::parse("/usr/bin/ls")};
+  const std::string path = argc > 1 ? argv[1] : "/usr/bin/ls";
+  const size_t nb_runs = argc > 2 ? std::stoul(argv[2]) : 10;
+
+  const double all   = parse(path, LIEF::ELF::ParserConfig::all(),   nb_runs);
+  const double quick = parse(path, LIEF::ELF::ParserConfig::quick(), nb_runs);
+
+  std::cout << "All:   " << all   << " ms" << std::endl;
+  std::cout << "Quick: " << quick << " ms" << std::endl;
+
+  const double build_seq = build(path, 1, nb_runs);
+  const double build_par = build(path, 0, nb_runs);
+
+  std::cout << "Build (1 thread):    " << build_seq << " ms" << std::endl;
+  std::cout << "Build (all threads): " << build_par << " ms" << std::endl;
   return 0;
 }
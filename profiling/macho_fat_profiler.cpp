@@ -0,0 +1,34 @@
+#include <LIEF/LIEF.hpp>
+
+#include <chrono>
+
+static double parse(const std::string& path, const LIEF::MachO::ParserConfig& config, size_t nb_runs) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < nb_runs; ++i) {
+    std::unique_ptr<LIEF::MachO::FatBinary> fat{LIEF::MachO::Parser::parse(path, config)};
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count() / nb_runs;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <fat macho> [nb runs]" << std::endl;
+    return 1;
+  }
+  const std::string path = argv[1];
+  const size_t nb_runs = argc > 2 ? std::stoul(argv[2]) : 10;
+
+  LIEF::MachO::ParserConfig config = LIEF::MachO::ParserConfig::deep();
+
+  config.parallel_fat = false;
+  const double sequential = parse(path, config, nb_runs);
+
+  config.parallel_fat = true;
+  const double parallel = parse(path, config, nb_runs);
+
+  std::cout << "Sequential: " << sequential << " ms" << std::endl;
+  std::cout << "Parallel:   " << parallel   << " ms" << std::endl;
+  std::cout << "Speedup:    " << sequential / parallel << "x" << std::endl;
+  return 0;
+}
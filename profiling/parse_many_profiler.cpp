@@ -0,0 +1,66 @@
+#include <LIEF/LIEF.hpp>
+
+#include <ftw.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+static std::vector<std::string> FILES;
+
+static int add_file(const char* path, const struct stat* st, int flag, struct FTW*) {
+  if (flag == FTW_F and S_ISREG(st->st_mode) and st->st_size > 0) {
+    FILES.emplace_back(path);
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <directory> [max threads]" << std::endl;
+    return 1;
+  }
+
+  if (nftw(argv[1], add_file, 64, FTW_PHYS) != 0) {
+    std::cerr << "Can't walk " << argv[1] << std::endl;
+    return 1;
+  }
+
+  const size_t max_threads = argc > 2 ? std::stoul(argv[2]) :
+                                        std::max<size_t>(1, std::thread::hardware_concurrency());
+  LIEF::logging::disable();
+
+  std::cout << FILES.size() << " files" << std::endl;
+
+  std::vector<size_t> nb_threads;
+  for (size_t i = 1; i < max_threads; i *= 2) {
+    nb_threads.push_back(i);
+  }
+  nb_threads.push_back(max_threads);
+
+  for (size_t threads : nb_threads) {
+    size_t nb_parsed = 0;
+    std::chrono::nanoseconds parse_time{0};
+
+    LIEF::ParseManyOptions options;
+    options.threads = threads;
+
+    const auto start = std::chrono::steady_clock::now();
+    LIEF::parse_many(FILES,
+        [&nb_parsed, &parse_time] (LIEF::ParseResult& result) {
+          nb_parsed += result.ok() ? 1 : 0;
+          parse_time += result.duration;
+        }, options);
+    const auto end = std::chrono::steady_clock::now();
+
+    const double elapsed = std::chrono::duration<double>(end - start).count();
+    std::cout << threads << " thread(s): "
+              << FILES.size() / elapsed << " files/s "
+              << "(" << nb_parsed << " parsed, "
+              << elapsed << " s, "
+              << std::chrono::duration<double>(parse_time).count() << " s of parsing)" << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# Description
+# -----------
+# Measure the scaling of LIEF's Python API with threads: the parsers, the
+# builders and the Authenticode functions release the GIL so that
+# a ThreadPoolExecutor can use several cores.
+#
+# Usage: python_threads.py [directory] [--threads N] [--files N]
+
+import os
+import time
+import argparse
+from concurrent.futures import ThreadPoolExecutor
+
+import lief
+
+def collect(directory, limit):
+    files = []
+    for root, _, names in os.walk(directory):
+        for name in names:
+            path = os.path.join(root, name)
+            if not os.path.isfile(path) or os.path.islink(path):
+                continue
+            with open(path, "rb") as f:
+                magic = f.read(4)
+            if magic in (b"\x7fELF", b"\xcf\xfa\xed\xfe", b"\xce\xfa\xed\xfe", b"\xca\xfe\xba\xbe") or magic[:2] == b"MZ":
+                files.append(path)
+            if len(files) >= limit:
+                return files
+    return files
+
+def parse(path):
+    return lief.parse(path) is not None
+
+def build(path):
+    binary = lief.parse(path)
+    if not isinstance(binary, (lief.ELF.Binary, lief.PE.Binary)):
+        return False
+    builder = lief.ELF.Builder(binary) if isinstance(binary, lief.ELF.Binary) else lief.PE.Builder(binary)
+    builder.build()
+    return True
+
+def authentihash(path):
+    binary = lief.parse(path)
+    if not isinstance(binary, lief.PE.Binary):
+        return False
+    binary.authentihash(lief.PE.ALGORITHMS.SHA_256)
+    binary.verify_signature()
+    return True
+
+def run(task, files, nb_threads):
+    start = time.perf_counter()
+    with ThreadPoolExecutor(max_workers=nb_threads) as pool:
+        nb_done = sum(1 for ok in pool.map(task, files) if ok)
+    return nb_done, time.perf_counter() - start
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark the Python API with threads")
+    parser.add_argument("directory", nargs="?", default="/usr/bin")
+    parser.add_argument("--threads", type=int, default=os.cpu_count())
+    parser.add_argument("--files",   type=int, default=500)
+    args = parser.parse_args()
+
+    lief.logging.disable()
+    files = collect(args.directory, args.files)
+    print("{} files from {}".format(len(files), args.directory))
+
+    # Warm the page cache
+    run(parse, files, args.threads)
+
+    threads = []
+    nb_threads = 1
+    while nb_threads < args.threads:
+        threads.append(nb_threads)
+        nb_threads *= 2
+    threads.append(args.threads)
+
+    for task in (parse, build, authentihash):
+        reference = None
+        for nb_threads in threads:
+            nb_done, elapsed = run(task, files, nb_threads)
+            if nb_done == 0:
+                break
+            reference = reference or elapsed
+            print("{:<13} {:>3} thread(s): {:>8.1f} files/s (x{:.2f})".format(
+                  task.__name__, nb_threads, nb_done / elapsed, reference / elapsed))
+
+    results = []
+    start = time.perf_counter()
+    lief.parse_many(files, lambda idx, path, binary, error, duration: results.append(binary is not None),
+                    threads=args.threads)
+    elapsed = time.perf_counter() - start
+    print("{:<13} {:>3} thread(s): {:>8.1f} files/s".format("parse_many", args.threads, sum(results) / elapsed))
+
+if __name__ == "__main__":
+    main()
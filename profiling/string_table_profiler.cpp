@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#include "string_table.hpp"
+
+// Synthetic C++ mangled names: _ZN<len><id>...E<params>
+static std::vector<std::string> mangled_names(size_t nb_names) {
+  static const char* IDS[] = {
+    "llvm", "clang", "std", "detail", "impl", "Value", "Module", "Function", "Instruction",
+    "BasicBlock", "Type", "APInt", "SmallVector", "DenseMap", "StringRef", "Twine", "raw_ostream",
+    "getName", "setName", "print", "dump", "create", "operator", "visit", "insert", "erase",
+  };
+  static const char* PARAMS[] = {
+    "v", "i", "j", "b", "PKc", "RKS_", "RKS0_", "S1_", "PS_", "NS_9StringRefE", "mm", "Ev",
+  };
+  std::mt19937 rng{0};
+  std::vector<std::string> names;
+  names.reserve(nb_names);
+  for (size_t i = 0; i < nb_names; ++i) {
+    std::string name = "_ZN";
+    const size_t depth = 2 + rng() % 4;
+    for (size_t d = 0; d < depth; ++d) {
+      std::string id = IDS[rng() % (sizeof(IDS) / sizeof(IDS[0]))];
+      if (d == depth - 1) {
+        id += std::to_string(rng() % 5000);
+      }
+      name += std::to_string(id.size()) + id;
+    }
+    name += "E";
+    const size_t nb_params = rng() % 4;
+    for (size_t p = 0; p < nb_params; ++p) {
+      name += PARAMS[rng() % (sizeof(PARAMS) / sizeof(PARAMS[0]))];
+    }
+    names.push_back(std::move(name));
+  }
+  return names;
+}
+
+// Previous implementation of ELF::Builder::optimize / MachO::Builder::optimize
+static size_t legacy(const std::vector<std::string>& names) {
+  std::set<std::string> string_table{std::begin(names), std::end(names)};
+  std::vector<std::string> string_table_optimized;
+  string_table_optimized.reserve(names.size());
+  for (auto &val: string_table) {
+    string_table_optimized.emplace_back(val);
+    std::reverse(std::begin(string_table_optimized.back()), std::end(string_table_optimized.back()));
+  }
+
+  std::sort(std::begin(string_table_optimized), std::end(string_table_optimized),
+      [] (const std::string& lhs, const std::string& rhs) {
+        if (lhs.size() > rhs.size()) {
+          return lhs.compare(0, rhs.size(), rhs) <= 0;
+        }
+        return rhs.compare(0, lhs.size(), lhs) > 0;
+      });
+
+  std::unordered_map<std::string, std::string> merged_map;
+  size_t to_set_idx = 0;
+  for (size_t cur_elm_idx = 1; cur_elm_idx < string_table_optimized.size(); ++cur_elm_idx) {
+    auto &cur_elm = string_table_optimized[cur_elm_idx];
+    auto &to_set_elm = string_table_optimized[to_set_idx];
+    if (to_set_elm.size() >= cur_elm.size() and to_set_elm.compare(0, cur_elm.size(), cur_elm) == 0) {
+      std::string rev_cur_elm{cur_elm.rbegin(), cur_elm.rend()};
+      std::string rev_to_set_elm{to_set_elm.rbegin(), to_set_elm.rend()};
+      merged_map[rev_cur_elm] = rev_to_set_elm;
+      continue;
+    }
+    ++to_set_idx;
+    std::swap(string_table_optimized[to_set_idx], cur_elm);
+  }
+  string_table_optimized.resize(to_set_idx + 1);
+  for (auto &val: string_table_optimized) {
+    std::reverse(std::begin(val), std::end(val));
+  }
+  std::sort(std::begin(string_table_optimized), std::end(string_table_optimized));
+
+  std::unordered_map<std::string, size_t> offset_map;
+  size_t offset_counter = 1;
+  for (const auto &v : string_table_optimized) {
+    offset_map[v] = offset_counter;
+    offset_counter += v.size() + 1;
+  }
+  for (const auto &kv : merged_map) {
+    offset_map[kv.first] = offset_map[kv.second] + (kv.second.size() - kv.first.size());
+  }
+  return offset_counter;
+}
+
+static size_t engine(const std::vector<std::string>& names) {
+  LIEF::StringTableBuilder table;
+  table.reserve(names.size());
+  for (const std::string& name : names) {
+    table.add(name);
+  }
+  table.build();
+  return table.raw().size();
+}
+
+// Peak resident memory of the process in MB
+static double peak_memory() {
+#if defined(_WIN32)
+  return 0;
+#else
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+  return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+  return usage.ru_maxrss / 1024.0;
+#endif
+#endif
+}
+
+int main(int argc, char** argv) {
+  // The peak memory is the one of the process: run one implementation per process
+  const std::string mode = argc > 1 ? argv[1] : "engine";
+  const size_t nb_names  = argc > 2 ? std::stoul(argv[2]) : 1000000;
+  if (mode != "engine" and mode != "legacy") {
+    std::cerr << "Usage: " << argv[0] << " [engine|legacy] [nb names]" << std::endl;
+    return 1;
+  }
+
+  const std::vector<std::string> names = mangled_names(nb_names);
+  const double names_memory = peak_memory();
+
+  const auto start = std::chrono::steady_clock::now();
+  const size_t size = mode == "engine" ? engine(names) : legacy(names);
+  const auto end = std::chrono::steady_clock::now();
+
+  std::cout << mode << ": " << nb_names << " names" << std::endl;
+  std::cout << "Table size:  " << size << " bytes" << std::endl;
+  std::cout << "Time:        " << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+  std::cout << "Peak memory: " << peak_memory() - names_memory << " MB (names: " << names_memory << " MB)" << std::endl;
+  return 0;
+}
@@ -29,6 +29,8 @@
 #include "LIEF/MachO/Binary.hpp"
 #endif
 
+#include "search.hpp"
+
 namespace LIEF {
 Binary::Binary() :
   name_{""},
@@ -158,6 +160,47 @@ std::vector<uint64_t> Binary::xref(uint64_t address) const {
   return result;
 }
 
+std::vector<std::vector<uint64_t>> Binary::xrefs(const std::vector<uint64_t>& addresses) const {
+  std::vector<std::vector<uint8_t>> patterns;
+  patterns.reserve(addresses.size());
+  for (uint64_t address : addresses) {
+    patterns.push_back(integer_pattern(address, 0));
+  }
+
+  const PatternsSearch search{patterns};
+  std::vector<std::vector<uint64_t>> result(addresses.size());
+  std::vector<uint8_t> buffer;
+
+  for (Section* section : const_cast<Binary*>(this)->get_abstract_sections()) {
+    const Section::content_view_t content = section->content_view(buffer);
+    const uint64_t base = section->virtual_address();
+    search.search(content.data, content.size,
+        [&result, base] (uint32_t idx, size_t offset) {
+          result[idx].push_back(base + offset);
+        });
+  }
+  return result;
+}
+
+std::vector<StringEntry> Binary::extract_strings(size_t min_size, bool utf16) const {
+  std::vector<StringEntry> entries;
+  std::vector<uint8_t> buffer;
+
+  for (Section* section : const_cast<Binary*>(this)->get_abstract_sections()) {
+    const Section::content_view_t content = section->content_view(buffer);
+    std::vector<StringEntry> section_entries = LIEF::extract_strings(content.data, content.size, min_size, utf16);
+
+    const uint64_t offset = section->offset();
+    const uint64_t va     = section->virtual_address();
+    for (StringEntry& entry : section_entries) {
+      entry.virtual_address = va > 0 ? va + entry.offset : 0;
+      entry.offset += offset;
+    }
+    entries.insert(std::end(entries), std::begin(section_entries), std::end(section_entries));
+  }
+  return entries;
+}
+
 void Binary::accept(Visitor& visitor) const {
   visitor.visit(*this);
 }
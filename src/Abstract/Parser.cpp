@@ -15,8 +15,10 @@
  */
 
 #include <fstream>
+#include <mutex>
 
 #include "logging.hpp"
+#include "parallel.hpp"
 #include "LIEF/Abstract/Parser.hpp"
 
 #include "LIEF/OAT.hpp"
@@ -128,6 +130,22 @@ std::unique_ptr<Binary> Parser::parse(const std::vector<uint8_t>& raw, const std
 
 }
 
+std::unique_ptr<Binary> Parser::parse(const uint8_t* data, size_t size, const std::string& name) {
+#if defined(LIEF_ELF_SUPPORT)
+  if (ELF::is_elf(data, size)) {
+    std::unique_ptr<ELF::Binary> elf = ELF::Parser::parse(data, size, name);
+#if defined(LIEF_OAT_SUPPORT)
+    if (elf != nullptr and OAT::is_oat(*elf)) {
+      return OAT::Parser::parse(std::vector<uint8_t>(data, data + size), name);
+    }
+#endif
+    return std::unique_ptr<Binary>{elf.release()};
+  }
+#endif
+
+  return Parser::parse(std::vector<uint8_t>(data, data + size), name);
+}
+
 Parser::Parser(const std::string& filename) :
   binary_size_{0},
   binary_name_{filename}
@@ -144,4 +162,42 @@ Parser::Parser(const std::string& filename) :
   }
 }
 
+void parse_many(const std::vector<std::string>& paths,
+                const std::function<void(ParseResult&)>& callback,
+                const ParseManyOptions& options) {
+  std::mutex callback_lock;
+  std::atomic<bool> stop{false};
+
+  parallel_for_stealing(options.threads, paths.size(),
+      [&paths, &callback, &callback_lock, &stop] (size_t idx, size_t) {
+        if (stop) {
+          return;
+        }
+        ParseResult result;
+        result.index = idx;
+        result.path  = paths[idx];
+
+        const auto start = std::chrono::steady_clock::now();
+        try {
+          result.binary = Parser::parse(result.path);
+          if (result.binary == nullptr) {
+            result.error = "Unable to parse the file";
+          }
+        } catch (const std::exception& e) {
+          result.error = e.what();
+        } catch (...) {
+          result.error = "Unknown error";
+        }
+        result.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        std::lock_guard<std::mutex> guard{callback_lock};
+        try {
+          callback(result);
+        } catch (...) {
+          stop = true;
+          throw;
+        }
+      });
+}
+
 }
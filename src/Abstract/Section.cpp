@@ -21,9 +21,11 @@
 
 #include "LIEF/Abstract/hash.hpp"
 #include "LIEF/exception.hpp"
+#include "LIEF/utils.hpp"
 
 #include "LIEF/Abstract/Section.hpp"
 
+#include "search.hpp"
 #include "Section.tcc"
 
 namespace LIEF {
@@ -57,6 +59,11 @@ void Section::content(const std::vector<uint8_t>&) {
 }
 
 
+Section::content_view_t Section::content_view(std::vector<uint8_t>& buffer) const {
+  buffer = this->content();
+  return {buffer.data(), buffer.size()};
+}
+
 std::vector<uint8_t> Section::content() const {
   throw not_supported("Not supported by this format");
 }
@@ -92,51 +99,13 @@ void Section::offset(uint64_t offset) {
 // Search functions
 // ================
 size_t Section::search(uint64_t integer, size_t pos, size_t size) const {
-  if (size > sizeof(integer)) {
-    throw std::runtime_error("Invalid size (" + std::to_string(size) + ")");
-  }
-
-  size_t minimal_size = size;
-  if (size == 0) {
-    if (integer < std::numeric_limits<uint8_t>::max()) {
-      minimal_size = sizeof(uint8_t);
-    }
-    else if (integer < std::numeric_limits<uint16_t>::max()) {
-      minimal_size = sizeof(uint16_t);
-    }
-    else if (integer < std::numeric_limits<uint32_t>::max()) {
-      minimal_size = sizeof(uint32_t);
-    }
-    else if (integer < std::numeric_limits<uint64_t>::max()) {
-      minimal_size = sizeof(uint64_t);
-    } else {
-      throw exception("Unable to find an appropriated type of " + std::to_string(integer));
-    }
-  }
-
-  std::vector<uint8_t> pattern(minimal_size, 0);
-
-  std::copy(
-      reinterpret_cast<const uint8_t*>(&integer),
-      reinterpret_cast<const uint8_t*>(&integer) + minimal_size,
-      pattern.data());
-
-  return this->search(pattern, pos);
+  return this->search(integer_pattern(integer, size), pos);
 }
 
 size_t Section::search(const std::vector<uint8_t>& pattern, size_t pos) const {
-  std::vector<uint8_t> content = this->content();
-
-  auto&& it_found = std::search(
-      std::begin(content) + pos, std::end(content),
-      std::begin(pattern), std::end(pattern)
-      );
-
-  if (it_found == std::end(content)) {
-    return Section::npos;
-  }
-
-  return std::distance(std::begin(content), it_found);
+  std::vector<uint8_t> buffer;
+  const content_view_t content = this->content_view(buffer);
+  return find_pattern(content.data, content.size, pattern.data(), pattern.size(), pos);
 }
 
 size_t Section::search(const std::string& pattern, size_t pos) const {
@@ -151,19 +120,7 @@ size_t Section::search(uint64_t integer, size_t pos) const {
 // Search all functions
 // ====================
 std::vector<size_t> Section::search_all(uint64_t v, size_t size) const {
-  std::vector<size_t> result;
-  size_t pos = this->search(v, 0, size);
-
-  if (pos == Section::npos) {
-    return result;
-  }
-
-  do {
-    result.push_back(pos);
-    pos = this->search(v, pos + 1, size);
-  } while(pos != Section::npos);
-
-  return result;
+  return this->search_all_(integer_pattern(v, size));
 }
 
 std::vector<size_t> Section::search_all(uint64_t v) const {
@@ -174,22 +131,23 @@ std::vector<size_t> Section::search_all(const std::string& v) const {
   return this->search_all_<std::string>(v);
 }
 
+std::vector<std::vector<size_t>> Section::search_patterns(const std::vector<std::vector<uint8_t>>& patterns) const {
+  std::vector<uint8_t> buffer;
+  const content_view_t content = this->content_view(buffer);
+  return PatternsSearch{patterns}.search_all(content.data, content.size);
+}
+
 
 double Section::entropy() const {
-  std::array<uint64_t, 256> frequencies = { {0} };
-  const std::vector<uint8_t>& content = this->content();
-  for (uint8_t x : content) {
-    frequencies[x]++;
-  }
-
-  double entropy = 0.0;
-  for (uint64_t p : frequencies) {
-    if (p > 0) {
-      double freq = static_cast<double>(p) / static_cast<double>(content.size());
-      entropy += freq * std::log2l(freq) ;
-    }
-  }
-  return (-entropy);
+  std::vector<uint8_t> buffer;
+  const content_view_t content = this->content_view(buffer);
+  return LIEF::entropy(content.data, content.size);
+}
+
+std::vector<double> Section::entropy_profile(size_t window, size_t stride) const {
+  std::vector<uint8_t> buffer;
+  const content_view_t content = this->content_view(buffer);
+  return LIEF::entropy_profile(content.data, content.size, window, stride);
 }
 
 
@@ -19,19 +19,10 @@ namespace LIEF {
 
 template<typename T>
 std::vector<size_t> Section::search_all_(const T& v) const {
-  std::vector<size_t> result;
-  size_t pos = this->search(v, 0);
-
-  if (pos == Section::npos) {
-    return result;
-  }
-
-  do {
-    result.push_back(pos);
-    pos = this->search(v, pos + 1);
-  } while(pos != Section::npos);
-
-  return result;
+  std::vector<uint8_t> buffer;
+  const content_view_t content = this->content_view(buffer);
+  return find_all_pattern(content.data, content.size,
+                          reinterpret_cast<const uint8_t*>(v.data()), v.size());
 }
 
 }
@@ -0,0 +1,185 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+
+#include "LIEF/Abstract/StringEntry.hpp"
+
+namespace LIEF {
+
+// The characters are tested a word (8 bytes) at a time with SWAR operations
+// See: http://graphics.stanford.edu/~seander/bithacks.html#HasBetweenInWord
+static constexpr uint64_t ONES  = 0x0101010101010101llu;
+static constexpr uint64_t LOWS  = 0x7F7F7F7F7F7F7F7Fllu;
+static constexpr uint64_t HIGHS = 0x8080808080808080llu;
+
+static constexpr uint64_t LANES16  = 0x0001000100010001llu;
+static constexpr uint64_t HIGHS16  = 0x8000800080008000llu;
+static constexpr uint64_t BYTES16  = 0x00FF00FF00FF00FFllu;
+
+static inline bool is_printable(uint8_t c) {
+  return (c >= 0x20 and c <= 0x7E) or c == '\t';
+}
+
+static inline uint64_t load(const uint8_t* data) {
+  uint64_t v;
+  std::memcpy(&v, data, sizeof(v));
+  return v;
+}
+
+// Whether the 8 bytes of ``v`` are in [0x20, 0x7E]
+static inline bool all_printable(uint64_t v) {
+  const uint64_t has_less = (v - ONES * 0x20) & ~v & HIGHS;
+  const uint64_t has_more = ((v + ONES * (127 - 0x7E)) | v) & HIGHS;
+  return (has_less | has_more) == 0;
+}
+
+// Whether one of the 8 bytes of ``v`` is printable
+static inline bool any_printable(uint64_t v) {
+  const uint64_t low = v & LOWS;
+  const uint64_t in_range = ((ONES * (127 + 0x7F) - low) & ~v & (low + ONES * (127 - 0x1F))) & HIGHS;
+  const uint64_t tabs = v ^ (ONES * '\t');
+  const uint64_t has_tab = (tabs - ONES) & ~tabs & HIGHS;
+  return (in_range | has_tab) != 0;
+}
+
+// Set the highest bit of the 16-bit lanes of ``v`` which hold a UTF-16LE
+// printable character (null high byte and printable low byte)
+static inline uint64_t utf16_chars(uint64_t v) {
+  // The lanes are in [0, 0xFF] so that the additions don't overflow
+  const uint64_t high = (v >> 8) & BYTES16;
+  const uint64_t low  =  v       & BYTES16;
+  const uint64_t tabs = low ^ (LANES16 * '\t');
+
+  const uint64_t null_high = ~(high + LANES16 * 0x7FFF);
+  const uint64_t ge_space  =   low  + LANES16 * (0x8000 - 0x20);
+  const uint64_t le_tilde  = ~(low  + LANES16 * (0x8000 - 0x7F));
+  const uint64_t is_tab    = ~(tabs + LANES16 * 0x7FFF);
+  return null_high & ((ge_space & le_tilde) | is_tab) & HIGHS16;
+}
+
+static void extract_ascii(const uint8_t* data, size_t size, size_t min_size,
+                          std::vector<StringEntry>& entries) {
+  size_t i = 0;
+  while (i < size) {
+    for (;;) {
+      while (i + 8 <= size and not any_printable(load(data + i))) {
+        i += 8;
+      }
+      if (i < size and not is_printable(data[i])) {
+        ++i;
+        continue;
+      }
+      break;
+    }
+
+    const size_t start = i;
+    for (;;) {
+      while (i + 8 <= size and all_printable(load(data + i))) {
+        i += 8;
+      }
+      if (i < size and is_printable(data[i])) {
+        ++i;
+        continue;
+      }
+      break;
+    }
+
+    if (i > start and (i - start) >= min_size) {
+      entries.push_back({start, 0, StringEntry::ENCODING::ASCII, i - start});
+    }
+  }
+}
+
+// UTF-16LE characters whose code point is a printable ASCII character
+static void extract_utf16(const uint8_t* data, size_t size, size_t min_size, size_t parity,
+                          std::vector<StringEntry>& entries) {
+  auto is_char = [data] (size_t i) {
+    return is_printable(data[i]) and data[i + 1] == 0;
+  };
+
+  size_t i = parity;
+  while (i + 1 < size) {
+    for (;;) {
+      while (i + 8 <= size and utf16_chars(load(data + i)) == 0) {
+        i += 8;
+      }
+      if (i + 1 < size and not is_char(i)) {
+        i += 2;
+        continue;
+      }
+      break;
+    }
+
+    const size_t start = i;
+    for (;;) {
+      while (i + 8 <= size and utf16_chars(load(data + i)) == HIGHS16) {
+        i += 8;
+      }
+      if (i + 1 < size and is_char(i)) {
+        i += 2;
+        continue;
+      }
+      break;
+    }
+
+    const size_t length = (i - start) / 2;
+    if (length > 0 and length >= min_size) {
+      entries.push_back({start, 0, StringEntry::ENCODING::UTF16_LE, length});
+    }
+  }
+}
+
+
+std::vector<StringEntry> extract_strings(const uint8_t* data, size_t size, size_t min_size, bool utf16) {
+  std::vector<StringEntry> entries;
+  if (data == nullptr or size == 0) {
+    return entries;
+  }
+
+  extract_ascii(data, size, min_size, entries);
+  if (not utf16) {
+    return entries;
+  }
+
+  // Each scan produces entries sorted by offset: merge them
+  auto by_offset = [] (const StringEntry& lhs, const StringEntry& rhs) {
+    return lhs.offset < rhs.offset;
+  };
+  const size_t nb_ascii = entries.size();
+  extract_utf16(data, size, min_size, 0, entries);
+  const size_t nb_even = entries.size();
+  extract_utf16(data, size, min_size, 1, entries);
+
+  std::inplace_merge(std::begin(entries) + nb_ascii, std::begin(entries) + nb_even, std::end(entries), by_offset);
+  std::inplace_merge(std::begin(entries), std::begin(entries) + nb_ascii, std::end(entries), by_offset);
+  return entries;
+}
+
+std::vector<StringEntry> extract_strings(const std::vector<uint8_t>& data, size_t min_size, bool utf16) {
+  return extract_strings(data.data(), data.size(), min_size, utf16);
+}
+
+std::ostream& operator<<(std::ostream& os, const StringEntry& entry) {
+  os << std::hex;
+  os << "0x" << entry.offset
+     << " (0x" << entry.virtual_address << ") "
+     << (entry.encoding == StringEntry::ENCODING::ASCII ? "ASCII" : "UTF16-LE")
+     << std::dec << " " << entry.length << " chars";
+  return os;
+}
+
+}
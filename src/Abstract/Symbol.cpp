@@ -18,10 +18,32 @@
 
 #include "LIEF/Abstract/Symbol.hpp"
 
+#include "index_tracker.hpp"
+
 namespace LIEF {
+
 Symbol::Symbol() = default;
-Symbol::Symbol(const Symbol&) = default;
-Symbol& Symbol::operator=(const Symbol&) = default;
+
+// The copy is not registered in the index of the original symbol and it owns
+// its name as it can outlive the string pool of the original binary
+Symbol::Symbol(const Symbol& other) :
+  Object{other},
+  name_{other.name()},
+  value_{other.value_},
+  size_{other.size_}
+{}
+
+Symbol& Symbol::operator=(const Symbol& other) {
+  if (this != &other) {
+    Object::operator=(other);
+    this->name_  = other.name();
+    this->interned_name_ = nullptr;
+    this->value_ = other.value_;
+    this->size_  = other.size_;
+    IndexTracker::changed(this->index_tracker_, this->index_kind_);
+  }
+  return *this;
+}
 Symbol::~Symbol() = default;
 
 Symbol::Symbol(const std::string& name) :
@@ -44,20 +66,30 @@ Symbol::Symbol(const std::string& name, uint64_t value, uint64_t size) :
 
 void Symbol::swap(Symbol& other) {
   std::swap(this->name_,   other.name_);
+  std::swap(this->interned_name_, other.interned_name_);
   std::swap(this->value_,  other.value_);
   std::swap(this->size_,   other.size_);
+  IndexTracker::changed(this->index_tracker_, this->index_kind_);
+  IndexTracker::changed(other.index_tracker_, other.index_kind_);
 }
 
 const std::string& Symbol::name() const {
-  return this->name_;
+  return this->interned_name_ != nullptr ? *this->interned_name_ : this->name_;
 }
 
 std::string& Symbol::name() {
+  // The interned name is shared with other symbols: it must not be modified in place
+  if (this->interned_name_ != nullptr) {
+    this->name_ = *this->interned_name_;
+    this->interned_name_ = nullptr;
+  }
   return this->name_;
 }
 
 void Symbol::name(const std::string& name) {
   this->name_ = name;
+  this->interned_name_ = nullptr;
+  IndexTracker::changed(this->index_tracker_, this->index_kind_);
 }
 
 uint64_t Symbol::value() const {
@@ -0,0 +1,168 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#endif
+
+#include "logging.hpp"
+
+#include "LIEF/BinaryStream/MmapStream.hpp"
+#include "LIEF/exception.hpp"
+namespace LIEF {
+
+#if defined(_WIN32)
+MmapStream::MmapStream(const std::string& filename) {
+  HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    throw LIEF::bad_file("Unable to open " + filename);
+  }
+
+  LARGE_INTEGER fsize;
+  if (not GetFileSizeEx(file, &fsize)) {
+    CloseHandle(file);
+    throw LIEF::bad_file("Unable to get the size of " + filename);
+  }
+  this->file_handle_ = file;
+  this->size_        = static_cast<uint64_t>(fsize.QuadPart);
+
+  BY_HANDLE_FILE_INFORMATION info;
+  if (GetFileInformationByHandle(file, &info)) {
+    this->device_ = info.dwVolumeSerialNumber;
+    this->inode_  = (static_cast<uint64_t>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+  }
+
+  if (this->size_ == 0) {
+    return;
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr) {
+    CloseHandle(file);
+    this->file_handle_ = nullptr;
+    throw LIEF::bad_file("Unable to map " + filename);
+  }
+  this->mapping_handle_ = mapping;
+
+  void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (view == nullptr) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    this->mapping_handle_ = nullptr;
+    this->file_handle_    = nullptr;
+    throw LIEF::bad_file("Unable to map " + filename);
+  }
+  this->data_ = reinterpret_cast<const uint8_t*>(view);
+}
+
+MmapStream::~MmapStream() {
+  if (this->data_ != nullptr) {
+    UnmapViewOfFile(this->data_);
+  }
+  if (this->mapping_handle_ != nullptr) {
+    CloseHandle(this->mapping_handle_);
+  }
+  if (this->file_handle_ != nullptr) {
+    CloseHandle(this->file_handle_);
+  }
+}
+
+bool MmapStream::is_mapping(const std::string& path) const {
+  HANDLE file = CreateFileA(path.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  BY_HANDLE_FILE_INFORMATION info;
+  const bool ok = GetFileInformationByHandle(file, &info);
+  CloseHandle(file);
+  if (not ok) {
+    return false;
+  }
+  const uint64_t index = (static_cast<uint64_t>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+  return this->device_ == info.dwVolumeSerialNumber and this->inode_ == index;
+}
+
+int MmapStream::fd() const {
+  return -1;
+}
+#else
+MmapStream::MmapStream(const std::string& filename) {
+  int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw LIEF::bad_file("Unable to open " + filename);
+  }
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw LIEF::bad_file("Unable to stat " + filename);
+  }
+  this->size_   = static_cast<uint64_t>(st.st_size);
+  this->device_ = static_cast<uint64_t>(st.st_dev);
+  this->inode_  = static_cast<uint64_t>(st.st_ino);
+
+  if (this->size_ == 0) {
+    ::close(fd);
+    return;
+  }
+
+  void* addr = ::mmap(nullptr, this->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (addr == MAP_FAILED) {
+    ::close(fd);
+    throw LIEF::bad_file("Unable to map " + filename);
+  }
+  this->data_ = reinterpret_cast<const uint8_t*>(addr);
+  // The descriptor is kept so that the unmodified ranges of the file can be
+  // copied by the kernel when the binary is written (see: ELF::Builder::write)
+  this->fd_ = fd;
+}
+
+MmapStream::~MmapStream() {
+  if (this->data_ != nullptr) {
+    ::munmap(const_cast<uint8_t*>(this->data_), this->size_);
+  }
+  if (this->fd_ >= 0) {
+    ::close(this->fd_);
+  }
+}
+
+int MmapStream::fd() const {
+  return this->fd_;
+}
+
+bool MmapStream::is_mapping(const std::string& path) const {
+  struct stat st;
+  if (::stat(path.c_str(), &st) != 0) {
+    return false;
+  }
+  return this->device_ == static_cast<uint64_t>(st.st_dev) and
+         this->inode_  == static_cast<uint64_t>(st.st_ino);
+}
+#endif
+
+}
+
@@ -0,0 +1,107 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <vector>
+#include <string>
+
+#include "logging.hpp"
+#include "asn1.hpp"
+
+#include "LIEF/BinaryStream/SpanStream.hpp"
+#include "LIEF/exception.hpp"
+namespace LIEF {
+
+SpanStream::SpanStream() = default;
+SpanStream::~SpanStream() = default;
+
+SpanStream::SpanStream(const uint8_t* data, uint64_t size) :
+  data_{data},
+  size_{size}
+{}
+
+uint64_t SpanStream::size() const {
+  return this->size_;
+}
+
+
+const void* SpanStream::read_at(uint64_t offset, uint64_t size, bool throw_error) const {
+
+  if (offset > this->size() or (offset + size) > this->size()) {
+    size_t out_size = (offset + size) - this->size();
+    LIEF_DEBUG("Can't read #{:d} bytes at 0x{:04x} (0x{:x} bytes out of bound)", size, offset, out_size);
+    if (throw_error) {
+      throw LIEF::read_out_of_bound(offset, size);
+    }
+    return nullptr;
+  }
+  return this->data_ + offset;
+}
+
+
+std::vector<uint8_t> SpanStream::content() const {
+  return {this->start(), this->end()};
+}
+
+
+result<size_t> SpanStream::asn1_read_tag(int tag) {
+  return asn1::read_tag(*this, tag);
+}
+
+result<size_t> SpanStream::asn1_peek_len() {
+  return asn1::peek_len(*this);
+}
+
+result<size_t> SpanStream::asn1_read_len() {
+  return asn1::read_len(*this);
+}
+
+result<std::string> SpanStream::asn1_read_alg() {
+  return asn1::read_alg(*this);
+}
+
+result<std::string> SpanStream::asn1_read_oid() {
+  return asn1::read_oid(*this);
+}
+
+result<int32_t> SpanStream::asn1_read_int() {
+  return asn1::read_int(*this);
+}
+
+result<std::vector<uint8_t>> SpanStream::asn1_read_bitstring() {
+  return asn1::read_bitstring(*this);
+}
+
+result<std::vector<uint8_t>> SpanStream::asn1_read_octet_string() {
+  return asn1::read_octet_string(*this);
+}
+
+result<std::unique_ptr<mbedtls_x509_crt>> SpanStream::asn1_read_cert() {
+  return asn1::read_cert(*this);
+}
+
+result<std::string> SpanStream::x509_read_names() {
+  return asn1::x509_read_names(*this);
+}
+
+result<std::vector<uint8_t>> SpanStream::x509_read_serial() {
+  return asn1::x509_read_serial(*this);
+}
+
+result<std::unique_ptr<mbedtls_x509_time>> SpanStream::x509_read_time() {
+  return asn1::x509_read_time(*this);
+}
+
+}
+
@@ -21,28 +21,13 @@
 #include <sstream>
 #include <algorithm>
 
-#include <mbedtls/platform.h>
-#include <mbedtls/asn1.h>
-#include <mbedtls/error.h>
-#include <mbedtls/oid.h>
-#include <mbedtls/x509_crt.h>
-
 #include "logging.hpp"
+#include "asn1.hpp"
 
 #include "LIEF/BinaryStream/VectorStream.hpp"
 #include "LIEF/exception.hpp"
 namespace LIEF {
 
-inline void free_names(mbedtls_x509_name& names) {
-  mbedtls_x509_name *name_cur;
-  name_cur = names.private_next;
-  while (name_cur != nullptr) {
-    mbedtls_x509_name *name_prv = name_cur;
-    name_cur = name_cur->private_next;
-    mbedtls_free(name_prv);
-  }
-}
-
 VectorStream::VectorStream(const std::string& filename) {
   std::ifstream binary(filename, std::ios::in | std::ios::binary);
 
@@ -89,251 +74,53 @@ const void* VectorStream::read_at(uint64_t offset, uint64_t size, bool throw_err
 
 
 result<size_t> VectorStream::asn1_read_tag(int tag) {
-  size_t out = 0;
-
-  const uint8_t* cur_p = this->p();
-  uint8_t* p           = this->p();
-  const uint8_t* end   = this->end();
-
-  int ret = mbedtls_asn1_get_tag(&p, end, &out, tag);
-
-  if (ret == MBEDTLS_ERR_ASN1_OUT_OF_DATA) {
-    return make_error_code(lief_errors::read_out_of_bound);
-  }
-  else if (ret == MBEDTLS_ERR_ASN1_UNEXPECTED_TAG) {
-    return make_error_code(lief_errors::asn1_bad_tag);
-  }
-  else if (ret != 0) {
-    return make_error_code(lief_errors::read_error);
-  }
-
-  this->increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-  return out;
+  return asn1::read_tag(*this, tag);
 }
 
 result<size_t> VectorStream::asn1_peek_len() {
-  const uint64_t pos = this->pos();
-  auto len = this->asn1_read_len();
-  this->setpos(pos);
-  return len;
+  return asn1::peek_len(*this);
 }
 
 result<size_t> VectorStream::asn1_read_len() {
-  size_t len = 0;
-
-  const uint8_t* cur_p = this->p();
-  uint8_t* p           = this->p();
-  const uint8_t* end   = this->end();
-
-  int ret = mbedtls_asn1_get_len(&p, end, &len);
-
-  if (ret == MBEDTLS_ERR_ASN1_OUT_OF_DATA) {
-    return make_error_code(lief_errors::read_out_of_bound);
-  }
-  else if (ret != 0) {
-    return make_error_code(lief_errors::read_error);
-  }
-
-  this->increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-  return len;
+  return asn1::read_len(*this);
 }
 
 result<std::string> VectorStream::asn1_read_alg() {
-  mbedtls_asn1_buf alg_oid;
-  char oid_str[256] = {0};
-
-  const uint8_t* cur_p = this->p();
-  uint8_t* p           = this->p();
-  const uint8_t* end   = this->end();
-
-  int ret = mbedtls_asn1_get_alg_null(&p, end, &alg_oid);
-
-  if (ret == MBEDTLS_ERR_ASN1_OUT_OF_DATA) {
-    return make_error_code(lief_errors::read_out_of_bound);
-  }
-  else if (ret != 0) {
-    return make_error_code(lief_errors::read_error);
-  }
-
-  ret = mbedtls_oid_get_numeric_string(oid_str, sizeof(oid_str), &alg_oid);
-  if (ret <= 0) {
-    return make_error_code(lief_errors::read_error);
-  }
-
-  this->increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-  return std::string(oid_str);
+  return asn1::read_alg(*this);
 }
 
 result<std::string> VectorStream::asn1_read_oid() {
-  mbedtls_asn1_buf buf;
-  char oid_str[256] = {0};
-
-  auto len = this->asn1_read_tag(MBEDTLS_ASN1_OID);
-  if (not len) {
-    return len.error();
-  }
-
-  buf.private_len = len.value();
-  buf.private_p   = this->p();
-  buf.private_tag = MBEDTLS_ASN1_OID;
-
-  int ret = mbedtls_oid_get_numeric_string(oid_str, sizeof(oid_str), &buf);
-  if (ret == MBEDTLS_ERR_OID_BUF_TOO_SMALL) {
-    LIEF_DEBUG("asn1_read_oid: mbedtls_oid_get_numeric_string return MBEDTLS_ERR_OID_BUF_TOO_SMALL");
-    return make_error_code(lief_errors::read_error);
-  }
-
-  this->increment_pos(buf.private_len);
-  return std::string(oid_str);
+  return asn1::read_oid(*this);
 }
 
-
 result<int32_t> VectorStream::asn1_read_int() {
-  int32_t value = 0;
-
-  const uint8_t* cur_p = this->p();
-  uint8_t* p           = this->p();
-  const uint8_t* end   = this->end();
-
-  int ret = mbedtls_asn1_get_int(&p, end, &value);
-
-  if (ret == MBEDTLS_ERR_ASN1_OUT_OF_DATA) {
-    return make_error_code(lief_errors::read_out_of_bound);
-  }
-  else if (ret != 0) {
-    return make_error_code(lief_errors::read_error);
-  }
-
-  this->increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-  return value;
+  return asn1::read_int(*this);
 }
 
 result<std::vector<uint8_t>> VectorStream::asn1_read_bitstring() {
-  mbedtls_asn1_bitstring bs = {0, 0, nullptr};
-
-  const uint8_t* cur_p = this->p();
-  uint8_t* p           = this->p();
-  const uint8_t* end   = this->end();
-
-  int ret = mbedtls_asn1_get_bitstring(&p, end, &bs);
-
-  if (ret == MBEDTLS_ERR_ASN1_OUT_OF_DATA) {
-    return make_error_code(lief_errors::read_out_of_bound);
-  }
-  else if (ret == MBEDTLS_ERR_ASN1_LENGTH_MISMATCH) {
-    this->increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-    return std::vector<uint8_t>{bs.private_p, bs.private_p + bs.private_len};
-  }
-  else if (ret != 0) {
-    return make_error_code(lief_errors::read_error);
-  }
-
-  this->increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-  return std::vector<uint8_t>{bs.private_p, bs.private_p + bs.private_len};
+  return asn1::read_bitstring(*this);
 }
 
-
 result<std::vector<uint8_t>> VectorStream::asn1_read_octet_string() {
-  auto tag = this->asn1_read_tag(MBEDTLS_ASN1_OCTET_STRING);
-  if (not tag) {
-    return tag.error();
-  }
-  std::vector<uint8_t> raw = {this->p(), this->p() + tag.value()};
-  this->increment_pos(tag.value());
-  return raw;
+  return asn1::read_octet_string(*this);
 }
 
 result<std::unique_ptr<mbedtls_x509_crt>> VectorStream::asn1_read_cert() {
-  std::unique_ptr<mbedtls_x509_crt> ca{new mbedtls_x509_crt{}};
-  mbedtls_x509_crt_init(ca.get());
-
-  uint8_t* p               = this->p();
-  const uint8_t* end       = this->end();
-  const uintptr_t buff_len = reinterpret_cast<uintptr_t>(end) - reinterpret_cast<uintptr_t>(p);
-
-  int ret = mbedtls_x509_crt_parse_der(ca.get(), p, /* buff len */ buff_len);
-  if (ret != 0) {
-    std::string strerr(1024, 0);
-    mbedtls_strerror(ret, const_cast<char*>(strerr.data()), strerr.size());
-    LIEF_DEBUG("asn1_read_cert(): {}", strerr);
-    return make_error_code(lief_errors::read_error);
-  }
-  if (ca->private_raw.private_len <= 0) {
-    return make_error_code(lief_errors::read_error);
-  }
-  this->increment_pos(ca->private_raw.private_len);
-  return ca;
+  return asn1::read_cert(*this);
 }
 
 result<std::string> VectorStream::x509_read_names() {
-  mbedtls_x509_name name;
-  std::memset(&name, 0, sizeof(name));
-
-  auto tag = this->asn1_read_tag(/* Name */
-                                 MBEDTLS_ASN1_CONSTRUCTED | MBEDTLS_ASN1_SEQUENCE);
-  if (not tag) {
-    LIEF_INFO("Wrong tag: 0x{:x} for x509_read_names (pos: {:d})",
-        this->peek<uint8_t>(), this->pos());
-    return tag.error();
-  }
-
-  const uint8_t* cur_p = this->p();
-  uint8_t* p           = this->p();
-  const uint8_t* end   = p + tag.value();
-  int ret = mbedtls_x509_get_name(&p, end, &name);
-  if (ret != 0) {
-    free_names(name);
-    LIEF_DEBUG("mbedtls_x509_get_name failed with {:d}", ret);
-    return make_error_code(lief_errors::read_error);
-  }
-  char buffer[1024];
-  ret = mbedtls_x509_dn_gets(buffer, sizeof(buffer), &name);
-  free_names(name);
-
-  if (ret < 0) {
-    return make_error_code(lief_errors::read_error);
-  }
-
-  this->increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-  return std::string(buffer);
+  return asn1::x509_read_names(*this);
 }
 
 result<std::vector<uint8_t>> VectorStream::x509_read_serial() {
-  mbedtls_x509_buf serial;
-
-  const uint8_t* cur_p = this->p();
-  uint8_t* p           = this->p();
-  const uint8_t* end   = this->end();
-
-  int ret = mbedtls_x509_get_serial(&p, end, &serial);
-
-  if (ret != 0) {
-    return make_error_code(lief_errors::read_error);
-  }
-
-  this->increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-  return std::vector<uint8_t>{serial.private_p, serial.private_p + serial.private_len};
+  return asn1::x509_read_serial(*this);
 }
 
 result<std::unique_ptr<mbedtls_x509_time>> VectorStream::x509_read_time() {
-  std::unique_ptr<mbedtls_x509_time> tm{new mbedtls_x509_time{}};
-
-  const uint8_t* cur_p = this->p();
-  uint8_t* p           = this->p();
-  const uint8_t* end   = this->end();
-
-  int ret = mbedtls_x509_get_time(&p, end, tm.get());
-
-  if (ret != 0) {
-    return make_error_code(lief_errors::read_error);
-  }
-
-  this->increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-  return std::move(tm);
+  return asn1::x509_read_time(*this);
 }
 
-
-
 const std::vector<uint8_t>& VectorStream::content() const {
   return this->binary_;
 }
@@ -0,0 +1,319 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_BINARY_STREAM_ASN1_H_
+#define LIEF_BINARY_STREAM_ASN1_H_
+#include <cstring>
+#include <vector>
+#include <string>
+#include <memory>
+
+#include <mbedtls/platform.h>
+#include <mbedtls/asn1.h>
+#include <mbedtls/error.h>
+#include <mbedtls/oid.h>
+#include <mbedtls/x509_crt.h>
+
+#include "logging.hpp"
+
+#include "LIEF/errors.hpp"
+
+// ASN.1 / x509 helpers shared by the streams that expose a contiguous
+// buffer through p() and end() (VectorStream, MmapStream, ...)
+//
+// The raw pointers are given to mbedtls which only reads them. The const_cast
+// is required by the mbedtls API (unsigned char**) but the underlying buffer
+// is never written.
+namespace LIEF {
+namespace asn1 {
+
+inline void free_names(mbedtls_x509_name& names) {
+  mbedtls_x509_name *name_cur;
+  name_cur = names.private_next;
+  while (name_cur != nullptr) {
+    mbedtls_x509_name *name_prv = name_cur;
+    name_cur = name_cur->private_next;
+    mbedtls_free(name_prv);
+  }
+}
+
+template<class STREAM>
+inline uint8_t* cursor(const STREAM& stream) {
+  return const_cast<uint8_t*>(static_cast<const uint8_t*>(stream.p()));
+}
+
+template<class STREAM>
+inline void advance(const STREAM& stream, const uint8_t* from, const uint8_t* to) {
+  stream.increment_pos(reinterpret_cast<uintptr_t>(to) - reinterpret_cast<uintptr_t>(from));
+}
+
+template<class STREAM>
+result<size_t> read_tag(STREAM& stream, int tag) {
+  size_t out = 0;
+
+  const uint8_t* cur_p = cursor(stream);
+  uint8_t* p           = cursor(stream);
+  const uint8_t* end   = stream.end();
+
+  int ret = mbedtls_asn1_get_tag(&p, end, &out, tag);
+
+  if (ret == MBEDTLS_ERR_ASN1_OUT_OF_DATA) {
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+  else if (ret == MBEDTLS_ERR_ASN1_UNEXPECTED_TAG) {
+    return make_error_code(lief_errors::asn1_bad_tag);
+  }
+  else if (ret != 0) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  advance(stream, cur_p, p);
+  return out;
+}
+
+template<class STREAM>
+result<size_t> read_len(STREAM& stream) {
+  size_t len = 0;
+
+  const uint8_t* cur_p = cursor(stream);
+  uint8_t* p           = cursor(stream);
+  const uint8_t* end   = stream.end();
+
+  int ret = mbedtls_asn1_get_len(&p, end, &len);
+
+  if (ret == MBEDTLS_ERR_ASN1_OUT_OF_DATA) {
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+  else if (ret != 0) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  advance(stream, cur_p, p);
+  return len;
+}
+
+template<class STREAM>
+result<size_t> peek_len(STREAM& stream) {
+  const uint64_t pos = stream.pos();
+  auto len = read_len(stream);
+  stream.setpos(pos);
+  return len;
+}
+
+template<class STREAM>
+result<std::string> read_alg(STREAM& stream) {
+  mbedtls_asn1_buf alg_oid;
+  char oid_str[256] = {0};
+
+  const uint8_t* cur_p = cursor(stream);
+  uint8_t* p           = cursor(stream);
+  const uint8_t* end   = stream.end();
+
+  int ret = mbedtls_asn1_get_alg_null(&p, end, &alg_oid);
+
+  if (ret == MBEDTLS_ERR_ASN1_OUT_OF_DATA) {
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+  else if (ret != 0) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  ret = mbedtls_oid_get_numeric_string(oid_str, sizeof(oid_str), &alg_oid);
+  if (ret <= 0) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  advance(stream, cur_p, p);
+  return std::string(oid_str);
+}
+
+template<class STREAM>
+result<std::string> read_oid(STREAM& stream) {
+  mbedtls_asn1_buf buf;
+  char oid_str[256] = {0};
+
+  auto len = read_tag(stream, MBEDTLS_ASN1_OID);
+  if (not len) {
+    return len.error();
+  }
+
+  buf.private_len = len.value();
+  buf.private_p   = cursor(stream);
+  buf.private_tag = MBEDTLS_ASN1_OID;
+
+  int ret = mbedtls_oid_get_numeric_string(oid_str, sizeof(oid_str), &buf);
+  if (ret == MBEDTLS_ERR_OID_BUF_TOO_SMALL) {
+    LIEF_DEBUG("asn1_read_oid: mbedtls_oid_get_numeric_string return MBEDTLS_ERR_OID_BUF_TOO_SMALL");
+    return make_error_code(lief_errors::read_error);
+  }
+
+  stream.increment_pos(buf.private_len);
+  return std::string(oid_str);
+}
+
+template<class STREAM>
+result<int32_t> read_int(STREAM& stream) {
+  int32_t value = 0;
+
+  const uint8_t* cur_p = cursor(stream);
+  uint8_t* p           = cursor(stream);
+  const uint8_t* end   = stream.end();
+
+  int ret = mbedtls_asn1_get_int(&p, end, &value);
+
+  if (ret == MBEDTLS_ERR_ASN1_OUT_OF_DATA) {
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+  else if (ret != 0) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  advance(stream, cur_p, p);
+  return value;
+}
+
+template<class STREAM>
+result<std::vector<uint8_t>> read_bitstring(STREAM& stream) {
+  mbedtls_asn1_bitstring bs = {0, 0, nullptr};
+
+  const uint8_t* cur_p = cursor(stream);
+  uint8_t* p           = cursor(stream);
+  const uint8_t* end   = stream.end();
+
+  int ret = mbedtls_asn1_get_bitstring(&p, end, &bs);
+
+  if (ret == MBEDTLS_ERR_ASN1_OUT_OF_DATA) {
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+  else if (ret == MBEDTLS_ERR_ASN1_LENGTH_MISMATCH) {
+    advance(stream, cur_p, p);
+    return std::vector<uint8_t>{bs.private_p, bs.private_p + bs.private_len};
+  }
+  else if (ret != 0) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  advance(stream, cur_p, p);
+  return std::vector<uint8_t>{bs.private_p, bs.private_p + bs.private_len};
+}
+
+template<class STREAM>
+result<std::vector<uint8_t>> read_octet_string(STREAM& stream) {
+  auto tag = read_tag(stream, MBEDTLS_ASN1_OCTET_STRING);
+  if (not tag) {
+    return tag.error();
+  }
+  const uint8_t* p = cursor(stream);
+  std::vector<uint8_t> raw = {p, p + tag.value()};
+  stream.increment_pos(tag.value());
+  return raw;
+}
+
+template<class STREAM>
+result<std::unique_ptr<mbedtls_x509_crt>> read_cert(STREAM& stream) {
+  std::unique_ptr<mbedtls_x509_crt> ca{new mbedtls_x509_crt{}};
+  mbedtls_x509_crt_init(ca.get());
+
+  uint8_t* p               = cursor(stream);
+  const uint8_t* end       = stream.end();
+  const uintptr_t buff_len = reinterpret_cast<uintptr_t>(end) - reinterpret_cast<uintptr_t>(p);
+
+  int ret = mbedtls_x509_crt_parse_der(ca.get(), p, /* buff len */ buff_len);
+  if (ret != 0) {
+    std::string strerr(1024, 0);
+    mbedtls_strerror(ret, const_cast<char*>(strerr.data()), strerr.size());
+    LIEF_DEBUG("asn1_read_cert(): {}", strerr);
+    return make_error_code(lief_errors::read_error);
+  }
+  if (ca->private_raw.private_len <= 0) {
+    return make_error_code(lief_errors::read_error);
+  }
+  stream.increment_pos(ca->private_raw.private_len);
+  return ca;
+}
+
+template<class STREAM>
+result<std::string> x509_read_names(STREAM& stream) {
+  mbedtls_x509_name name;
+  std::memset(&name, 0, sizeof(name));
+
+  auto tag = read_tag(stream, /* Name */
+                      MBEDTLS_ASN1_CONSTRUCTED | MBEDTLS_ASN1_SEQUENCE);
+  if (not tag) {
+    LIEF_INFO("Wrong tag: 0x{:x} for x509_read_names (pos: {:d})",
+        stream.template peek<uint8_t>(), stream.pos());
+    return tag.error();
+  }
+
+  const uint8_t* cur_p = cursor(stream);
+  uint8_t* p           = cursor(stream);
+  const uint8_t* end   = p + tag.value();
+  int ret = mbedtls_x509_get_name(&p, end, &name);
+  if (ret != 0) {
+    free_names(name);
+    LIEF_DEBUG("mbedtls_x509_get_name failed with {:d}", ret);
+    return make_error_code(lief_errors::read_error);
+  }
+  char buffer[1024];
+  ret = mbedtls_x509_dn_gets(buffer, sizeof(buffer), &name);
+  free_names(name);
+
+  if (ret < 0) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  advance(stream, cur_p, p);
+  return std::string(buffer);
+}
+
+template<class STREAM>
+result<std::vector<uint8_t>> x509_read_serial(STREAM& stream) {
+  mbedtls_x509_buf serial;
+
+  const uint8_t* cur_p = cursor(stream);
+  uint8_t* p           = cursor(stream);
+  const uint8_t* end   = stream.end();
+
+  int ret = mbedtls_x509_get_serial(&p, end, &serial);
+
+  if (ret != 0) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  advance(stream, cur_p, p);
+  return std::vector<uint8_t>{serial.private_p, serial.private_p + serial.private_len};
+}
+
+template<class STREAM>
+result<std::unique_ptr<mbedtls_x509_time>> x509_read_time(STREAM& stream) {
+  std::unique_ptr<mbedtls_x509_time> tm{new mbedtls_x509_time{}};
+
+  const uint8_t* cur_p = cursor(stream);
+  uint8_t* p           = cursor(stream);
+  const uint8_t* end   = stream.end();
+
+  int ret = mbedtls_x509_get_time(&p, end, tm.get());
+
+  if (ret != 0) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  advance(stream, cur_p, p);
+  return std::move(tm);
+}
+
+}
+}
+#endif
@@ -16,6 +16,9 @@
 
 #include "logging.hpp"
 
+#include "LIEF/BinaryStream/VectorStream.hpp"
+#include "LIEF/BinaryStream/MmapStream.hpp"
+
 #include "LIEF/DEX/Parser.hpp"
 #include "LIEF/DEX/utils.hpp"
 #include "LIEF/DEX/Structures.hpp"
@@ -58,7 +61,7 @@ Parser::Parser(const std::vector<uint8_t>& data, const std::string& name) :
 
 Parser::Parser(const std::string& file) :
   file_{new File{}},
-  stream_{std::unique_ptr<VectorStream>(new VectorStream{file})}
+  stream_{std::unique_ptr<MmapStream>(new MmapStream{file})}
 {
   if (not is_dex(file)) {
     LIEF_ERR("'{}' is not a DEX File", file);
@@ -26,7 +26,11 @@ namespace DEX {
 
 template<typename DEX_T>
 void Parser::parse_file() {
-  this->file_->original_data_ = this->stream_->content();
+  const uint64_t size = this->stream_->size();
+  const uint8_t* raw  = this->stream_->peek_array<uint8_t>(0, size, /* check */ false);
+  if (raw != nullptr) {
+    this->file_->original_data_ = {raw, raw + size};
+  }
 
   this->parse_header<DEX_T>();
   this->parse_map<DEX_T>();
@@ -0,0 +1,147 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/ELF/Section.hpp"
+#include "LIEF/ELF/Segment.hpp"
+#include "LIEF/ELF/Relocation.hpp"
+
+#include "AddressIndex.hpp"
+
+namespace LIEF {
+namespace ELF {
+
+AddressIndex::AddressIndex(IndexTracker& tracker, const sections_t& sections,
+                           const segments_t& segments, const relocations_t& relocations) :
+  tracker_{tracker},
+  sections_{sections},
+  segments_{segments},
+  relocations_{relocations}
+{}
+
+const AddressIndex& AddressIndex::refresh(uint32_t kinds) {
+  if (this->nb_sections_.load(std::memory_order_relaxed) != this->sections_.size()) {
+    this->tracker_.changed(IndexTracker::SECTIONS);
+  }
+  if (this->nb_segments_.load(std::memory_order_relaxed) != this->segments_.size()) {
+    this->tracker_.changed(IndexTracker::SEGMENTS);
+  }
+  if (this->nb_relocations_.load(std::memory_order_relaxed) != this->relocations_.size()) {
+    this->tracker_.changed(IndexTracker::RELOCATIONS);
+  }
+  this->tracker_.refresh(kinds, [this] (uint32_t stale) { this->update(stale); });
+  return *this;
+}
+
+void AddressIndex::update(uint32_t kinds) {
+  if ((kinds & IndexTracker::SECTIONS) != 0) {
+    this->update_sections();
+  }
+  if ((kinds & IndexTracker::SEGMENTS) != 0) {
+    this->update_segments();
+  }
+  if ((kinds & IndexTracker::RELOCATIONS) != 0) {
+    this->update_relocations();
+  }
+}
+
+void AddressIndex::update_sections() {
+  this->sections_by_offset_.clear();
+  this->sections_by_va_.clear();
+  for (size_t i = 0; i < this->sections_.size(); ++i) {
+    Section* section = this->sections_[i];
+    if (section == nullptr) {
+      continue;
+    }
+    section->index_tracker_ = &this->tracker_;
+    this->sections_by_offset_.add(section->offset(), section->size(), i);
+    if (section->virtual_address() != 0) {
+      this->sections_by_va_.add(section->virtual_address(), section->size(), i);
+    }
+  }
+  this->sections_by_offset_.finalize();
+  this->sections_by_va_.finalize();
+  this->nb_sections_.store(this->sections_.size(), std::memory_order_relaxed);
+}
+
+void AddressIndex::update_segments() {
+  this->segments_by_offset_.clear();
+  this->segments_by_va_.clear();
+  for (size_t i = 0; i < this->segments_.size(); ++i) {
+    Segment* segment = this->segments_[i];
+    if (segment == nullptr) {
+      continue;
+    }
+    segment->index_tracker_ = &this->tracker_;
+    this->segments_by_offset_.add(segment->file_offset(), segment->physical_size(), i);
+    this->segments_by_va_.add(segment->virtual_address(), segment->virtual_size(), i);
+  }
+  this->segments_by_offset_.finalize();
+  this->segments_by_va_.finalize();
+  this->nb_segments_.store(this->segments_.size(), std::memory_order_relaxed);
+}
+
+void AddressIndex::update_relocations() {
+  this->relocations_by_address_.clear();
+  this->relocations_by_address_.reserve(this->relocations_.size());
+  for (Relocation* relocation : this->relocations_) {
+    relocation->index_tracker_ = &this->tracker_;
+    // emplace() keeps the first relocation registered for a given address
+    this->relocations_by_address_.emplace(relocation->address(), relocation);
+  }
+  this->nb_relocations_.store(this->relocations_.size(), std::memory_order_relaxed);
+}
+
+const Section* AddressIndex::section_from_offset(uint64_t offset, bool skip_nobits) const {
+  const size_t idx = this->sections_by_offset_.find(offset,
+      [this, skip_nobits] (size_t i) {
+        return not skip_nobits or this->sections_[i]->type() != ELF_SECTION_TYPES::SHT_NOBITS;
+      });
+  return idx == npos ? nullptr : this->sections_[idx];
+}
+
+const Section* AddressIndex::section_from_virtual_address(uint64_t address, bool skip_nobits) const {
+  const size_t idx = this->sections_by_va_.find(address,
+      [this, skip_nobits] (size_t i) {
+        return not skip_nobits or this->sections_[i]->type() != ELF_SECTION_TYPES::SHT_NOBITS;
+      });
+  return idx == npos ? nullptr : this->sections_[idx];
+}
+
+const Segment* AddressIndex::segment_from_offset(uint64_t offset, bool load_only) const {
+  const size_t idx = this->segments_by_offset_.find(offset,
+      [this, load_only] (size_t i) {
+        return not load_only or this->segments_[i]->type() == SEGMENT_TYPES::PT_LOAD;
+      });
+  return idx == npos ? nullptr : this->segments_[idx];
+}
+
+const Segment* AddressIndex::segment_from_virtual_address(uint64_t address, bool load_only) const {
+  const size_t idx = this->segments_by_va_.find(address,
+      [this, load_only] (size_t i) {
+        return not load_only or this->segments_[i]->type() == SEGMENT_TYPES::PT_LOAD;
+      });
+  return idx == npos ? nullptr : this->segments_[idx];
+}
+
+const Relocation* AddressIndex::relocation_from_address(uint64_t address) const {
+  auto it = this->relocations_by_address_.find(address);
+  if (it == std::end(this->relocations_by_address_)) {
+    return nullptr;
+  }
+  return it->second;
+}
+
+}
+}
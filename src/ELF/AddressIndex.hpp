@@ -0,0 +1,85 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ELF_ADDRESS_INDEX_H_
+#define LIEF_ELF_ADDRESS_INDEX_H_
+#include <atomic>
+#include <unordered_map>
+
+#include "LIEF/ELF/type_traits.hpp"
+
+#include "ranges_index.hpp"
+#include "index_tracker.hpp"
+
+namespace LIEF {
+namespace ELF {
+class Section;
+class Segment;
+class Relocation;
+
+//! Sorted view of the sections, segments and relocations of an ELF::Binary
+//! used to resolve an address (or an offset) in O(log n).
+//!
+//! The index lives as long as the Binary. Its parts (sections, segments,
+//! relocations) are updated independently when the IndexTracker of the Binary
+//! flags them as stale: the setters of Section, Segment and Relocation that
+//! modify an address, an offset or a size only flag their own kind.
+class AddressIndex {
+  public:
+  static constexpr size_t npos = RangesIndex::npos;
+
+  AddressIndex(IndexTracker& tracker, const sections_t& sections,
+               const segments_t& segments, const relocations_t& relocations);
+
+  //! Update the parts of the index used by the given IndexTracker::KIND
+  //! if they are stale
+  const AddressIndex& refresh(uint32_t kinds);
+
+  const Section* section_from_offset(uint64_t offset, bool skip_nobits) const;
+  const Section* section_from_virtual_address(uint64_t address, bool skip_nobits) const;
+
+  const Segment* segment_from_offset(uint64_t offset, bool load_only = false) const;
+  const Segment* segment_from_virtual_address(uint64_t address, bool load_only = false) const;
+
+  const Relocation* relocation_from_address(uint64_t address) const;
+
+  private:
+  void update(uint32_t kinds);
+  void update_sections();
+  void update_segments();
+  void update_relocations();
+
+  IndexTracker&        tracker_;
+  const sections_t&    sections_;
+  const segments_t&    segments_;
+  const relocations_t& relocations_;
+
+  // Number of elements indexed. They catch the containers modified without
+  // flagging the tracker
+  std::atomic<size_t> nb_sections_{0};
+  std::atomic<size_t> nb_segments_{0};
+  std::atomic<size_t> nb_relocations_{0};
+
+  RangesIndex sections_by_offset_;
+  RangesIndex sections_by_va_;
+  RangesIndex segments_by_offset_;
+  RangesIndex segments_by_va_;
+
+  std::unordered_map<uint64_t, const Relocation*> relocations_by_address_;
+};
+
+}
+}
+#endif
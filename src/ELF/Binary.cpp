@@ -18,6 +18,7 @@
 #include <numeric>
 #include <sstream>
 #include <map>
+#include <unordered_set>
 #include <cctype>
 
 #include "LIEF/DWARF/enums.hpp"
@@ -49,6 +50,7 @@
 #include "LIEF/ELF/DynamicEntryRunPath.hpp"
 #include "LIEF/ELF/DynamicSharedObject.hpp"
 #include "LIEF/ELF/Note.hpp"
+#include "LIEF/ELF/Parser.hpp"
 #include "LIEF/ELF/Builder.hpp"
 #include "LIEF/ELF/Section.hpp"
 #include "LIEF/ELF/Segment.hpp"
@@ -60,14 +62,58 @@
 
 #include "LIEF/ELF/hash.hpp"
 
+#include "AddressIndex.hpp"
+#include "symbols_index.hpp"
+#include "object_pool.hpp"
+#include "string_pool.hpp"
+
 #include "Binary.tcc"
 #include "Object.tcc"
 
 namespace LIEF {
 namespace ELF {
-Binary::Binary()  = default;
 
-Binary::Binary(const std::string& name, ELF_CLASS type) : type_{type} {
+// Return the first symbol of `symbols` that is equal to `symbol`.
+// As equal symbols share the same name, the index provides the candidate
+// and the (expensive) comparison is only done on a mismatch.
+static symbols_t::iterator find_symbol(symbols_t& symbols, SymbolsIndex<Symbol>& index,
+                                       const Symbol& symbol) {
+  const Symbol* candidate = index.find(symbol.name());
+  if (candidate == nullptr) {
+    return std::end(symbols);
+  }
+
+  if (candidate == &symbol or *candidate == symbol) {
+    return std::find(std::begin(symbols), std::end(symbols), candidate);
+  }
+
+  return std::find_if(std::begin(symbols), std::end(symbols),
+      [&symbol] (const Symbol* s) {
+        return s != nullptr and *s == symbol;
+      });
+}
+
+// Like ld.so (see check_match() in dl-lookup.c), a name can't be resolved
+// by an undefined symbol
+static bool is_defined(const Symbol& symbol) {
+  return symbol.shndx() != static_cast<uint16_t>(SYMBOL_SECTION_INDEX::SHN_UNDEF) and
+         (symbol.value() != 0 or symbol.type() == ELF_SYMBOL_TYPES::STT_TLS);
+}
+
+Binary::Binary() :
+  index_tracker_{new IndexTracker{}},
+  address_index_{new AddressIndex{*this->index_tracker_, this->sections_, this->segments_, this->relocations_}},
+  dynamic_symbols_index_{new SymbolsIndex<Symbol>{*this->index_tracker_, IndexTracker::SYMBOLS, this->dynamic_symbols_,
+                                                  IndexTracker::DYNAMIC_HASH}},
+  static_symbols_index_{new SymbolsIndex<Symbol>{*this->index_tracker_, IndexTracker::STATIC_SYMBOLS, this->static_symbols_}},
+  symbols_pool_{new ObjectPool<Symbol>{}},
+  relocations_pool_{new ObjectPool<Relocation>{}},
+  symbol_versions_pool_{new ObjectPool<SymbolVersion>{}},
+  names_pool_{new StringPool{}}
+{}
+
+Binary::Binary(const std::string& name, ELF_CLASS type) : Binary{} {
+  this->type_ = type;
   this->name_ = name;
   if (type_ == ELF_CLASS::ELFCLASS32) {
   }
@@ -164,6 +210,7 @@ std::vector<std::string> Binary::get_abstract_imported_libraries() const {
 // ===============
 
 it_dynamic_entries Binary::dynamic_entries() {
+  this->mark_modified(MODIFIED_DYNAMIC_ENTRIES);
   return this->dynamic_entries_;
 }
 
@@ -173,7 +220,9 @@ it_const_dynamic_entries Binary::dynamic_entries() const {
 
 
 DynamicEntry& Binary::add(const DynamicEntry& entry) {
+  this->mark_modified(MODIFIED_DYNAMIC_ENTRIES);
 
+  this->load_deferred();
   DynamicEntry* new_one = nullptr;
   switch (entry.tag()) {
     case DYNAMIC_TAGS::DT_NEEDED:
@@ -240,12 +289,16 @@ DynamicEntry& Binary::add(const DynamicEntry& entry) {
 
 
 Note& Binary::add(const Note& note) {
+  this->mark_modified(MODIFIED_NOTES);
+  this->load_notes();
   this->notes_.emplace_back(new Note{note});
   return *this->notes_.back();
 }
 
 
 void Binary::remove(const DynamicEntry& entry) {
+  this->mark_modified(MODIFIED_DYNAMIC_ENTRIES);
+  this->load_deferred();
   auto&& it_entry = std::find_if(
       std::begin(this->dynamic_entries_),
       std::end(this->dynamic_entries_),
@@ -265,6 +318,8 @@ void Binary::remove(const DynamicEntry& entry) {
 
 
 void Binary::remove(DYNAMIC_TAGS tag) {
+  this->mark_modified(MODIFIED_DYNAMIC_ENTRIES);
+  this->load_deferred();
   for (auto&& it = std::begin(this->dynamic_entries_);
               it != std::end(this->dynamic_entries_);) {
     if ((*it)->tag() == tag) {
@@ -277,6 +332,8 @@ void Binary::remove(DYNAMIC_TAGS tag) {
 }
 
 void Binary::remove(const Section& section, bool clear) {
+  this->mark_modified(MODIFIED_ALL);
+  this->load_deferred();
   auto&& it_section = std::find_if(
       std::begin(this->sections_),
       std::end(this->sections_),
@@ -331,10 +388,13 @@ void Binary::remove(const Section& section, bool clear) {
 
   delete s;
   this->sections_.erase(it_section);
+  this->invalidate_address_index();
 }
 
 void Binary::remove(const Note& note) {
+  this->mark_modified(MODIFIED_NOTES);
 
+  this->load_notes();
   auto&& it_note = std::find_if(
       std::begin(this->notes_),
       std::end(this->notes_),
@@ -351,6 +411,8 @@ void Binary::remove(const Note& note) {
 }
 
 void Binary::remove(NOTE_TYPES type) {
+  this->mark_modified(MODIFIED_NOTES);
+  this->load_notes();
   for (auto&& it = std::begin(this->notes_);
               it != std::end(this->notes_);) {
     Note* n = *it;
@@ -372,10 +434,13 @@ void Binary::remove(NOTE_TYPES type) {
 // -------
 
 it_symbols Binary::static_symbols() {
+  this->mark_modified(MODIFIED_STATIC_SYMBOLS);
+  this->load_static_symbols();
   return this->static_symbols_;
 }
 
 it_const_symbols Binary::static_symbols() const {
+  this->load_static_symbols();
   return this->static_symbols_;
 }
 
@@ -383,15 +448,19 @@ it_const_symbols Binary::static_symbols() const {
 // --------
 
 it_symbols Binary::dynamic_symbols() {
+  this->mark_modified(MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_SYMBOL_VERSIONS);
+  this->load_symbol_versions();
   return this->dynamic_symbols_;
 }
 
 it_const_symbols Binary::dynamic_symbols() const {
+  this->load_symbol_versions();
   return this->dynamic_symbols_;
 }
 
 
 it_symbols Binary::symbols() {
+  this->mark_modified(MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS | MODIFIED_SYMBOL_VERSIONS);
   return this->static_dyn_symbols();
 }
 
@@ -401,14 +470,10 @@ it_const_symbols Binary::symbols() const {
 
 
 Symbol& Binary::export_symbol(const Symbol& symbol) {
+  this->mark_modified(MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS | MODIFIED_SYMBOL_VERSIONS);
 
   // Check if the symbol is in the dynamic symbol table
-  auto&& it_symbol = std::find_if(
-      std::begin(this->dynamic_symbols_),
-      std::end(this->dynamic_symbols_),
-      [&symbol] (const Symbol* s) {
-        return *s == symbol;
-      });
+  auto&& it_symbol = find_symbol(this->dynamic_symbols_, this->dynamic_symbols_index(), symbol);
 
   if (it_symbol == std::end(this->dynamic_symbols_)) {
     // Create a new one
@@ -514,56 +579,147 @@ Symbol& Binary::add_exported_function(uint64_t address, const std::string& name)
 
 
 bool Binary::has_dynamic_symbol(const std::string& name) const {
-  auto&& it_symbol = std::find_if(
-      std::begin(this->dynamic_symbols_),
-      std::end(this->dynamic_symbols_),
-      [&name] (const Symbol* s) {
-        return s->name() == name;
-      });
-  return it_symbol != std::end(this->dynamic_symbols_);
+  return this->dynamic_symbols_index().find(name) != nullptr;
 }
 
 const Symbol& Binary::get_dynamic_symbol(const std::string& name) const {
-  if (not this->has_dynamic_symbol(name)) {
+  const Symbol* symbol = this->dynamic_symbols_index().find(name);
+  if (symbol == nullptr) {
     throw not_found("Symbol '" + name + "' not found!");
   }
-
-  auto&& it_symbol = std::find_if(
-      std::begin(this->dynamic_symbols_),
-      std::end(this->dynamic_symbols_),
-      [&name] (const Symbol* s) {
-        return s->name() == name;
-      });
-  return **it_symbol;
+  return *symbol;
 }
 
 Symbol& Binary::get_dynamic_symbol(const std::string& name) {
+  this->mark_modified(MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_SYMBOL_VERSIONS);
   return const_cast<Symbol&>(static_cast<const Binary*>(this)->get_dynamic_symbol(name));
 }
 
+const Symbol* Binary::lookup_dynamic_symbol(const std::string& name) const {
+  return this->lookup_dynamic_symbol(name, this->dynamic_symbols_lookup_table());
+}
+
+std::vector<const Symbol*> Binary::lookup_dynamic_symbols(const std::vector<std::string>& names) const {
+  const DYNAMIC_TAGS table = this->dynamic_symbols_lookup_table();
+  std::vector<const Symbol*> symbols;
+  symbols.reserve(names.size());
+  for (const std::string& name : names) {
+    symbols.push_back(this->lookup_dynamic_symbol(name, table));
+  }
+  return symbols;
+}
+
+DYNAMIC_TAGS Binary::dynamic_symbols_lookup_table() const {
+  // The hash tables describe the dynamic symbols as they were parsed. The
+  // MODIFIED_DYNAMIC_SYMBOLS flag can't be used here since the non-const
+  // accessors set it even if the symbols are only read.
+  if (this->index_tracker_->is_stale(IndexTracker::DYNAMIC_HASH)) {
+    return DYNAMIC_TAGS::DT_NULL;
+  }
+
+  const GnuHash& gnu = this->gnu_hash_;
+  if (this->use_gnu_hash() and gnu.c_ > 0 and gnu.nb_buckets() > 0 and gnu.maskwords() > 0) {
+    return DYNAMIC_TAGS::DT_GNU_HASH;
+  }
+
+  if (this->use_sysv_hash() and this->sysv_hash_.nbucket() > 0) {
+    return DYNAMIC_TAGS::DT_HASH;
+  }
+  return DYNAMIC_TAGS::DT_NULL;
+}
+
+const Symbol* Binary::lookup_dynamic_symbol(const std::string& name, DYNAMIC_TAGS table) const {
+  switch (table) {
+    case DYNAMIC_TAGS::DT_GNU_HASH:
+      {
+        return this->gnu_hash_lookup(name);
+      }
+
+    case DYNAMIC_TAGS::DT_HASH:
+      {
+        return this->sysv_hash_lookup(name);
+      }
+
+    default:
+      {
+        // Same set of symbols as the hash tables: the defined ones
+        const Symbol* symbol = this->dynamic_symbols_index().find(name);
+        if (symbol == nullptr or is_defined(*symbol)) {
+          return symbol;
+        }
+        // The index references the first symbol with this name (e.g. an import)
+        auto it = std::find_if(std::begin(this->dynamic_symbols_), std::end(this->dynamic_symbols_),
+            [&name] (const Symbol* s) {
+              return s != nullptr and s->name() == name and is_defined(*s);
+            });
+        return it != std::end(this->dynamic_symbols_) ? *it : nullptr;
+      }
+  }
+}
+
+// See: https://github.com/lattera/glibc/blob/master/elf/dl-lookup.c#L380
+const Symbol* Binary::gnu_hash_lookup(const std::string& name) const {
+  const GnuHash& gnu = this->gnu_hash_;
+  const uint32_t hash = dl_new_hash(name.c_str());
+
+  if (not gnu.check_bloom_filter(hash)) {
+    return nullptr;
+  }
+
+  const uint32_t symndx = gnu.symbol_index();
+  const std::vector<uint32_t>& hash_values = gnu.hash_values();
+
+  uint32_t idx = gnu.buckets()[hash % gnu.nb_buckets()];
+  if (idx < symndx) {
+    return nullptr;
+  }
+
+  for (; idx < this->dynamic_symbols_.size() and (idx - symndx) < hash_values.size(); ++idx) {
+    const uint32_t chain_hash = hash_values[idx - symndx];
+    const Symbol& symbol = *this->dynamic_symbols_[idx];
+    if ((hash | 1) == (chain_hash | 1) and symbol.name() == name and is_defined(symbol)) {
+      return &symbol;
+    }
+
+    // The last entry of a chain has its lowest bit set
+    if ((chain_hash & 1) != 0) {
+      break;
+    }
+  }
+  return nullptr;
+}
+
+// See: https://github.com/lattera/glibc/blob/master/elf/dl-lookup.c#L402
+const Symbol* Binary::sysv_hash_lookup(const std::string& name) const {
+  const std::vector<uint32_t>& buckets = this->sysv_hash_.buckets();
+  const std::vector<uint32_t>& chains  = this->sysv_hash_.chains();
+  const uint32_t hash = static_cast<uint32_t>(hash32(name.c_str()));
+
+  uint32_t idx = buckets[hash % buckets.size()];
+  // A well-formed chain can't be longer than the number of symbols
+  for (size_t i = 0; idx != 0 and i < chains.size(); ++i) {
+    if (idx >= this->dynamic_symbols_.size() or idx >= chains.size()) {
+      return nullptr;
+    }
+    const Symbol& symbol = *this->dynamic_symbols_[idx];
+    if (symbol.name() == name and is_defined(symbol)) {
+      return &symbol;
+    }
+    idx = chains[idx];
+  }
+  return nullptr;
+}
+
 bool Binary::has_static_symbol(const std::string& name) const {
-  auto&& it_symbol = std::find_if(
-      std::begin(this->static_symbols_),
-      std::end(this->static_symbols_),
-      [&name] (const Symbol* s) {
-        return s->name() == name;
-      });
-  return it_symbol != std::end(this->static_symbols_);
+  return this->static_symbols_index().find(name) != nullptr;
 }
 
 const Symbol& Binary::get_static_symbol(const std::string& name) const {
-  if (not this->has_static_symbol(name)) {
+  const Symbol* symbol = this->static_symbols_index().find(name);
+  if (symbol == nullptr) {
     throw not_found("Symbol '" + name + "' not found!");
   }
-
-  auto&& it_symbol = std::find_if(
-      std::begin(this->static_symbols_),
-      std::end(this->static_symbols_),
-      [&name] (const Symbol* s) {
-        return s->name() == name;
-      });
-  return **it_symbol;
-
+  return *symbol;
 }
 
 
@@ -574,37 +730,34 @@ Binary::string_list_t Binary::strings(size_t min_size) const {
   }
 
   const Section& rodata = this->get_section(".rodata");
-  const std::vector<uint8_t>& data = rodata.content();
-  std::string current;
-  current.reserve(100);
-
-  for (size_t i = 0; i < data.size(); ++i) {
-    char c = static_cast<char>(data[i]);
-
-    // Terminator
-    if (c == '\0') {
-      if (current.size() >= min_size) {
-        list.push_back(std::move(current));
-        continue;
-      }
-      current.clear();
+  std::vector<uint8_t> buffer;
+  const Section::content_view_t content = rodata.content_view(buffer);
+  const char* data = reinterpret_cast<const char*>(content.data);
+
+  for (const StringEntry& entry : LIEF::extract_strings(content.data, content.size, min_size, /* utf16 */ false)) {
+    // Only keep the null-terminated strings
+    const uint64_t end = entry.offset + entry.length;
+    if (end >= content.size or data[end] != '\0') {
       continue;
     }
 
-    // Valid char
-    if (not std::isprint(c)) {
-      current.clear();
-      continue;
+    // Tabulations are not accepted in this list
+    uint64_t start = entry.offset;
+    for (uint64_t i = start; i < end; ++i) {
+      if (data[i] == '\t') {
+        start = i + 1;
+      }
+    }
+    if (end - start >= min_size) {
+      list.emplace_back(data + start, end - start);
     }
-
-    current.push_back(c);
   }
 
-
   return list;
 }
 
 Symbol& Binary::get_static_symbol(const std::string& name) {
+  this->mark_modified(MODIFIED_STATIC_SYMBOLS);
   return const_cast<Symbol&>(static_cast<const Binary*>(this)->get_static_symbol(name));
 }
 
@@ -626,6 +779,7 @@ symbols_t Binary::static_dyn_symbols() const {
 // --------
 
 it_exported_symbols Binary::exported_symbols() {
+  this->mark_modified(MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS | MODIFIED_SYMBOL_VERSIONS);
 
   return {this->static_dyn_symbols(),
     [] (const Symbol* symbol) { return symbol->is_exported(); }
@@ -644,6 +798,7 @@ it_const_exported_symbols Binary::exported_symbols() const {
 // --------
 
 it_imported_symbols Binary::imported_symbols() {
+  this->mark_modified(MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS | MODIFIED_SYMBOL_VERSIONS);
   return {this->static_dyn_symbols(),
     [] (const Symbol* symbol) { return symbol->is_imported(); }
   };
@@ -660,10 +815,13 @@ it_const_imported_symbols Binary::imported_symbols() const {
 // --------------
 
 it_symbols_version Binary::symbols_version() {
+  this->mark_modified(MODIFIED_SYMBOL_VERSIONS);
+  this->load_symbol_versions();
   return this->symbol_version_table_;
 }
 
 it_const_symbols_version Binary::symbols_version() const {
+  this->load_symbol_versions();
   return this->symbol_version_table_;
 }
 
@@ -671,10 +829,13 @@ it_const_symbols_version Binary::symbols_version() const {
 // -------------------------
 
 it_symbols_version_definition Binary::symbols_version_definition() {
+  this->mark_modified(MODIFIED_SYMBOL_VERSIONS);
+  this->load_symbol_versions();
   return this->symbol_version_definition_;
 }
 
 it_const_symbols_version_definition Binary::symbols_version_definition() const {
+  this->load_symbol_versions();
   return this->symbol_version_definition_;
 }
 
@@ -682,10 +843,13 @@ it_const_symbols_version_definition Binary::symbols_version_definition() const {
 // --------------------------
 
 it_symbols_version_requirement Binary::symbols_version_requirement() {
+  this->mark_modified(MODIFIED_SYMBOL_VERSIONS);
+  this->load_symbol_versions();
   return this->symbol_version_requirements_;
 }
 
 it_const_symbols_version_requirement Binary::symbols_version_requirement() const {
+  this->load_symbol_versions();
   return this->symbol_version_requirements_;
 }
 
@@ -696,35 +860,28 @@ void Binary::remove_symbol(const std::string& name) {
 
 
 void Binary::remove_static_symbol(const std::string& name) {
-  auto&& it_symbol = std::find_if(
-      std::begin(this->static_symbols_),
-      std::end(this->static_symbols_),
-      [&name] (const Symbol* symbol) {
-        return symbol != nullptr and symbol->name() == name;
-      });
+  Symbol* symbol = this->static_symbols_index().find(name);
 
-  if (it_symbol == std::end(this->static_symbols_)) {
+  if (symbol == nullptr) {
     throw not_found("Can't find '" + name + "'");
   }
 
-  this->remove_static_symbol(*it_symbol);
+  this->remove_static_symbol(symbol);
 
 }
 
 void Binary::remove_static_symbol(Symbol* symbol) {
-  auto&& it_symbol = std::find_if(
-      std::begin(this->static_symbols_),
-      std::end(this->static_symbols_),
-      [&symbol] (const Symbol* sym) {
-        return sym != nullptr and sym != nullptr and *symbol == *sym;
-      });
+  this->mark_modified(MODIFIED_STATIC_SYMBOLS);
+  auto&& it_symbol = find_symbol(this->static_symbols_, this->static_symbols_index(), *symbol);
 
   if (it_symbol == std::end(this->static_symbols_)) {
     throw not_found("Can't find '" + symbol->name() + "'");
   }
 
-  delete *it_symbol;
+  Symbol* to_remove = *it_symbol;
   this->static_symbols_.erase(it_symbol);
+  this->static_symbols_index_->remove(*to_remove, this->static_symbols_);
+  this->symbols_pool_->destroy(to_remove);
 
   symbol = nullptr;
 }
@@ -732,28 +889,24 @@ void Binary::remove_static_symbol(Symbol* symbol) {
 
 
 void Binary::remove_dynamic_symbol(const std::string& name) {
-  auto&& it_symbol = std::find_if(
-      std::begin(this->dynamic_symbols_),
-      std::end(this->dynamic_symbols_),
-      [&name] (const Symbol* symbol) {
-        return symbol != nullptr and symbol->name() == name;
-      });
+  Symbol* symbol = this->dynamic_symbols_index().find(name);
 
-  if (it_symbol == std::end(this->dynamic_symbols_)) {
+  if (symbol == nullptr) {
     throw not_found("Can't find '" + name + "'");
   }
 
-  this->remove_dynamic_symbol(*it_symbol);
+  this->remove_dynamic_symbol(symbol);
 
 }
 
 void Binary::remove_dynamic_symbol(Symbol* symbol) {
-  auto&& it_symbol = std::find_if(
-      std::begin(this->dynamic_symbols_),
-      std::end(this->dynamic_symbols_),
-      [&symbol] (const Symbol* sym) {
-        return symbol != nullptr and sym != nullptr and *symbol == *sym;
-      });
+  this->mark_modified(MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_SYMBOL_VERSIONS | MODIFIED_RELOCATIONS);
+  this->load_relocations();
+  this->load_symbol_versions();
+  if (symbol == nullptr) {
+    throw not_found("Can't remove a null symbol");
+  }
+  auto&& it_symbol = find_symbol(this->dynamic_symbols_, this->dynamic_symbols_index(), *symbol);
 
   if (it_symbol == std::end(this->dynamic_symbols_)) {
     throw not_found("Can't find '" + symbol->name() + "'");
@@ -772,8 +925,9 @@ void Binary::remove_dynamic_symbol(Symbol* symbol) {
       });
 
   if (it_relocation != std::end(this->relocations_)) {
-    delete *it_relocation;
+    this->relocations_pool_->destroy(*it_relocation);
     this->relocations_.erase(it_relocation);
+    this->invalidate_address_index();
   } else {
   }
 
@@ -789,8 +943,9 @@ void Binary::remove_dynamic_symbol(Symbol* symbol) {
       });
 
   if (it_relocation != std::end(this->relocations_)) {
-    delete *it_relocation;
+    this->relocations_pool_->destroy(*it_relocation);
     this->relocations_.erase(it_relocation);
+    this->invalidate_address_index();
   }
 
   // Update symbol versions
@@ -800,12 +955,14 @@ void Binary::remove_dynamic_symbol(Symbol* symbol) {
           std::begin(this->symbol_version_table_),
           std::end(this->symbol_version_table_),
           symbol->symbol_version_));
-    delete symbol->symbol_version_;
+    this->symbol_versions_pool_->destroy(symbol->symbol_version_);
 
   }
 
-  delete *it_symbol;
+  Symbol* to_remove = *it_symbol;
   this->dynamic_symbols_.erase(it_symbol);
+  this->dynamic_symbols_index_->remove(*to_remove, this->dynamic_symbols_);
+  this->symbols_pool_->destroy(to_remove);
 
   symbol = nullptr;
 
@@ -819,6 +976,8 @@ void Binary::remove_dynamic_symbol(Symbol* symbol) {
 // --------
 
 it_dynamic_relocations Binary::dynamic_relocations() {
+  this->mark_modified(MODIFIED_RELOCATIONS | MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS);
+  this->load_relocations();
   return filter_iterator<relocations_t>{std::ref(this->relocations_),
     [] (const Relocation* reloc) {
       return reloc->purpose() == RELOCATION_PURPOSES::RELOC_PURPOSE_DYNAMIC;
@@ -827,6 +986,7 @@ it_dynamic_relocations Binary::dynamic_relocations() {
 }
 
 it_const_dynamic_relocations Binary::dynamic_relocations() const {
+  this->load_relocations();
   return const_filter_iterator<const relocations_t>{std::cref(this->relocations_),
     [] (const Relocation* reloc) {
       return reloc->purpose() == RELOCATION_PURPOSES::RELOC_PURPOSE_DYNAMIC;
@@ -836,10 +996,13 @@ it_const_dynamic_relocations Binary::dynamic_relocations() const {
 
 
 Relocation& Binary::add_dynamic_relocation(const Relocation& relocation) {
-  Relocation* relocation_ptr = new Relocation{relocation};
+  this->mark_modified(MODIFIED_RELOCATIONS | MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS);
+  this->load_relocations();
+  Relocation* relocation_ptr = this->relocations_pool_->create(relocation).release();
   relocation_ptr->purpose(RELOCATION_PURPOSES::RELOC_PURPOSE_DYNAMIC);
   relocation_ptr->architecture_ = this->header().machine_type();
   this->relocations_.push_back(relocation_ptr);
+  this->invalidate_address_index();
 
   // Add symbol
   if (relocation.has_symbol()) {
@@ -854,8 +1017,8 @@ Relocation& Binary::add_dynamic_relocation(const Relocation& relocation) {
     auto&& it_sym = std::find_if(
         std::begin(this->dynamic_symbols_),
         std::end(this->dynamic_symbols_),
-        [&inner_sym] (const Symbol* s) {
-          return s->name() == inner_sym->name();
+        [inner_sym] (const Symbol* s) {
+          return s->name() == static_cast<const Symbol*>(inner_sym)->name();
         });
     const size_t idx = std::distance(std::begin(this->dynamic_symbols_), it_sym);
     relocation_ptr->info(idx);
@@ -878,7 +1041,9 @@ Relocation& Binary::add_dynamic_relocation(const Relocation& relocation) {
 
 
 Relocation& Binary::add_pltgot_relocation(const Relocation& relocation) {
-  Relocation* relocation_ptr = new Relocation{relocation};
+  this->mark_modified(MODIFIED_RELOCATIONS | MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS);
+  this->load_relocations();
+  Relocation* relocation_ptr = this->relocations_pool_->create(relocation).release();
   relocation_ptr->purpose(RELOCATION_PURPOSES::RELOC_PURPOSE_PLTGOT);
   relocation_ptr->architecture_ = this->header().machine_type();
 
@@ -895,8 +1060,8 @@ Relocation& Binary::add_pltgot_relocation(const Relocation& relocation) {
     auto&& it_sym = std::find_if(
         std::begin(this->dynamic_symbols_),
         std::end(this->dynamic_symbols_),
-        [&inner_sym] (const Symbol* s) {
-          return s->name() == inner_sym->name();
+        [inner_sym] (const Symbol* s) {
+          return s->name() == static_cast<const Symbol*>(inner_sym)->name();
         });
     const size_t idx = std::distance(std::begin(this->dynamic_symbols_), it_sym);
     relocation_ptr->info(idx);
@@ -928,10 +1093,13 @@ Relocation& Binary::add_pltgot_relocation(const Relocation& relocation) {
   }
 
   this->relocations_.push_back(relocation_ptr);
+  this->invalidate_address_index();
   return *relocation_ptr;
 }
 
 Relocation* Binary::add_object_relocation(const Relocation& relocation, const Section& section) {
+  this->mark_modified(MODIFIED_RELOCATIONS | MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS);
+  this->load_relocations();
   const auto it_section = std::find_if(std::begin(sections_), std::end(sections_),
       [&section] (const Section* sec) { return &section == sec; });
 
@@ -941,17 +1109,20 @@ Relocation* Binary::add_object_relocation(const Relocation& relocation, const Se
   }
 
 
-  Relocation* relocation_ptr = new Relocation{relocation};
+  Relocation* relocation_ptr = this->relocations_pool_->create(relocation).release();
   relocation_ptr->purpose(RELOCATION_PURPOSES::RELOC_PURPOSE_OBJECT);
   relocation_ptr->architecture_ = this->header().machine_type();
   relocation_ptr->section_ = *it_section;
   this->relocations_.push_back(relocation_ptr);
+  this->invalidate_address_index();
   return relocation_ptr;
 }
 
 // plt/got
 // -------
 it_pltgot_relocations Binary::pltgot_relocations() {
+  this->mark_modified(MODIFIED_RELOCATIONS | MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS);
+  this->load_relocations();
   return filter_iterator<relocations_t>{std::ref(this->relocations_),
     [] (const Relocation* reloc) {
       return reloc->purpose() == RELOCATION_PURPOSES::RELOC_PURPOSE_PLTGOT;
@@ -960,6 +1131,7 @@ it_pltgot_relocations Binary::pltgot_relocations() {
 }
 
 it_const_pltgot_relocations Binary::pltgot_relocations() const {
+  this->load_relocations();
   return const_filter_iterator<const relocations_t>{std::cref(this->relocations_),
     [] (const Relocation* reloc) {
       return reloc->purpose() == RELOCATION_PURPOSES::RELOC_PURPOSE_PLTGOT;
@@ -971,6 +1143,8 @@ it_const_pltgot_relocations Binary::pltgot_relocations() const {
 // objects
 // -------
 it_object_relocations Binary::object_relocations() {
+  this->mark_modified(MODIFIED_RELOCATIONS | MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS);
+  this->load_relocations();
   return filter_iterator<relocations_t>{std::ref(this->relocations_),
     [] (const Relocation* reloc) {
       return reloc->purpose() == RELOCATION_PURPOSES::RELOC_PURPOSE_OBJECT;
@@ -979,6 +1153,7 @@ it_object_relocations Binary::object_relocations() {
 }
 
 it_const_object_relocations Binary::object_relocations() const {
+  this->load_relocations();
   return const_filter_iterator<const relocations_t>{std::cref(this->relocations_),
     [] (const Relocation* reloc) {
       return reloc->purpose() == RELOCATION_PURPOSES::RELOC_PURPOSE_OBJECT;
@@ -989,14 +1164,19 @@ it_const_object_relocations Binary::object_relocations() const {
 // All relocations
 // ---------------
 it_relocations Binary::relocations() {
+  this->mark_modified(MODIFIED_RELOCATIONS | MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS);
+  this->load_relocations();
   return this->relocations_;
 }
 
 it_const_relocations Binary::relocations() const {
+  this->load_relocations();
   return this->relocations_;
 }
 
 LIEF::relocations_t Binary::get_abstract_relocations() {
+  this->mark_modified(MODIFIED_RELOCATIONS | MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS);
+  this->load_relocations();
   LIEF::relocations_t relocations;
   relocations.reserve(this->relocations_.size());
   std::copy(
@@ -1009,6 +1189,9 @@ LIEF::relocations_t Binary::get_abstract_relocations() {
 
 
 LIEF::symbols_t Binary::get_abstract_symbols() {
+  this->mark_modified(MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS | MODIFIED_SYMBOL_VERSIONS);
+  this->load_static_symbols();
+  this->load_symbol_versions();
   LIEF::symbols_t symbols;
   symbols.reserve(this->dynamic_symbols_.size() + this->static_symbols_.size());
   std::copy(
@@ -1142,6 +1325,7 @@ uint64_t Binary::get_function_address(const std::string& func_name) const {
 }
 
 uint64_t Binary::get_function_address(const std::string& func_name, bool demangled) const {
+  this->load_static_symbols();
   auto&& it_symbol = std::find_if(
       std::begin(this->static_symbols_),
       std::end(this->static_symbols_),
@@ -1167,6 +1351,8 @@ uint64_t Binary::get_function_address(const std::string& func_name, bool demangl
 }
 
 Section& Binary::add(const Section& section, bool loaded) {
+  this->mark_modified(MODIFIED_ALL);
+  this->load_deferred();
   if (loaded) {
     return this->add_section<true>(section);
   } else {
@@ -1209,6 +1395,8 @@ bool Binary::has_nx() const {
 }
 
 Segment& Binary::add(const Segment& segment, uint64_t base) {
+  this->mark_modified(MODIFIED_ALL);
+  this->load_deferred();
   uint64_t new_base = base;
 
   if (new_base == 0) {
@@ -1237,7 +1425,9 @@ Segment& Binary::add(const Segment& segment, uint64_t base) {
 
 
 Segment& Binary::replace(const Segment& new_segment, const Segment& original_segment, uint64_t base) {
+  this->mark_modified(MODIFIED_ALL);
 
+  this->load_deferred();
   auto&& it_original_segment = std::find_if(
       std::begin(this->segments_),
       std::end(this->segments_),
@@ -1314,6 +1504,7 @@ Segment& Binary::replace(const Segment& new_segment, const Segment& original_seg
 
   delete local_original_segment;
   this->segments_.erase(it_original_segment);
+  this->invalidate_address_index();
 
   // Patch shdr
   Header& header = this->header();
@@ -1321,6 +1512,7 @@ Segment& Binary::replace(const Segment& new_segment, const Segment& original_seg
   header.section_headers_offset(new_section_hdr_offset);
 
   this->segments_.push_back(new_segment_ptr);
+  this->invalidate_address_index();
   return *this->segments_.back();
 
 
@@ -1328,6 +1520,8 @@ Segment& Binary::replace(const Segment& new_segment, const Segment& original_seg
 
 
 Segment& Binary::extend(const Segment& segment, uint64_t size) {
+  this->mark_modified(MODIFIED_ALL);
+  this->load_deferred();
   const SEGMENT_TYPES type = segment.type();
   switch (type) {
     case SEGMENT_TYPES::PT_PHDR:
@@ -1346,6 +1540,8 @@ Segment& Binary::extend(const Segment& segment, uint64_t size) {
 
 
 Section& Binary::extend(const Section& section, uint64_t size) {
+  this->mark_modified(MODIFIED_ALL);
+  this->load_deferred();
   auto&& it_section = std::find_if(
       std::begin(this->sections_),
       std::end(this->sections_),
@@ -1422,9 +1618,15 @@ void Binary::patch_address(uint64_t address, const std::vector<uint8_t>& patch_v
   // Object file does not have segments
   if (this->header().file_type() == E_TYPE::ET_REL) {
     Section& section = this->section_from_offset(address);
-    std::vector<uint8_t> content = section.content();
     const uint64_t offset = address - section.file_offset();
 
+    // Fast path: patch the data handler in place
+    if (section.datahandler_ != nullptr and (offset + patch_value.size()) <= section.size()) {
+      this->datahandler_->write(section.file_offset() + offset, patch_value.data(), patch_value.size());
+      return;
+    }
+
+    std::vector<uint8_t> content = section.content();
     if ((offset + patch_value.size()) > content.size()) {
       content.resize(offset + patch_value.size());
     }
@@ -1440,6 +1642,12 @@ void Binary::patch_address(uint64_t address, const std::vector<uint8_t>& patch_v
   // Find the segment associated with the virtual address
   Segment& segment_topatch = this->segment_from_virtual_address(address);
   const uint64_t offset = address - segment_topatch.virtual_address();
+
+  if (segment_topatch.datahandler_ != nullptr and (offset + patch_value.size()) <= segment_topatch.physical_size()) {
+    this->datahandler_->write(segment_topatch.file_offset() + offset, patch_value.data(), patch_value.size());
+    return;
+  }
+
   std::vector<uint8_t> content = segment_topatch.content();
   if ((offset + patch_value.size()) > content.size()) {
     content.resize(offset + patch_value.size());
@@ -1460,9 +1668,16 @@ void Binary::patch_address(uint64_t address, uint64_t patch_value, size_t size,
   // Object file does not have segments
   if (this->header().file_type() == E_TYPE::ET_REL) {
     Section& section = this->section_from_offset(address);
-    std::vector<uint8_t> content = section.content();
     const uint64_t offset = address - section.file_offset();
 
+    // Fast path: patch the data handler in place
+    if (section.datahandler_ != nullptr and (offset + size) <= section.size()) {
+      this->datahandler_->write(section.file_offset() + offset, reinterpret_cast<uint8_t*>(&patch_value), size);
+      return;
+    }
+
+    std::vector<uint8_t> content = section.content();
+
     // TODO: Handle Endiness
     std::copy(
         reinterpret_cast<uint8_t*>(&patch_value),
@@ -1475,6 +1690,12 @@ void Binary::patch_address(uint64_t address, uint64_t patch_value, size_t size,
 
   Segment& segment_topatch = this->segment_from_virtual_address(address);
   const uint64_t offset = address - segment_topatch.virtual_address();
+
+  if (segment_topatch.datahandler_ != nullptr and (offset + size) <= segment_topatch.physical_size()) {
+    this->datahandler_->write(segment_topatch.file_offset() + offset, reinterpret_cast<uint8_t*>(&patch_value), size);
+    return;
+  }
+
   std::vector<uint8_t> content = segment_topatch.content();
 
   // TODO: Handle Endiness
@@ -1517,24 +1738,15 @@ void Binary::patch_pltgot(const std::string& symbol_name, uint64_t address) {
 
 
 const Segment& Binary::segment_from_virtual_address(uint64_t address) const {
-  auto&& it_segment = std::find_if(
-      this->segments_.cbegin(),
-      this->segments_.cend(),
-      [&address] (const Segment* segment) {
-        if (segment == nullptr) {
-          return false;
-        }
-        return ((segment->virtual_address() <= address) and
-            (segment->virtual_address() + segment->virtual_size()) > address);
-      });
+  const Segment* segment = this->address_index(IndexTracker::SEGMENTS).segment_from_virtual_address(address);
 
-  if (it_segment == this->segments_.cend()) {
+  if (segment == nullptr) {
     std::stringstream adr_str;
     adr_str << "0x" << std::hex << address;
     throw not_found("Unable to find the segment associated with the address: " + adr_str.str());
   }
 
-  return **it_segment;
+  return *segment;
 
 }
 
@@ -1544,23 +1756,13 @@ Segment& Binary::segment_from_virtual_address(uint64_t address) {
 
 
 const Segment& Binary::segment_from_offset(uint64_t offset) const {
-  auto&& it_segment = std::find_if(
-      this->segments_.cbegin(),
-      this->segments_.cend(),
-      [&offset] (const Segment* segment) {
-        if (segment == nullptr) {
-          return false;
-        }
+  const Segment* segment = this->address_index(IndexTracker::SEGMENTS).segment_from_offset(offset);
 
-        return ((segment->file_offset() <= offset) and
-            (segment->file_offset() + segment->physical_size()) > offset);
-      });
-
-  if (it_segment == this->segments_.cend()) {
+  if (segment == nullptr) {
     throw not_found("Unable to find the segment");
   }
 
-  return **it_segment;
+  return *segment;
 }
 
 Segment& Binary::segment_from_offset(uint64_t offset) {
@@ -1581,36 +1783,30 @@ bool Binary::has_section(const std::string& name) const {
 }
 
 bool Binary::has_section_with_offset(uint64_t offset) const {
-  auto&& it_section = std::find_if(
-      this->sections_.cbegin(),
-      this->sections_.cend(),
-      [&offset] (const Section* section) {
-        if (section == nullptr) {
-          return false;
-        }
-        return ((section->offset() <= offset) and
-            (section->offset() + section->size()) > offset);
-      });
-  return it_section != this->sections_.cend();
+  return this->address_index(IndexTracker::SECTIONS).section_from_offset(offset, /* skip_nobits */ false) != nullptr;
 }
 
 bool Binary::has_section_with_va(uint64_t va) const {
-  auto&& it_section = std::find_if(
-      this->sections_.cbegin(),
-      this->sections_.cend(),
-      [&va] (const Section* section) {
-        if (section == nullptr) {
-          return false;
-        }
-        return (section->virtual_address() != 0 and
-                (section->virtual_address() <= va) and
-                (section->virtual_address() + section->size()) > va);
-      });
-  return it_section != this->sections_.cend();
+  return this->address_index(IndexTracker::SECTIONS).section_from_virtual_address(va, /* skip_nobits */ false) != nullptr;
 }
 
 void Binary::strip() {
+  this->mark_modified(MODIFIED_STATIC_SYMBOLS | MODIFIED_RELOCATIONS);
+  this->load_static_symbols();
+  this->load_relocations();
+
+  // The object relocations can't reference a symbol that is no longer in the table
+  std::unordered_set<const Symbol*> stripped{std::begin(this->static_symbols_), std::end(this->static_symbols_)};
+  for (Relocation* relocation : this->relocations_) {
+    if (stripped.count(relocation->symbol_) > 0) {
+      relocation->symbol_ = nullptr;
+    }
+  }
+
+  this->stripped_symbols_.insert(std::end(this->stripped_symbols_),
+      std::begin(this->static_symbols_), std::end(this->static_symbols_));
   this->static_symbols_ = {};
+  this->index_tracker_->changed(IndexTracker::STATIC_SYMBOLS);
 
   //for (Section* sec : this->sections_) {
   //  if (sec->segments().size() == 0 and sec->name() != ".shstrtab" and sec->type() != ELF_SECTION_TYPES::SHT_NULL) {
@@ -1626,47 +1822,41 @@ void Binary::strip() {
 
 
 Symbol& Binary::add_static_symbol(const Symbol& symbol) {
-  this->static_symbols_.push_back(new Symbol{symbol});
+  this->mark_modified(MODIFIED_STATIC_SYMBOLS);
+  this->load_static_symbols();
+  this->static_symbols_.push_back(this->symbols_pool_->create(symbol).release());
+  this->static_symbols_index_->add(*this->static_symbols_.back());
   return *(this->static_symbols_.back());
 }
 
 
 Symbol& Binary::add_dynamic_symbol(const Symbol& symbol, const SymbolVersion* version) {
-  Symbol* sym = new Symbol{symbol};
+  this->mark_modified(MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_SYMBOL_VERSIONS);
+  this->load_symbol_versions();
+  Symbol* sym = this->symbols_pool_->create(symbol).release();
   SymbolVersion* symver = nullptr;
   if (version == nullptr) {
-    symver = new SymbolVersion{SymbolVersion::global()};
+    symver = this->symbol_versions_pool_->create(SymbolVersion::global()).release();
   } else {
-    symver = new SymbolVersion{*version};
+    symver = this->symbol_versions_pool_->create(*version).release();
   }
 
   sym->symbol_version_ = symver;
 
   this->dynamic_symbols_.push_back(sym);
   this->symbol_version_table_.push_back(symver);
+  this->dynamic_symbols_index_->add(*sym);
   return *(this->dynamic_symbols_.back());
 }
 
 uint64_t Binary::virtual_address_to_offset(uint64_t virtual_address) const {
-  const auto it_segment = std::find_if(
-      std::begin(this->segments_), std::end(this->segments_),
-      [virtual_address] (const Segment* segment)
-      {
-        if (segment == nullptr) {
-          return false;
-        }
-        return (
-          segment->type() == SEGMENT_TYPES::PT_LOAD and
-          segment->virtual_address() <= virtual_address and
-          segment->virtual_address() + segment->virtual_size() > virtual_address
-          );
-      });
+  const Segment* segment = this->address_index(IndexTracker::SEGMENTS).segment_from_virtual_address(virtual_address, /* load_only */ true);
 
-  if (it_segment == std::end(this->segments_)) {
+  if (segment == nullptr) {
     LIEF_DEBUG("Address: 0x{:x}", virtual_address);
     throw conversion_error("Invalid virtual address");
   }
-  uint64_t baseAddress = (*it_segment)->virtual_address() - (*it_segment)->file_offset();
+  uint64_t baseAddress = segment->virtual_address() - segment->file_offset();
   uint64_t offset      = virtual_address - baseAddress;
 
   return offset;
@@ -1674,27 +1864,16 @@ uint64_t Binary::virtual_address_to_offset(uint64_t virtual_address) const {
 }
 
 uint64_t Binary::offset_to_virtual_address(uint64_t offset, uint64_t slide) const {
-  const auto it_segment = std::find_if(
-      std::begin(this->segments_), std::end(this->segments_),
-      [offset] (const Segment* segment) {
-        if (segment == nullptr) {
-          return false;
-        }
-        return (
-          segment->type() == SEGMENT_TYPES::PT_LOAD and
-          segment->file_offset() <= offset and
-          segment->file_offset() + segment->physical_size() > offset
-          );
-      });
+  const Segment* segment = this->address_index(IndexTracker::SEGMENTS).segment_from_offset(offset, /* load_only */ true);
 
-  if (it_segment == std::end(this->segments_)) {
+  if (segment == nullptr) {
     if (slide > 0) {
       return slide + offset;
     }
     return this->imagebase() + offset;
   }
 
-  const uint64_t base_address = (*it_segment)->virtual_address() - (*it_segment)->file_offset();
+  const uint64_t base_address = segment->virtual_address() - segment->file_offset();
   if (slide > 0) {
     return (base_address - this->imagebase()) + slide + offset;
   }
@@ -1724,6 +1903,7 @@ const std::string& Binary::interpreter() const {
 }
 
 void Binary::interpreter(const std::string& interpreter) {
+  this->mark_modified(MODIFIED_INTERPRETER);
   this->interpreter_ = interpreter;
 }
 
@@ -1741,21 +1921,13 @@ uint64_t Binary::entrypoint() const {
 
 
 const Section& Binary::section_from_offset(uint64_t offset, bool skip_nobits) const {
-  auto&& it_section = std::find_if(
-      this->sections_.cbegin(), this->sections_.cend(),
-      [offset, skip_nobits] (const Section* section) {
-        if (skip_nobits and section->type() == ELF_SECTION_TYPES::SHT_NOBITS) {
-          return false;
-        }
-        return ((section->offset() <= offset) and
-            (section->offset() + section->size()) > offset);
-      });
+  const Section* section = this->address_index(IndexTracker::SECTIONS).section_from_offset(offset, skip_nobits);
 
-  if (it_section == this->sections_.cend()) {
+  if (section == nullptr) {
     throw not_found("Unable to find the section");
   }
 
-  return **it_section;
+  return *section;
 }
 
 Section& Binary::section_from_offset(uint64_t offset, bool skip_nobits) {
@@ -1764,22 +1936,13 @@ Section& Binary::section_from_offset(uint64_t offset, bool skip_nobits) {
 
 
 const Section& Binary::section_from_virtual_address(uint64_t address, bool skip_nobits) const {
-  auto&& it_section = std::find_if(
-      this->sections_.cbegin(), this->sections_.cend(),
-      [address, skip_nobits] (const Section* section) {
-        if (skip_nobits and section->type() == ELF_SECTION_TYPES::SHT_NOBITS) {
-          return false;
-        }
-        return ((section->virtual_address() != 0) and
-                (section->virtual_address() <= address) and
-                (section->virtual_address() + section->size()) > address);
-      });
+  const Section* section = this->address_index(IndexTracker::SECTIONS).section_from_virtual_address(address, skip_nobits);
 
-  if (it_section == this->sections_.cend()) {
+  if (section == nullptr) {
     throw not_found("Unable to find the section");
   }
 
-  return **it_section;
+  return *section;
 }
 
 Section& Binary::section_from_virtual_address(uint64_t address, bool enforce_nobits) {
@@ -1818,6 +1981,7 @@ const DynamicEntry& Binary::get(DYNAMIC_TAGS tag) const {
 }
 
 DynamicEntry& Binary::get(DYNAMIC_TAGS tag) {
+  this->mark_modified(MODIFIED_DYNAMIC_ENTRIES);
   return const_cast<DynamicEntry&>(static_cast<const Binary*>(this)->get(tag));
 }
 
@@ -1857,6 +2021,7 @@ Segment& Binary::get(SEGMENT_TYPES type) {
 }
 
 const Note& Binary::get(NOTE_TYPES type) const {
+  this->load_notes();
 
   if (not this->has(type)) {
     throw not_found("Unable to find a note of type '" + std::string(to_string(type)) + "'.");
@@ -1875,6 +2040,7 @@ const Note& Binary::get(NOTE_TYPES type) const {
 
 
 Note& Binary::get(NOTE_TYPES type) {
+  this->mark_modified(MODIFIED_NOTES);
   return const_cast<Note&>(static_cast<const Binary*>(this)->get(type));
 }
 
@@ -1916,6 +2082,7 @@ bool Binary::has(SEGMENT_TYPES type) const {
 
 
 bool Binary::has(NOTE_TYPES type) const {
+  this->load_notes();
   auto&& it_note = std::find_if(
       std::begin(this->notes_),
       std::end(this->notes_),
@@ -1942,6 +2109,8 @@ bool Binary::has(ELF_SECTION_TYPES type) const {
 
 
 void Binary::permute_dynamic_symbols(const std::vector<size_t>& permutation) {
+  this->mark_modified(MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_SYMBOL_VERSIONS | MODIFIED_RELOCATIONS);
+  this->load_symbol_versions();
   std::set<size_t> done;
   for (size_t i = 0; i < permutation.size(); ++i) {
     if (permutation[i] == i or done.count(permutation[i]) > 0 or done.count(permutation[i]) > 0) {
@@ -1962,6 +2131,7 @@ void Binary::permute_dynamic_symbols(const std::vector<size_t>& permutation) {
     }
 
   }
+  this->invalidate_symbols_index();
 }
 
 LIEF::Header Binary::get_abstract_header() const {
@@ -1984,6 +2154,7 @@ LIEF::Header Binary::get_abstract_header() const {
 
 
 bool Binary::has_notes() const {
+  this->load_notes();
   auto&& it_segment_note = std::find_if(
       std::begin(this->segments_),
       std::end(this->segments_),
@@ -1995,10 +2166,13 @@ bool Binary::has_notes() const {
 }
 
 it_const_notes Binary::notes() const {
+  this->load_notes();
   return this->notes_;
 }
 
 it_notes Binary::notes() {
+  this->mark_modified(MODIFIED_NOTES);
+  this->load_notes();
   return this->notes_;
 }
 
@@ -2254,6 +2428,7 @@ void Binary::remove_library(const std::string& library_name) {
 
 
 DynamicEntryLibrary& Binary::get_library(const std::string& library_name) {
+  this->mark_modified(MODIFIED_DYNAMIC_ENTRIES);
   return const_cast<DynamicEntryLibrary&>(static_cast<const Binary*>(this)->get_library(library_name));
 }
 
@@ -2365,26 +2540,17 @@ LIEF::Binary::functions_t Binary::dtor_functions() const {
 
 
 const Relocation* Binary::get_relocation(uint64_t address) const {
-  auto&& it = std::find_if(
-      std::begin(this->relocations_),
-      std::end(this->relocations_),
-      [address] (const Relocation* r) {
-        return r->address() == address;
-      });
-
-  if (it != std::end(this->relocations_)) {
-    return *it;
-  }
-
-  return nullptr;
-
+  this->load_relocations();
+  return this->address_index(IndexTracker::RELOCATIONS).relocation_from_address(address);
 }
 
 Relocation* Binary::get_relocation(uint64_t address) {
+  this->mark_modified(MODIFIED_RELOCATIONS | MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS);
   return const_cast<Relocation*>(static_cast<const Binary*>(this)->get_relocation(address));
 }
 
 const Relocation* Binary::get_relocation(const Symbol& symbol) const {
+  this->load_relocations();
   auto&& it = std::find_if(
       std::begin(this->relocations_),
       std::end(this->relocations_),
@@ -2400,6 +2566,7 @@ const Relocation* Binary::get_relocation(const Symbol& symbol) const {
 }
 
 Relocation* Binary::get_relocation(const Symbol& symbol) {
+  this->mark_modified(MODIFIED_RELOCATIONS | MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS);
   return const_cast<Relocation*>(static_cast<const Binary*>(this)->get_relocation(symbol));
 }
 
@@ -2411,6 +2578,7 @@ const Relocation* Binary::get_relocation(const std::string& symbol_name) const {
 }
 
 Relocation* Binary::get_relocation(const std::string& symbol_name) {
+  this->mark_modified(MODIFIED_RELOCATIONS | MODIFIED_DYNAMIC_SYMBOLS | MODIFIED_STATIC_SYMBOLS);
   return const_cast<Relocation*>(static_cast<const Binary*>(this)->get_relocation(symbol_name));
 }
 
@@ -2994,9 +3162,83 @@ std::ostream& Binary::print(std::ostream& os) const {
 
 
 
+const AddressIndex& Binary::address_index(uint32_t kinds) const {
+  return this->address_index_->refresh(kinds);
+}
+
+void Binary::invalidate_address_index() {
+  this->index_tracker_->changed(IndexTracker::ALL & ~IndexTracker::DYNAMIC_HASH);
+}
+
+SymbolsIndex<Symbol>& Binary::dynamic_symbols_index() const {
+  this->load_symbol_versions();
+  return *this->dynamic_symbols_index_;
+}
+
+SymbolsIndex<Symbol>& Binary::static_symbols_index() const {
+  this->load_static_symbols();
+  return *this->static_symbols_index_;
+}
+
+void Binary::invalidate_symbols_index() {
+  this->index_tracker_->changed(IndexTracker::SYMBOLS | IndexTracker::STATIC_SYMBOLS | IndexTracker::DYNAMIC_HASH);
+}
+
+void Binary::load_deferred(void (Parser::*parse)()) const {
+  if (not this->has_deferred_.load(std::memory_order_acquire)) {
+    return;
+  }
+  std::lock_guard<std::recursive_mutex> lock{this->deferred_mutex_};
+  // Already loaded by another thread or re-entrant call from the parser
+  if (this->parser_ == nullptr) {
+    return;
+  }
+  // The parser is detached while it runs so that the accessors it uses do
+  // not re-enter it
+  std::unique_ptr<Parser> parser = std::move(this->parser_);
+  // Loading a table is not a modification
+  const uint32_t modified = this->modified_;
+  ((*parser).*parse)();
+  this->modified_ = modified;
+  if (parser->has_deferred()) {
+    this->parser_ = std::move(parser);
+  } else {
+    this->has_deferred_.store(false, std::memory_order_release);
+  }
+}
+
+void Binary::mark_modified(uint32_t tables) {
+  this->load_deferred();
+  this->modified_ |= tables;
+}
+
+void Binary::load_static_symbols() const {
+  this->load_deferred(&Parser::parse_deferred_static_symbols);
+}
+
+void Binary::load_relocations() const {
+  this->load_deferred(&Parser::parse_deferred_relocations);
+}
+
+void Binary::load_symbol_versions() const {
+  this->load_deferred(&Parser::parse_deferred_symbol_versions);
+}
+
+void Binary::load_notes() const {
+  this->load_deferred(&Parser::parse_deferred_notes);
+}
+
+void Binary::load_deferred() const {
+  this->load_static_symbols();
+  this->load_relocations();
+  this->load_symbol_versions();
+  this->load_notes();
+}
+
+
 Binary::~Binary() {
   for (Relocation* relocation : this->relocations_) {
-    delete relocation;
+    this->relocations_pool_->destroy(relocation);
   }
 
   for (Section* section : this->sections_) {
@@ -3012,15 +3254,19 @@ Binary::~Binary() {
   }
 
   for (Symbol* symbol : this->dynamic_symbols_) {
-    delete symbol;
+    this->symbols_pool_->destroy(symbol);
   }
 
   for (Symbol* symbol : this->static_symbols_) {
-    delete symbol;
+    this->symbols_pool_->destroy(symbol);
+  }
+
+  for (Symbol* symbol : this->stripped_symbols_) {
+    this->symbols_pool_->destroy(symbol);
   }
 
   for (SymbolVersion* symbol_version : this->symbol_version_table_) {
-    delete symbol_version;
+    this->symbol_versions_pool_->destroy(symbol_version);
   }
 
   for (SymbolVersionDefinition* svd : this->symbol_version_definition_) {
@@ -431,6 +431,7 @@ Segment& Binary::add_segment<E_TYPE::ET_EXEC>(const Segment& segment, uint64_t b
     const size_t idx = std::distance(std::begin(this->segments_), it_new_segment_place.base());
     this->segments_.insert(std::begin(this->segments_) + idx, new_segment);
   }
+  this->invalidate_address_index();
 
   return *new_segment;
 }
@@ -549,6 +550,7 @@ Segment& Binary::add_segment<E_TYPE::ET_DYN>(const Segment& segment, uint64_t ba
     const size_t idx = std::distance(std::begin(this->segments_), it_new_segment_place.base());
     this->segments_.insert(std::begin(this->segments_) + idx, new_segment);
   }
+  this->invalidate_address_index();
 
   return *new_segment;
 }
@@ -661,6 +663,7 @@ Section& Binary::add_section<true>(const Section& section) {
   this->header().numberof_sections(this->header().numberof_sections() + 1);
 
   this->sections_.push_back(new_section);
+  this->invalidate_address_index();
   return *(this->sections_.back());
 }
 
@@ -696,6 +699,7 @@ Section& Binary::add_section<false>(const Section& section) {
   header.section_headers_offset(new_section_hdr_offset);
 
   this->sections_.push_back(new_section);
+  this->invalidate_address_index();
   return *(this->sections_.back());
 }
 
@@ -20,11 +20,28 @@
 #include <stdexcept>
 #include <functional>
 #include <map>
+#include <cstdio>
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#endif
+
+#if defined(__linux__)
+#include <climits>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <sys/syscall.h>
+#endif
 
 #include "LIEF/exception.hpp"
 #include "LIEF/utils.hpp"
 #include "LIEF/BinaryStream/VectorStream.hpp"
 #include "LIEF/ELF/Builder.hpp"
+#include "LIEF/ELF/Parser.hpp"
+#include "LIEF/ELF/DataHandler/Handler.hpp"
 
 #include "LIEF/ELF/Binary.hpp"
 #include "LIEF/ELF/Section.hpp"
@@ -44,6 +61,8 @@
 #include "LIEF/ELF/SymbolVersionAuxRequirement.hpp"
 #include "LIEF/ELF/Note.hpp"
 
+#include "index_tracker.hpp"
+
 #include "Builder.tcc"
 
 namespace LIEF {
@@ -56,10 +75,15 @@ Builder::Builder(Binary *binary) :
   empties_gnuhash_{false},
   binary_{binary}
 {
-  this->ios_.reserve(binary->original_size());
   this->ios_.set_endian_swap(this->should_swap());
 }
 
+Builder::extent_t::extent_t(uint64_t size, std::shared_ptr<const std::vector<uint8_t>> buffer, uint64_t source) :
+  size{size},
+  buffer{std::move(buffer)},
+  source{source}
+{}
+
 
 bool Builder::should_swap() const {
   switch (this->binary_->header().abstract_endianness()) {
@@ -79,35 +103,377 @@ bool Builder::should_swap() const {
 
 
 void Builder::build() {
+  // The tables skipped by the parser must be present in the output
+  // if they are regenerated
+  if (this->binary_->modified_ != Binary::MODIFIED_NONE) {
+    this->binary_->load_deferred();
+  }
+  this->is_in_place_ = false;
+  this->patches_.clear();
+  this->extents_.clear();
+  this->ios_.raw().clear();
+  this->ios_.seekp(0);
   if(this->binary_->type() == ELF_CLASS::ELFCLASS32) {
     this->build<ELF32>();
   } else {
     this->build<ELF64>();
   }
+
+  if (this->is_in_place_) {
+    // The result of an in-place build is the content of the data handler
+    this->emit_content(0, 0, this->binary_->datahandler_->size());
+  }
 }
 
 const std::vector<uint8_t>& Builder::get_build() {
+  if (this->ios_.size() == 0 and not this->extents_.empty()) {
+    std::vector<uint8_t> output(this->build_size(), 0);
+    for (const DataHandler::Handler::Extent& range : this->ranges()) {
+      if (range.data != nullptr) {
+        std::memcpy(output.data() + range.offset, range.data, range.size);
+      }
+    }
+    this->ios_.write(std::move(output));
+  }
   return this->ios_.raw();
 }
 
+void Builder::emit(uint64_t offset, std::vector<uint8_t> data) {
+  if (data.empty()) {
+    return;
+  }
+  const uint64_t size = data.size();
+  this->place(offset, extent_t{size, std::make_shared<const std::vector<uint8_t>>(std::move(data)), 0});
+}
+
+void Builder::emit_content(uint64_t offset, uint64_t content_offset, uint64_t size) {
+  if (size == 0) {
+    return;
+  }
+  this->place(offset, extent_t{size, nullptr, content_offset});
+}
+
+void Builder::place(uint64_t offset, extent_t extent) {
+  auto first = this->split(offset);
+  auto last  = this->split(offset + extent.size);
+  auto it    = this->extents_.erase(first, last);
+  this->extents_.emplace_hint(it, offset, std::move(extent));
+}
+
+Builder::extents_t::iterator Builder::split(uint64_t offset) {
+  auto it = this->extents_.upper_bound(offset);
+  if (it == std::begin(this->extents_)) {
+    return it;
+  }
+  auto prev = std::prev(it);
+  if (prev->first == offset) {
+    return prev;
+  }
+  extent_t& head = prev->second;
+  const uint64_t delta = offset - prev->first;
+  if (delta >= head.size) {
+    return it;
+  }
+  extent_t tail{head.size - delta, head.buffer, head.source + delta};
+  head.size = delta;
+  return this->extents_.emplace_hint(it, offset, std::move(tail));
+}
+
+uint64_t Builder::build_size() const {
+  if (this->extents_.empty()) {
+    return 0;
+  }
+  const auto& last = *this->extents_.rbegin();
+  return last.first + last.second.size;
+}
+
+std::vector<DataHandler::Handler::Extent> Builder::ranges() const {
+  using Extent = DataHandler::Handler::Extent;
+  const DataHandler::Handler& handler = *this->binary_->datahandler_;
+  std::vector<Extent> ranges;
+  ranges.reserve(this->extents_.size());
+
+  // Merge the ranges that are contiguous in the output and in their source
+  const auto push = [&ranges] (const Extent& range) {
+    if (not ranges.empty()) {
+      Extent& last = ranges.back();
+      const bool contiguous =
+        last.offset + last.size == range.offset and last.from_stream == range.from_stream and
+        (last.data == nullptr) == (range.data == nullptr) and
+        (last.data == nullptr or last.data + last.size == range.data) and
+        (not last.from_stream or last.stream_offset + last.size == range.stream_offset);
+      if (contiguous) {
+        last.size += range.size;
+        return;
+      }
+    }
+    ranges.push_back(range);
+  };
+
+  uint64_t pos = 0;
+  for (const auto& p : this->extents_) {
+    const uint64_t offset  = p.first;
+    const extent_t& extent = p.second;
+    if (pos < offset) {
+      push(Extent{pos, offset - pos, nullptr, /* from_stream */ false, 0});
+    }
+    if (extent.buffer != nullptr) {
+      push(Extent{offset, extent.size, extent.buffer->data() + extent.source, /* from_stream */ false, 0});
+    } else {
+      for (Extent range : handler.extents(extent.source, extent.size)) {
+        range.offset = offset + (range.offset - extent.source);
+        push(range);
+      }
+    }
+    pos = offset + extent.size;
+  }
+  return ranges;
+}
+
 
 Builder& Builder::empties_gnuhash(bool flag) {
   this->empties_gnuhash_ = flag;
   return *this;
 }
 
+Builder& Builder::threads(size_t nb_threads) {
+  this->threads_ = nb_threads;
+  return *this;
+}
+
+Builder& Builder::in_place(bool flag) {
+  this->in_place_ = flag;
+  return *this;
+}
+
+bool Builder::is_in_place() const {
+  return this->is_in_place_;
+}
+
+const Builder::patches_t& Builder::patches() const {
+  return this->patches_;
+}
+
 
 void Builder::write(const std::string& filename) const {
-  std::ofstream output_file{filename, std::ios::out | std::ios::binary | std::ios::trunc};
-  if (output_file) {
-    std::vector<uint8_t> content;
-    this->ios_.get(content);
+  DataHandler::Handler& handler = *this->binary_->datahandler_;
+  if (handler.is_mapping(filename)) {
+    // Truncating the file mapped by the binary would corrupt its content (or
+    // raise a SIGBUS) and it can't be opened for writing on Windows: the
+    // tables and the bytes that are still read from the mapping are loaded first
+    this->binary_->load_deferred();
+    handler.detach();
+  }
+  this->write_file(filename);
+}
+
+void Builder::write(std::ostream& os) const {
+  static const std::vector<uint8_t> zeros(64_KB, 0);
+  for (const DataHandler::Handler::Extent& range : this->ranges()) {
+    if (range.data != nullptr) {
+      os.write(reinterpret_cast<const char*>(range.data), range.size);
+      continue;
+    }
+    for (uint64_t done = 0; done < range.size; done += zeros.size()) {
+      const uint64_t size = std::min<uint64_t>(zeros.size(), range.size - done);
+      os.write(reinterpret_cast<const char*>(zeros.data()), size);
+    }
+  }
+}
+
+#if defined(__linux__)
+// Write the given memory ranges with as few pwritev() as possible
+static bool write_ranges(int fd, std::vector<struct iovec>& iov, uint64_t offset) {
+  size_t idx = 0;
+  while (idx < iov.size()) {
+    const int count = static_cast<int>(std::min<size_t>(iov.size() - idx, IOV_MAX));
+    const ssize_t written = ::pwritev(fd, iov.data() + idx, count, static_cast<off_t>(offset));
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    offset += written;
+    // Skip the iovec that have been entirely written (partial writes)
+    size_t remaining = static_cast<size_t>(written);
+    while (idx < iov.size() and remaining >= iov[idx].iov_len) {
+      remaining -= iov[idx].iov_len;
+      ++idx;
+    }
+    if (remaining > 0) {
+      iov[idx].iov_base = static_cast<uint8_t*>(iov[idx].iov_base) + remaining;
+      iov[idx].iov_len -= remaining;
+    }
+  }
+  iov.clear();
+  return true;
+}
+
+// Copy [src_offset, src_offset + size) from src_fd at offset in fd within the kernel
+static bool copy_range(int src_fd, uint64_t src_offset, int fd, uint64_t offset, uint64_t size) {
+#if defined(SYS_copy_file_range)
+  loff_t in  = static_cast<loff_t>(src_offset);
+  loff_t out = static_cast<loff_t>(offset);
+  while (size > 0) {
+    const long copied = ::syscall(SYS_copy_file_range, src_fd, &in, fd, &out, static_cast<size_t>(size), 0u);
+    if (copied < 0 and errno == EINTR) {
+      continue;
+    }
+    if (copied <= 0) {
+      return false;
+    }
+    size -= copied;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+#endif
+
+bool Builder::write_file(const std::string& path) const {
+#if defined(__linux__)
+  // Ranges of the original file smaller than this are written from the mapping
+  static constexpr uint64_t MIN_COPY_SIZE = 64_KB;
 
-    std::copy(
-        std::begin(content),
-        std::end(content),
-        std::ostreambuf_iterator<char>(output_file));
+  const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+  if (fd < 0) {
+    LIEF_ERR("Can't open '{}'", path);
+    return false;
+  }
+  int src_fd = this->binary_->datahandler_->stream_fd();
+
+  // The ranges owned by LIEF are written with pwritev(), the ranges that are
+  // still in the original file are copied by the kernel and the zeros are holes
+  std::vector<struct iovec> iov;
+  uint64_t iov_offset = 0;
+  uint64_t iov_end    = 0;
+  bool ok = true;
+  for (const DataHandler::Handler::Extent& range : this->ranges()) {
+    if (range.data == nullptr) {
+      continue;
+    }
+    if (range.from_stream and src_fd >= 0 and range.size >= MIN_COPY_SIZE) {
+      if (copy_range(src_fd, range.stream_offset, fd, range.offset, range.size)) {
+        continue;
+      }
+      // e.g. not supported by the filesystem: fall back on pwritev()
+      LIEF_DEBUG("copy_file_range() failed on '{}': {}", path, std::strerror(errno));
+      src_fd = -1;
+    }
+    if (not iov.empty() and (iov_end != range.offset or iov.size() >= IOV_MAX)) {
+      if (not (ok = write_ranges(fd, iov, iov_offset))) {
+        break;
+      }
+    }
+    if (iov.empty()) {
+      iov_offset = range.offset;
+    }
+    struct iovec entry;
+    entry.iov_base = const_cast<uint8_t*>(range.data);
+    entry.iov_len  = static_cast<size_t>(range.size);
+    iov.push_back(entry);
+    iov_end = range.offset + range.size;
+  }
+  if (ok and not iov.empty()) {
+    ok = write_ranges(fd, iov, iov_offset);
   }
+  // Set the size of the file (the trailing zeros are not written)
+  if (ok) {
+    ok = ::ftruncate(fd, static_cast<off_t>(this->build_size())) == 0;
+  }
+  ok = (::close(fd) == 0) and ok;
+  if (not ok) {
+    LIEF_ERR("Error while writing '{}': {}", path, std::strerror(errno));
+  }
+  return ok;
+#else
+  std::ofstream output{path, std::ios::out | std::ios::binary | std::ios::trunc};
+  if (not output) {
+    LIEF_ERR("Can't open '{}'", path);
+    return false;
+  }
+  this->write(output);
+  if (not output) {
+    LIEF_ERR("Error while writing '{}'", path);
+    return false;
+  }
+  return true;
+#endif
+}
+
+bool Builder::apply_in_place(const std::string& path) const {
+  DataHandler::Handler& handler = *this->binary_->datahandler_;
+  if (not this->is_in_place_) {
+    if (handler.is_mapping(path)) {
+      return this->replace(path);
+    }
+    return this->write_file(path);
+  }
+
+#if defined(_WIN32)
+  // The mapped file can't be opened for writing on Windows: the patches are
+  // written once the binary no longer depends on it
+  if (handler.is_mapping(path)) {
+    this->binary_->load_deferred();
+    handler.detach();
+  }
+#endif
+
+  std::fstream output{path, std::ios::in | std::ios::out | std::ios::binary};
+  if (not output) {
+    LIEF_ERR("Can't open '{}'", path);
+    return false;
+  }
+
+  output.seekg(0, std::ios::end);
+  const uint64_t size = static_cast<uint64_t>(output.tellg());
+  if (size != handler.size()) {
+    LIEF_ERR("'{}' is not the original file (size: 0x{:x})", path, size);
+    return false;
+  }
+
+  // The patches only change bytes that are not read from the mapping (if any)
+  for (const patch_t& patch : this->patches_) {
+    output.seekp(patch.first);
+    output.write(reinterpret_cast<const char*>(patch.second.data()), patch.second.size());
+  }
+  if (not output) {
+    LIEF_ERR("Error while writing the patches in '{}'", path);
+    return false;
+  }
+  return true;
+}
+
+bool Builder::replace(const std::string& path) const {
+#if defined(_WIN32)
+  // A mapped file can't be replaced on Windows: release the mapping first
+  this->binary_->load_deferred();
+  this->binary_->datahandler_->detach();
+  return this->write_file(path);
+#else
+  // The new content is written next to the file which is then replaced:
+  // the mapping keeps the original inode alive so that the binary
+  // remains valid
+  struct stat st;
+  if (::stat(path.c_str(), &st) != 0) {
+    LIEF_ERR("Can't stat '{}'", path);
+    return false;
+  }
+  const std::string tmp = path + ".lief";
+  if (not this->write_file(tmp)) {
+    std::remove(tmp.c_str());
+    return false;
+  }
+  ::chmod(tmp.c_str(), st.st_mode & 07777);
+  if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+    LIEF_ERR("Can't replace '{}'", path);
+    std::remove(tmp.c_str());
+    return false;
+  }
+  return true;
+#endif
 }
 
 
@@ -144,11 +510,128 @@ uint32_t Builder::sort_dynamic_symbols() {
                static_cast<uint16_t>(SYMBOL_SECTION_INDEX::SHN_UNDEF);
       });
 
+  this->binary_->invalidate_symbols_index();
+
   const uint32_t first_exported_symbol_index =
       std::distance(it_begin, it_first_exported_symbol);
   return first_exported_symbol_index;
 }
 
+uint32_t Builder::sort_static_symbols() {
+  std::stable_sort(std::begin(this->binary_->static_symbols_), std::end(this->binary_->static_symbols_),
+      [](const Symbol* lhs, const Symbol* rhs) {
+        return lhs->binding() == SYMBOL_BINDINGS::STB_LOCAL and
+               (rhs->binding() == SYMBOL_BINDINGS::STB_GLOBAL or rhs->binding() == SYMBOL_BINDINGS::STB_WEAK);
+  });
+  this->binary_->index_tracker_->changed(IndexTracker::STATIC_SYMBOLS);
+
+  auto it_first_exported_symbol =
+      std::find_if(std::begin(this->binary_->static_symbols_), std::end(this->binary_->static_symbols_),
+          [](const Symbol* sym) {
+            return sym->is_exported();
+          });
+
+  return static_cast<uint32_t>(std::distance(std::begin(this->binary_->static_symbols_), it_first_exported_symbol));
+}
+
+
+std::vector<std::pair<Section*, const Section*>> Builder::object_relocations_sections(bool& is_rela) {
+  const relocations_t& relocations = this->binary_->relocations_;
+  auto&& it_first = std::find_if(std::begin(relocations), std::end(relocations),
+      [] (const Relocation* relocation) {
+        return relocation->purpose() == RELOCATION_PURPOSES::RELOC_PURPOSE_OBJECT;
+      });
+
+  if (it_first == std::end(relocations)) {
+    return {};
+  }
+
+  is_rela = (*it_first)->is_rela();
+  const bool same_type = std::all_of(std::begin(relocations), std::end(relocations),
+      [is_rela] (const Relocation* relocation) {
+        return relocation->purpose() != RELOCATION_PURPOSES::RELOC_PURPOSE_OBJECT or
+               relocation->is_rela() == is_rela;
+      });
+
+  if (not same_type) {
+    throw LIEF::type_error("Object relocations are not of the same type");
+  }
+
+  const sections_t& sections = this->binary_->sections_;
+  const ELF_SECTION_TYPES rel_type = is_rela ? ELF_SECTION_TYPES::SHT_RELA : ELF_SECTION_TYPES::SHT_REL;
+
+  //  FIXME: Warn if not rel section found?
+  std::vector<std::pair<Section*, const Section*>> rel_sections;
+  for (Section* section : sections) {
+    if (section->type() != rel_type) {
+      continue;
+    }
+    if (section->information() == 0 or section->information() >= sections.size()) {
+      throw LIEF::not_found("Unable to find associated section for SHT_REL{A} section");
+    }
+    rel_sections.emplace_back(section, sections[section->information()]);
+  }
+  return rel_sections;
+}
+
+
+Builder::symbols_idx_t Builder::symbols_index() const {
+  symbols_idx_t symbols_idx;
+  symbols_idx.reserve(this->binary_->dynamic_symbols_.size() + this->binary_->static_symbols_.size());
+
+  // The dynamic symbols take precedence over the static ones
+  for (size_t i = 0; i < this->binary_->dynamic_symbols_.size(); ++i) {
+    symbols_idx.emplace(this->binary_->dynamic_symbols_[i], static_cast<uint32_t>(i));
+  }
+
+  for (size_t i = 0; i < this->binary_->static_symbols_.size(); ++i) {
+    symbols_idx.emplace(this->binary_->static_symbols_[i], static_cast<uint32_t>(i));
+  }
+  return symbols_idx;
+}
+
+
+std::vector<uint8_t> Builder::serialize_notes() const {
+  vector_iostream raw_notes(this->should_swap());
+  for (const Note* note_ptr : this->binary_->notes_) {
+    const Note& note = *note_ptr;
+    // First we have to write the length of the Note's name
+    const uint32_t namesz = static_cast<uint32_t>(note.name().size() + 1);
+    raw_notes.write_conv<uint32_t>(namesz);
+
+    // Then the length of the Note's description
+    const uint32_t descsz = static_cast<uint32_t>(note.description().size());
+    //const uint32_t descsz = 20;
+    raw_notes.write_conv<uint32_t>(descsz);
+
+    // Then the note's type
+    const NOTE_TYPES type = note.type();
+    raw_notes.write_conv<uint32_t>(static_cast<uint32_t>(type));
+
+    // Then we write the note's name
+    const std::string& name = note.name();
+    raw_notes.write(name);
+
+    // Alignment
+    raw_notes.align(sizeof(uint32_t), 0);
+
+    // description content (manipulated in 4 byte/uint32_t chunks)
+    const std::vector<uint8_t>& description = note.description();
+    const uint32_t *desc_ptr = reinterpret_cast<const uint32_t*>(description.data()) ;
+    size_t i = 0;
+    for (; i < description.size() / sizeof(uint32_t); i++) {
+      raw_notes.write_conv<uint32_t>(desc_ptr[i]);
+    }
+    if (description.size() % sizeof(uint32_t) != 0) {
+      uint32_t padded = 0;
+      uint8_t *ptr = reinterpret_cast<uint8_t*>(&padded);
+      memcpy(ptr, desc_ptr + i, description.size() % sizeof(uint32_t));
+      raw_notes.write_conv<uint32_t>(padded);
+    }
+  }
+  return std::move(raw_notes.raw());
+}
+
 
 void Builder::build_empty_symbol_gnuhash() {
   LIEF_DEBUG("Build empty GNU Hash");
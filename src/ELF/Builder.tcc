@@ -42,8 +42,12 @@
 #include "LIEF/ELF/SymbolVersionRequirement.hpp"
 #include "LIEF/ELF/SymbolVersionAuxRequirement.hpp"
 #include "LIEF/ELF/Note.hpp"
+#include "LIEF/ELF/DataHandler/Handler.hpp"
 
 #include "Object.tcc"
+#include "object_pool.hpp"
+#include "parallel.hpp"
+#include "string_table.hpp"
 
 namespace LIEF {
 namespace ELF {
@@ -52,22 +56,47 @@ template<class ELF_T>
 void Builder::build() {
   std::string type = ((this->binary_->type_ == ELF_CLASS::ELFCLASS32) ? "ELF32" : "ELF64");
   LIEF_DEBUG("== Re-building {} ==", type);
-  try {
-    this->build_hash_table<ELF_T>();
-  } catch (const LIEF::exception& e) {
-    LIEF_WARN("{}", e.what());
-  }
+  ++this->nb_builds_;
+
+  // Only the tables modified since the parsing are regenerated. The other ones
+  // are written as-is with the content of their section.
+  // If a previous step changed the layout (e.g. by adding a segment),
+  // the next steps must be re-run to take the shift into account.
+  const uint32_t modified = this->binary_->modified_;
+  auto&& must_build = [this, modified] (uint32_t tables) {
+    return (modified & tables) != 0 or
+           (this->binary_->modified_ & Binary::MODIFIED_LAYOUT) != 0;
+  };
+
+  // .dynstr is shared by the dynamic entries, the dynamic symbols and the
+  // symbol versions and the relocations reference the dynamic symbols indexes:
+  // they are rebuilt together
+  const bool build_dynamic = must_build(Binary::MODIFIED_DYNAMIC_ENTRIES |
+                                        Binary::MODIFIED_DYNAMIC_SYMBOLS |
+                                        Binary::MODIFIED_SYMBOL_VERSIONS |
+                                        Binary::MODIFIED_RELOCATIONS);
+  if (not build_dynamic) {
+    LIEF_DEBUG("Dynamic tables not modified");
+  }
+
+  if (build_dynamic) {
+    try {
+      this->build_hash_table<ELF_T>();
+    } catch (const LIEF::exception& e) {
+      LIEF_WARN("{}", e.what());
+    }
 
 
-  try {
-    this->build_dynamic<ELF_T>();
-  } catch (const LIEF::exception& e) {
-    LIEF_WARN("{}", e.what());
+    try {
+      this->build_dynamic<ELF_T>();
+    } catch (const LIEF::exception& e) {
+      LIEF_WARN("{}", e.what());
+    }
   }
 
 
   // Build Relocations
-  if (this->binary_->dynamic_relocations().size() > 0) {
+  if (build_dynamic and this->binary_->dynamic_relocations().size() > 0) {
     try {
       this->build_dynamic_relocations<ELF_T>();
     } catch (const LIEF::exception& e) {
@@ -75,7 +104,7 @@ void Builder::build() {
     }
   }
 
-  if (this->binary_->pltgot_relocations().size() > 0) {
+  if (build_dynamic and this->binary_->pltgot_relocations().size() > 0) {
     try {
       this->build_pltgot_relocations<ELF_T>();
     } catch (const LIEF::exception& e) {
@@ -85,7 +114,7 @@ void Builder::build() {
 
 
   // Build symbols version
-  if (this->binary_->symbol_version_table_.size() > 0) {
+  if (build_dynamic and this->binary_->symbol_version_table_.size() > 0) {
     try {
       this->build_symbol_version<ELF_T>();
     } catch (const LIEF::exception& e) {
@@ -93,7 +122,7 @@ void Builder::build() {
     }
   }
 
-  if (this->binary_->symbol_version_requirements_.size() > 0) {
+  if (build_dynamic and this->binary_->symbol_version_requirements_.size() > 0) {
     try {
       this->build_symbol_requirement<ELF_T>();
     } catch (const LIEF::exception& e) {
@@ -101,7 +130,7 @@ void Builder::build() {
     }
   }
 
-  if (this->binary_->symbol_version_definition_.size() > 0) {
+  if (build_dynamic and this->binary_->symbol_version_definition_.size() > 0) {
     try {
       this->build_symbol_definition<ELF_T>();
     } catch (const LIEF::exception& e) {
@@ -109,18 +138,8 @@ void Builder::build() {
     }
   }
 
-  // Build static symbols
-  if (this->binary_->static_symbols_.size() > 0) {
-    try {
-      this->build_static_symbols<ELF_T>();
-    } catch (const LIEF::exception& e) {
-      LIEF_WARN("{}", e.what());
-    }
-  }
-
-
   // Build Interpreter
-  if (this->binary_->has_interpreter()) {
+  if (must_build(Binary::MODIFIED_INTERPRETER) and this->binary_->has_interpreter()) {
     try {
       this->build_interpreter<ELF_T>();
     } catch (const LIEF::exception& e) {
@@ -128,21 +147,21 @@ void Builder::build() {
     }
   }
 
-  // Build Notes
-  if (this->binary_->has_notes()) {
-    try {
-      this->build_notes<ELF_T>();
-    } catch (const LIEF::exception& e) {
-      LIEF_WARN("{}", e.what());
-    }
+  const bool rebuilt = this->build_static_tables<ELF_T>(
+      must_build(Binary::MODIFIED_STATIC_SYMBOLS) and this->binary_->static_symbols_.size() > 0,
+      must_build(Binary::MODIFIED_NOTES) and this->binary_->has_notes(),
+      must_build(Binary::MODIFIED_RELOCATIONS | Binary::MODIFIED_STATIC_SYMBOLS) and
+      this->binary_->object_relocations().size() > 0);
+
+  if (rebuilt) {
+    return;
   }
 
-  if (this->binary_->object_relocations().size() > 0) {
-    try {
-      this->build_section_relocations<ELF_T>();
-    } catch (const LIEF::exception& e) {
-      LIEF_WARN("{}", e.what());
+  if (this->in_place_) {
+    if (this->build_in_place<ELF_T>()) {
+      return;
     }
+    LIEF_INFO("The modifications don't fit in the original file: fallback on a full rebuild");
   }
 
   // Build sections
@@ -162,95 +181,77 @@ void Builder::build() {
 
 }
 
-template<typename T, typename HANDLER>
-std::vector<std::string> Builder::optimize(const HANDLER& container,
-                                           std::function<std::string(const typename HANDLER::value_type)> getter,
-                                           std::unordered_map<std::string, size_t> *of_map_p) {
-
-  std::set<std::string> string_table;
-  std::vector<std::string> string_table_optimized;
-  string_table_optimized.reserve(container.size());
-
-  // reverse all symbol names and sort them so we can merge then in the linear time:
-  // aaa, aadd, aaaa, cca, ca -> aaaa, aaa, acc, ac ddaa
-  std::transform(
-    std::begin(container), std::end(container),
-    std::inserter(string_table, std::end(string_table)),
-    getter);
-
-  for (auto &val: string_table) {
-    string_table_optimized.emplace_back(std::move(val));
-    std::reverse(std::begin(string_table_optimized.back()), std::end(string_table_optimized.back()));
-  }
-
-  std::sort(std::begin(string_table_optimized), std::end(string_table_optimized),
-      [] (const std::string& lhs, const std::string& rhs) {
-          bool ret = false;
-          if (lhs.size() > rhs.size()) {
-              auto res = lhs.compare(0, rhs.size(), rhs);
-              ret = (res <= 0);
-          } else {
-              auto res = rhs.compare(0, lhs.size(), lhs);
-              ret = (res > 0);
-          }
-          return ret;
-  });
-
-  // as all elements that can be merged are adjacent we can just go through the list once
-  // and memorize one we merged to calculate the offsets later
-  std::unordered_map<std::string, std::string> merged_map;
-  size_t to_set_idx = 0, cur_elm_idx = 1;
-  for (; cur_elm_idx < string_table_optimized.size(); ++cur_elm_idx) {
-      auto &cur_elm = string_table_optimized[cur_elm_idx];
-      auto &to_set_elm = string_table_optimized[to_set_idx];
-      if (to_set_elm.size() >= cur_elm.size()) {
-          auto ret = to_set_elm.compare(0, cur_elm.size(), cur_elm);
-          if (ret == 0) {
-              // when memorizing reverse back symbol names
-              std::string rev_cur_elm = cur_elm;
-              std::string rev_to_set_elm = to_set_elm;
-              std::reverse(std::begin(rev_cur_elm), std::end(rev_cur_elm));
-              std::reverse(std::begin(rev_to_set_elm), std::end(rev_to_set_elm));
-              merged_map[rev_cur_elm] = rev_to_set_elm;
-              continue;
-          }
-      }
-      ++to_set_idx;
-      std::swap(string_table_optimized[to_set_idx], cur_elm);
+template<typename ELF_T>
+void Builder::build(const Header& header) {
+  this->emit(0, this->raw_header<ELF_T>(header));
+}
+
+
+template<typename ELF_T>
+bool Builder::build_in_place() {
+  if (this->binary_->datahandler_ == nullptr) {
+    return false;
   }
-  // if the first one is empty
-  if (string_table_optimized[0].size() == 0) {
-    std::swap(string_table_optimized[0], string_table_optimized[to_set_idx]);
-    --to_set_idx;
+  DataHandler::Handler& handler = *this->binary_->datahandler_;
+  if ((this->binary_->modified_ & Binary::MODIFIED_LAYOUT) != 0 or not handler.is_patchable()) {
+    LIEF_DEBUG("The layout of the binary has been modified");
+    return false;
   }
-  string_table_optimized.resize(to_set_idx + 1);
 
-  //reverse symbols back and sort them again
-  for (auto &val: string_table_optimized) {
-      std::reverse(std::begin(val), std::end(val));
-  }
-  std::sort(std::begin(string_table_optimized), std::end(string_table_optimized));
+  const Header& header   = this->binary_->header();
+  const uint64_t size    = handler.size();
+  const uint64_t phdr_offset = header.program_headers_offset();
+  const uint64_t shdr_offset = header.section_headers_offset();
+
+  std::vector<uint8_t> ehdr  = this->raw_header<ELF_T>(header);
+  std::vector<uint8_t> phdrs = this->raw_program_headers<ELF_T>();
+  std::vector<uint8_t> shdrs;
 
-  if (of_map_p) {
-    std::unordered_map<std::string, size_t> offset_map;
-    offset_map[""] = 0;
-    size_t offset_counter = 1;
-    for (const auto &v : string_table_optimized) {
-        offset_map[v] = offset_counter;
-        offset_counter += v.size() + 1;
+  const sections_t& sections = this->binary_->sections_;
+  if (sections.size() > 0 and shdr_offset > 0) {
+    if (header.section_name_table_idx() >= sections.size()) {
+      return false;
     }
-    for (const auto &kv : merged_map) {
-        offset_map[kv.first] = offset_map[kv.second] + (kv.second.size() - kv.first.size());
+    // The names of the sections must be present in the original table
+    try {
+      shdrs = this->raw_section_headers<ELF_T>(sections[header.section_name_table_idx()]->content());
+    } catch (const LIEF::not_found&) {
+      LIEF_DEBUG("New section names");
+      return false;
     }
-    *of_map_p = std::move(offset_map);
   }
 
-  return string_table_optimized;
+  if ((phdr_offset + phdrs.size()) > size or (shdr_offset + shdrs.size()) > size) {
+    return false;
+  }
+
+  const Binary::overlay_t& overlay = this->binary_->overlay_;
+  const uint64_t eof_offset = this->binary_->eof_offset();
+  if ((eof_offset + overlay.size()) != size and not (overlay.empty() and eof_offset >= size)) {
+    LIEF_DEBUG("The size of the overlay has been modified");
+    return false;
+  }
+
+  handler.write(0, ehdr.data(), ehdr.size());
+  if (phdr_offset > 0) {
+    handler.write(phdr_offset, phdrs.data(), phdrs.size());
+  }
+  if (shdr_offset > 0) {
+    handler.write(shdr_offset, shdrs.data(), shdrs.size());
+  }
+  if (not overlay.empty()) {
+    handler.write(eof_offset, overlay.data(), overlay.size());
+  }
+
+  this->patches_ = handler.diff();
+  this->is_in_place_ = true;
+  LIEF_DEBUG("{:d} patches", this->patches_.size());
+  return true;
 }
 
 
 template<typename ELF_T>
-void Builder::build(const Header& header) {;
+std::vector<uint8_t> Builder::raw_header(const Header& header) const {
   using Elf_Half = typename ELF_T::Elf_Half;
   using Elf_Word = typename ELF_T::Elf_Word;
   using Elf_Addr = typename ELF_T::Elf_Addr;
@@ -280,37 +281,37 @@ void Builder::build(const Header& header) {;
     std::end(header.identity()),
     std::begin(ehdr.e_ident));
 
-  this->ios_.seekp(0);
-  this->ios_.write_conv<Elf_Ehdr>(ehdr);
+  vector_iostream raw_ehdr(this->should_swap());
+  raw_ehdr.write_conv<Elf_Ehdr>(ehdr);
+  return std::move(raw_ehdr.raw());
 }
 
 
 template<typename ELF_T>
 void Builder::build_sections() {
-  using Elf_Word = typename ELF_T::Elf_Word;
-  using Elf_Addr = typename ELF_T::Elf_Addr;
   using Elf_Off  = typename ELF_T::Elf_Off;
-  using Elf_Word = typename ELF_T::Elf_Word;
-
-  using Elf_Shdr = typename ELF_T::Elf_Shdr;
   LIEF_DEBUG("[+] Build sections");
 
   // FIXME: Keep it global const and local non const
   Header& header = this->binary_->header();
   const Elf_Off section_headers_offset = header.section_headers_offset();
 
-  std::vector<std::string> shstrtab_opt =
-    this->optimize<Section, decltype(this->binary_->sections_)>(this->binary_->sections_,
-        [] (const Section* sec) { return sec->name(); });
-
   // Build section's name
-  std::vector<uint8_t> section_names;
-  section_names.push_back(0);
-  for (const std::string& name : shstrtab_opt) {
-    section_names.insert(std::end(section_names), std::begin(name), std::end(name));
-    section_names.push_back(0);
+  // Section::name() returns a copy: keep the names alive for the builder
+  std::vector<std::string> names;
+  names.reserve(this->binary_->sections_.size());
+  for (const Section* section : this->binary_->sections_) {
+    names.push_back(section->name());
   }
 
+  StringTableBuilder shstrtab;
+  shstrtab.reserve(names.size());
+  for (const std::string& name : names) {
+    shstrtab.add(name);
+  }
+  shstrtab.build();
+  std::vector<uint8_t> section_names = std::move(shstrtab.raw());
+
   Section* string_names_section = this->binary_->sections_[header.section_name_table_idx()];
 
   auto&& it_symtab_section = std::find_if(
@@ -367,63 +368,80 @@ void Builder::build_sections() {
       //bool is_final       = bin_type == E_TYPE::ET_EXEC or bin_type == E_TYPE::ET_DYN; // Executable or Library
 
       //if (is_object_file or is_final) {
-        this->ios_.seekp(section->file_offset());
-        this->ios_.write(section->content());
+        if (section->datahandler_ != nullptr and section->size() <= Parser::MAX_SECTION_SIZE) {
+          // The content is read from the binary when the result is written
+          const DataHandler::Node& node = section->datahandler_->get(
+              section->offset(), section->size(), DataHandler::Node::SECTION);
+          this->emit_content(section->file_offset(), node.offset(), node.size());
+        } else {
+          this->emit(section->file_offset(), section->content());
+        }
       //}
     }
   }
 
-  for (size_t i = 0; i < this->binary_->sections_.size(); i++) {
-    const Section* section = this->binary_->sections_[i];
-    LIEF_DEBUG("Writing content of section '{}'", section->name());
-    const std::string name = section->name();
+  // Write Section'header
+  if (section_headers_offset > 0) {
+    this->emit(section_headers_offset, this->raw_section_headers<ELF_T>(section_names));
+  }
 
-    const auto it_offset_name = std::search(
-        std::begin(section_names), std::end(section_names),
-        name.c_str(),
-        name.c_str() + name.size() + 1);
+  this->emit(string_names_section->file_offset(), std::move(section_names));
 
-    if (it_offset_name == std::end(section_names)) {
-      throw LIEF::not_found("Section name not found");
-    }
 
-    const Elf_Off offset_name = static_cast<Elf_Off>(std::distance(std::begin(section_names), it_offset_name));
+}
 
-    Elf_Shdr shdr;
-    shdr.sh_name      = static_cast<Elf_Word>(offset_name);
-    shdr.sh_type      = static_cast<Elf_Word>(section->type());
-    shdr.sh_flags     = static_cast<Elf_Word>(section->flags());
-    shdr.sh_addr      = static_cast<Elf_Addr>(section->virtual_address());
-    shdr.sh_offset    = static_cast<Elf_Off>(section->file_offset());
-    shdr.sh_size      = static_cast<Elf_Word>(section->size());
-    shdr.sh_link      = static_cast<Elf_Word>(section->link());
-    shdr.sh_info      = static_cast<Elf_Word>(section->information());
-    shdr.sh_addralign = static_cast<Elf_Word>(section->alignment());
-    shdr.sh_entsize   = static_cast<Elf_Word>(section->entry_size());
 
-    // Write Section'header
-    if (section_headers_offset > 0) {
-      this->ios_.seekp(section_headers_offset + i * sizeof(Elf_Shdr));
-      this->ios_.write_conv<Elf_Shdr>(shdr);
-    }
+template<typename ELF_T>
+void Builder::build_segments() {
+  using Elf_Off  = typename ELF_T::Elf_Off;
+  LIEF_DEBUG("== Build segments ==");
+
+  std::vector<uint8_t> pheaders = this->raw_program_headers<ELF_T>();
+
+
+  auto&& it_segment_phdr = std::find_if(
+      std::begin(this->binary_->segments_),
+      std::end(this->binary_->segments_),
+      [] (const Segment* segment)
+      {
+        return segment != nullptr and segment->type() == SEGMENT_TYPES::PT_PHDR;
+      });
+
+  if (it_segment_phdr != std::end(this->binary_->segments_)) {
+    (*it_segment_phdr)->content(pheaders);
   }
 
-  this->ios_.seekp(string_names_section->file_offset());
-  this->ios_.write(std::move(section_names));
 
+  // Write segment content
+  for (const Segment* segment : this->binary_->segments_) {
+    if (segment->physical_size() > 0) {
+      LIEF_DEBUG("Write content of segment {}@0{:x} (off: 0x{:x}:0{:x})",
+          to_string(segment->type()), segment->virtual_address(), segment->file_offset(),
+          segment->physical_size());
+
+      if (segment->datahandler_ != nullptr) {
+        // The content is read from the binary when the result is written
+        const DataHandler::Node& node = segment->datahandler_->get(
+            segment->file_offset(), segment->physical_size(), DataHandler::Node::SEGMENT);
+        this->emit_content(segment->file_offset(), node.offset(), node.size());
+      } else {
+        this->emit(segment->file_offset(), segment->content());
+      }
+    }
+  }
 
+  const Elf_Off segment_header_offset = this->binary_->header().program_headers_offset();
+  this->emit(segment_header_offset, std::move(pheaders));
 }
 
 
 template<typename ELF_T>
-void Builder::build_segments() {
+std::vector<uint8_t> Builder::raw_program_headers() const {
   using Elf_Word = typename ELF_T::Elf_Word;
   using Elf_Addr = typename ELF_T::Elf_Addr;
   using Elf_Off  = typename ELF_T::Elf_Off;
-  using Elf_Word = typename ELF_T::Elf_Word;
 
   using Elf_Phdr = typename ELF_T::Elf_Phdr;
-  LIEF_DEBUG("== Build segments ==");
 
   vector_iostream pheaders(this->should_swap());
   pheaders.reserve(this->binary_->segments_.size() * sizeof(Elf_Phdr));
@@ -441,69 +459,169 @@ void Builder::build_segments() {
 
       pheaders.write_conv<Elf_Phdr>(phdr);
   }
+  return std::move(pheaders.raw());
+}
 
 
-  auto&& it_segment_phdr = std::find_if(
-      std::begin(this->binary_->segments_),
-      std::end(this->binary_->segments_),
-      [] (const Segment* segment)
-      {
-        return segment != nullptr and segment->type() == SEGMENT_TYPES::PT_PHDR;
-      });
+template<typename ELF_T>
+std::vector<uint8_t> Builder::raw_section_headers(const std::vector<uint8_t>& section_names) const {
+  using Elf_Word = typename ELF_T::Elf_Word;
+  using Elf_Addr = typename ELF_T::Elf_Addr;
+  using Elf_Off  = typename ELF_T::Elf_Off;
 
-  if (it_segment_phdr != std::end(this->binary_->segments_)) {
-    (*it_segment_phdr)->content(pheaders.raw());
-  }
+  using Elf_Shdr = typename ELF_T::Elf_Shdr;
 
+  vector_iostream shdrs(this->should_swap());
+  shdrs.reserve(this->binary_->sections_.size() * sizeof(Elf_Shdr));
 
-  // Write segment content
-  for (const Segment* segment : this->binary_->segments_) {
-    if (segment->physical_size() > 0) {
-      const std::vector<uint8_t>& content = segment->content();
-      LIEF_DEBUG("Write content of segment {}@0{:x} (off: 0x{:x}:0{:x})",
-          to_string(segment->type()), segment->virtual_address(), segment->file_offset(), content.size());
+  for (size_t i = 0; i < this->binary_->sections_.size(); i++) {
+    const Section* section = this->binary_->sections_[i];
+    const std::string name = section->name();
+
+    // Keep the original index if it still points to the name
+    auto it_offset_name = std::end(section_names);
+    if (section->name_idx() + name.size() < section_names.size() and
+        std::equal(name.c_str(), name.c_str() + name.size() + 1,
+                   std::begin(section_names) + section->name_idx()))
+    {
+      it_offset_name = std::begin(section_names) + section->name_idx();
+    } else {
+      it_offset_name = std::search(
+          std::begin(section_names), std::end(section_names),
+          name.c_str(),
+          name.c_str() + name.size() + 1);
+    }
 
-      this->ios_.seekp(segment->file_offset());
-      this->ios_.write(std::move(content));
+    if (it_offset_name == std::end(section_names)) {
+      throw LIEF::not_found("Section name not found");
     }
-  }
 
-  const Elf_Off segment_header_offset = this->binary_->header().program_headers_offset();
-  this->ios_.seekp(segment_header_offset);
-  this->ios_.write(std::move(pheaders.raw()));
+    const Elf_Off offset_name = static_cast<Elf_Off>(std::distance(std::begin(section_names), it_offset_name));
+
+    Elf_Shdr shdr;
+    shdr.sh_name      = static_cast<Elf_Word>(offset_name);
+    shdr.sh_type      = static_cast<Elf_Word>(section->type());
+    shdr.sh_flags     = static_cast<Elf_Word>(section->flags());
+    shdr.sh_addr      = static_cast<Elf_Addr>(section->virtual_address());
+    shdr.sh_offset    = static_cast<Elf_Off>(section->file_offset());
+    shdr.sh_size      = static_cast<Elf_Word>(section->size());
+    shdr.sh_link      = static_cast<Elf_Word>(section->link());
+    shdr.sh_info      = static_cast<Elf_Word>(section->information());
+    shdr.sh_addralign = static_cast<Elf_Word>(section->alignment());
+    shdr.sh_entsize   = static_cast<Elf_Word>(section->entry_size());
+
+    shdrs.write_conv<Elf_Shdr>(shdr);
+  }
+  return std::move(shdrs.raw());
 }
 
 
 template<typename ELF_T>
-void Builder::build_static_symbols() {
-  using Elf_Half = typename ELF_T::Elf_Half;
-  using Elf_Word = typename ELF_T::Elf_Word;
-  using Elf_Addr = typename ELF_T::Elf_Addr;
-  using Elf_Off  = typename ELF_T::Elf_Off;
+bool Builder::build_static_tables(bool static_symbols, bool notes, bool relocations) {
+  const size_t build_id = this->nb_builds_;
+
+  // Each job serializes a table in its own buffer: they only read the binary
+  std::vector<std::function<void()>> jobs;
+  std::vector<char> success;
+  auto&& add_job = [&jobs, &success] (std::function<void()> job) {
+    const size_t idx = success.size();
+    success.push_back(false);
+    jobs.emplace_back([&success, idx, job] {
+      try {
+        job();
+        success[idx] = true;
+      } catch (const LIEF::exception& e) {
+        LIEF_WARN("{}", e.what());
+      }
+    });
+    return idx;
+  };
+
+  uint32_t first_exported_symbol_index = 0;
+  std::vector<uint8_t> symtab;
+  std::vector<uint8_t> strtab;
+  size_t symtab_job = 0;
+  if (static_symbols) {
+    // The relocations reference the symbols with their (sorted) index
+    first_exported_symbol_index = this->sort_static_symbols();
+    symtab_job = add_job([this, &symtab, &strtab] {
+      this->serialize_static_symbols<ELF_T>(symtab, strtab);
+    });
+  }
 
-  using Elf_Sym  = typename ELF_T::Elf_Sym;
+  std::vector<uint8_t> raw_notes;
+  size_t notes_job = 0;
+  if (notes) {
+    notes_job = add_job([this, &raw_notes] {
+      raw_notes = this->serialize_notes();
+    });
+  }
 
-  LIEF_DEBUG("== Build static symbols ==");
-  Section& symbol_section = this->binary_->static_symbols_section();
-  LIEF_DEBUG(".symtab section: '{}'", symbol_section.name());
+  bool is_rela = false;
+  std::vector<std::pair<Section*, const Section*>> rel_sections;
+  symbols_idx_t symbols_idx;
+  if (relocations) {
+    try {
+      rel_sections = this->object_relocations_sections(is_rela);
+      symbols_idx  = this->symbols_index();
+    } catch (const LIEF::exception& e) {
+      LIEF_WARN("{}", e.what());
+      relocations = false;
+    }
+  }
 
-  //clear
-  //symbol_section.content(std::vector<uint8_t>(symbol_section.content().size(), 0));
+  std::vector<std::vector<uint8_t>> rel_contents(rel_sections.size());
+  std::vector<size_t> rel_jobs;
+  for (size_t i = 0; i < rel_sections.size(); ++i) {
+    rel_jobs.push_back(add_job([this, i, is_rela, &rel_sections, &rel_contents, &symbols_idx] {
+      rel_contents[i] = this->serialize_section_relocations<ELF_T>(*rel_sections[i].second, is_rela, symbols_idx);
+    }));
+  }
 
-  std::stable_sort(std::begin(this->binary_->static_symbols_), std::end(this->binary_->static_symbols_),
-      [](const Symbol* lhs, const Symbol* rhs) {
-        return lhs->binding() == SYMBOL_BINDINGS::STB_LOCAL and
-               (rhs->binding() == SYMBOL_BINDINGS::STB_GLOBAL or rhs->binding() == SYMBOL_BINDINGS::STB_WEAK);
-  });
+  parallel_for(this->threads_, jobs.size(), [&jobs] (size_t i) { jobs[i](); });
 
-  auto it_first_exported_symbol =
-      std::find_if(std::begin(this->binary_->static_symbols_), std::end(this->binary_->static_symbols_),
-          [](const Symbol* sym) {
-            return sym->is_exported();
-          });
+  // Place the tables (sequentially) in the same order as a sequential build
+  if (static_symbols and success[symtab_job]) {
+    try {
+      this->build_static_symbols<ELF_T>(std::move(symtab), std::move(strtab), first_exported_symbol_index);
+    } catch (const LIEF::exception& e) {
+      LIEF_WARN("{}", e.what());
+    }
+  }
 
-  uint32_t first_exported_symbol_index =
-      static_cast<uint32_t>(std::distance(std::begin(this->binary_->static_symbols_), it_first_exported_symbol));
+  if (notes and success[notes_job]) {
+    try {
+      this->build_notes<ELF_T>(std::move(raw_notes));
+    } catch (const LIEF::exception& e) {
+      LIEF_WARN("{}", e.what());
+    }
+    // The notes have been relocated and the binary rebuilt: the
+    // relocations serialized above are stale
+    if (this->nb_builds_ != build_id) {
+      return true;
+    }
+  }
+
+  const bool rel_success = std::all_of(std::begin(rel_jobs), std::end(rel_jobs),
+      [&success] (size_t idx) { return success[idx]; });
+
+  if (relocations and rel_success) {
+    try {
+      this->build_section_relocations<ELF_T>(rel_sections, is_rela, std::move(rel_contents));
+    } catch (const LIEF::exception& e) {
+      LIEF_WARN("{}", e.what());
+    }
+  }
+  return this->nb_builds_ != build_id;
+}
+
+
+template<typename ELF_T>
+void Builder::build_static_symbols(std::vector<uint8_t> symtab, std::vector<uint8_t> strtab,
+                                   uint32_t first_exported_symbol_index) {
+  LIEF_DEBUG("== Build static symbols ==");
+  Section& symbol_section = this->binary_->static_symbols_section();
+  LIEF_DEBUG(".symtab section: '{}'", symbol_section.name());
 
   if (first_exported_symbol_index != symbol_section.information()) {
     LIEF_INFO("information of .symtab section changes from {:d} to {:d}",
@@ -519,36 +637,36 @@ void Builder::build_static_symbols() {
   }
   Section& symbol_str_section = *(this->binary_->sections_[symbol_section.link()]);
 
-  vector_iostream content(this->should_swap());
-  content.reserve(this->binary_->static_symbols_.size() * sizeof(Elf_Sym));
-  std::vector<uint8_t> string_table_raw;
-  std::unordered_map<std::string, size_t> offset_name_map;
+  // FIXME: Handle increase of size in symbol_str_section
+  symbol_str_section.content(std::move(strtab));
+  symbol_section.content(std::move(symtab));
+}
 
-  // Container which will hold symbols name (optimized)
-  std::vector<std::string> string_table_optimize =
-    this->optimize<Symbol, decltype(this->binary_->static_symbols_)>(this->binary_->static_symbols_,
-                                                  [] (const Symbol* sym) { return sym->name(); },
-                                                  &offset_name_map);
 
-  // We can't start with a symbol name
-  string_table_raw.push_back(0);
-  for (const std::string& name : string_table_optimize) {
-    string_table_raw.insert(std::end(string_table_raw), std::begin(name), std::end(name));
-    string_table_raw.push_back(0);
-  }
+template<typename ELF_T>
+void Builder::serialize_static_symbols(std::vector<uint8_t>& symtab, std::vector<uint8_t>& strtab) const {
+  using Elf_Half = typename ELF_T::Elf_Half;
+  using Elf_Word = typename ELF_T::Elf_Word;
+  using Elf_Addr = typename ELF_T::Elf_Addr;
+  using Elf_Off  = typename ELF_T::Elf_Off;
 
-  // Fill `content`
-  for (const Symbol* symbol : this->binary_->static_symbols_) {
-    LIEF_DEBUG("Dealing with symbol: {}", symbol->name());
-    const std::string& name = symbol->name();
+  using Elf_Sym  = typename ELF_T::Elf_Sym;
 
-    auto offset_it = offset_name_map.find(name);
-    if (offset_it == std::end(offset_name_map)) {
-       throw LIEF::not_found("Unable to find symbol '" + name + "' in the string table");
-    }
+  vector_iostream content(this->should_swap());
+  content.reserve(this->binary_->static_symbols_.size() * sizeof(Elf_Sym));
 
-    const Elf_Off name_offset = static_cast<Elf_Off>(offset_it->second);
+  StringTableBuilder string_table;
+  string_table.reserve(this->binary_->static_symbols_.size());
+  for (const Symbol* symbol : this->binary_->static_symbols_) {
+    string_table.add(symbol->name());
+  }
+  string_table.build();
+  const std::vector<size_t>& names_offset = string_table.offsets();
 
+  // Fill `content`
+  for (size_t i = 0; i < this->binary_->static_symbols_.size(); ++i) {
+    const Symbol* symbol = this->binary_->static_symbols_[i];
+    const Elf_Off name_offset = static_cast<Elf_Off>(names_offset[i]);
 
     Elf_Sym sym_hdr;
     memset(&sym_hdr, 0, sizeof(sym_hdr));
@@ -562,22 +680,11 @@ void Builder::build_static_symbols() {
     content.write_conv<Elf_Sym>(sym_hdr);
   }
 
-  // FIXME: Handle increase of size in symbol_str_section
-  symbol_str_section.content(std::move(string_table_raw));
-  symbol_section.content(std::move(content.raw()));
-
+  strtab = std::move(string_table.raw());
+  symtab = std::move(content.raw());
 }
 
-/*!
- * \brief This method construct binary's dynamic part.
- *
- * Which include:
- *
- *   - Dynamic section
- *   - Dynamic string table
- *   - Dynamic symbol
- *   - Dynamic relocation
- */
+
 template<typename ELF_T>
 void Builder::build_dynamic() {
   LIEF_DEBUG("== Building dynamic ==");
@@ -955,6 +1062,7 @@ void Builder::build_symbol_gnuhash(uint32_t new_symndx) {
           (dl_new_hash(lhs->name().c_str()) % nb_buckets) <
           (dl_new_hash(rhs->name().c_str()) % nb_buckets);
     });
+  this->binary_->invalidate_symbols_index();
 
   it_symbols dynamic_symbols = this->binary_->dynamic_symbols();
 
@@ -989,7 +1097,8 @@ void Builder::build_symbol_gnuhash(uint32_t new_symndx) {
   size_t C = sizeof(uint__) * 8; // 32 for ELF, 64 for ELF64
 
   for (size_t i = symndx; i < dynamic_symbols.size(); ++i) {
-    const uint32_t hash = dl_new_hash(dynamic_symbols[i].name().c_str());
+    const Symbol& symbol = dynamic_symbols[i];
+    const uint32_t hash = dl_new_hash(symbol.name().c_str());
     const size_t pos = (hash / C) & (gnu_hash.maskwords() - 1);
     uint__ V = (static_cast<uint__>(1) << (hash % C)) |
                (static_cast<uint__>(1) << ((hash >> gnu_hash.shift2()) % C));
@@ -1010,8 +1119,9 @@ void Builder::build_symbol_gnuhash(uint32_t new_symndx) {
   std::vector<uint32_t> hash_values(dynamic_symbols.size() - symndx, 0);
 
   for (size_t i = symndx; i < dynamic_symbols.size(); ++i) {
-    LIEF_DEBUG("Dealing with symbol {}", dynamic_symbols[i]);
-    const uint32_t hash = dl_new_hash(dynamic_symbols[i].name().c_str());
+    const Symbol& symbol = dynamic_symbols[i];
+    LIEF_DEBUG("Dealing with symbol {}", symbol);
+    const uint32_t hash = dl_new_hash(symbol.name().c_str());
     int bucket = hash % nb_buckets;
 
     if (bucket < previous_bucket) {
@@ -1139,30 +1249,27 @@ void Builder::build_dynamic_symbols() {
 
   // Build symbols string table
   std::vector<uint8_t> string_table_raw = string_table_section.content();
-  std::unordered_map<std::string, size_t> offset_name_map;
   size_t additional_offset = string_table_raw.size() - 1;
 
-  std::vector<std::string> string_table_optimized =
-    this->optimize<Symbol, decltype(this->binary_->dynamic_symbols_)>(this->binary_->dynamic_symbols_,
-                                    [] (const Symbol* sym) { return sym->name(); },
-                                    &offset_name_map);
-
-  for (const std::string& name : string_table_optimized) {
-    string_table_raw.insert(std::end(string_table_raw), std::begin(name), std::end(name));
-    string_table_raw.push_back(0);
+  StringTableBuilder string_table;
+  string_table.reserve(this->binary_->dynamic_symbols_.size());
+  for (const Symbol* symbol : this->binary_->dynamic_symbols_) {
+    string_table.add(symbol->name());
   }
+  string_table.build();
+
+  // The first (null) byte of the new table is the last one of the original table
+  const std::vector<uint8_t>& new_strings = string_table.raw();
+  string_table_raw.insert(std::end(string_table_raw), std::begin(new_strings) + 1, std::end(new_strings));
+  const std::vector<size_t>& names_offset = string_table.offsets();
 
   //
   // Build symbols
   //
   vector_iostream symbol_table_raw(this->should_swap());
-  for (const Symbol* symbol : this->binary_->dynamic_symbols_) {
-    const std::string& name = symbol->name();
-    auto offset_it = offset_name_map.find(name);
-    if (offset_it == std::end(offset_name_map)) {
-      throw LIEF::not_found("Unable to find the symbol in the string table");
-    }
-    const Elf_Off name_offset = static_cast<Elf_Off>(offset_name_map[name] + additional_offset);
+  for (size_t i = 0; i < this->binary_->dynamic_symbols_.size(); ++i) {
+    const Symbol* symbol = this->binary_->dynamic_symbols_[i];
+    const Elf_Off name_offset = static_cast<Elf_Off>(names_offset[i] + additional_offset);
 
     Elf_Sym sym_header;
 
@@ -1240,131 +1347,84 @@ void Builder::build_dynamic_symbols() {
 }
 
 template<typename ELF_T>
-void Builder::build_section_relocations() {
-  using Elf_Addr   = typename ELF_T::Elf_Addr;
-  using Elf_Xword  = typename ELF_T::Elf_Xword;
-  using Elf_Sxword = typename ELF_T::Elf_Sxword;
-
-  using Elf_Rela   = typename ELF_T::Elf_Rela;
-  using Elf_Rel    = typename ELF_T::Elf_Rel;
+void Builder::build_section_relocations(const std::vector<std::pair<Section*, const Section*>>& sections,
+                                        bool is_rela, std::vector<std::vector<uint8_t>> contents) {
   LIEF_DEBUG("[+] Building relocations");
+  for (size_t i = 0; i < sections.size(); ++i) {
+    Section* section = sections[i].first;
+    std::vector<uint8_t>& content = contents[i];
 
-  it_object_relocations  object_relocations = this->binary_->object_relocations();
-
-  bool isRela = object_relocations[0].is_rela();
-  if (not std::all_of(
-        std::begin(object_relocations),
-        std::end(object_relocations),
-        [isRela] (const Relocation& relocation) {
-          return relocation.is_rela() == isRela;
-        })) {
-      throw LIEF::type_error("Object relocations are not of the same type");
-  }
+    LIEF_DEBUG("Section associated with object relocations: {} (is_rela: {})", section->name(), is_rela);
+    // Relocation the '.rela.xxxx' section
+    if (content.size() > section->original_size() and section->original_size() > 0) {
+      Section rela_section(section->name(), is_rela ? ELF_SECTION_TYPES::SHT_RELA : ELF_SECTION_TYPES::SHT_REL);
+      rela_section.content(content);
+      this->binary_->add(rela_section, false);
+      this->binary_->remove(*section, true);
 
-  it_sections sections = this->binary_->sections();
+      return this->build<ELF_T>();
 
-  std::vector<Section*> rel_section;
-  for (Section& S: sections) {
-    if (S.type() == ((isRela) ? ELF_SECTION_TYPES::SHT_RELA:ELF_SECTION_TYPES::SHT_REL)) {
-      rel_section.push_back(&S);
     }
+    section->content(std::move(content));
   }
+}
 
 
-  //  FIXME: Warn if not rel section found?
-
-  for (Section* section: rel_section) {
-
-    if (section->information() == 0 or section->information() >= sections.size())
-      throw LIEF::not_found("Unable to find associated section for SHT_REL{A} section");
-
-    const size_t sh_info = section->information();
-
-    Section& AssociatedSection = sections[sh_info];
-
-    std::vector<uint8_t> content;
-    for (const Relocation& relocation : this->binary_->object_relocations()) {
-
-      // Only write relocation in the matching section
-      // (relocation for .text in .rela.text)
-      // FIXME: static relocation on a new section will be ignored (SILENTLY!!)
-      if(relocation.section_ != &AssociatedSection)
-        continue;
-
-      uint32_t idx = 0;
-      if (relocation.has_symbol()) {
-        const Symbol& symbol    = relocation.symbol();
-        auto it_name  = std::find_if(
-            std::begin(this->binary_->dynamic_symbols_),
-            std::end(this->binary_->dynamic_symbols_),
-            [&symbol] (const Symbol* s) {
-            return s == &symbol;
-            });
-
-        if (it_name == std::end(this->binary_->dynamic_symbols_)) {
-          // FIXME: Do we have a way to walk both?
-          auto it_name  = std::find_if(
-              std::begin(this->binary_->static_symbols_),
-              std::end(this->binary_->static_symbols_),
-              [&symbol] (const Symbol* s) {
-              return s == &symbol;
-              });
-
-          if (it_name == std::end(this->binary_->static_symbols_)) {
-            throw not_found("Unable to find the symbol associated with the relocation");
-          }
-          idx = static_cast<uint32_t>(std::distance(std::begin(this->binary_->static_symbols_), it_name));
-        } else
-          idx = static_cast<uint32_t>(std::distance(std::begin(this->binary_->dynamic_symbols_), it_name));
-      }
-
-
-      Elf_Xword info = 0;
-      if (std::is_same<ELF_T, ELF32>::value) {
-        info = (static_cast<Elf_Xword>(idx) << 8) | relocation.type();
-      } else {
-        info = (static_cast<Elf_Xword>(idx) << 32) | (relocation.type() & 0xffffffffL);
-      }
+template<typename ELF_T>
+std::vector<uint8_t> Builder::serialize_section_relocations(const Section& section, bool is_rela,
+                                                            const symbols_idx_t& symbols_idx) const {
+  using Elf_Addr   = typename ELF_T::Elf_Addr;
+  using Elf_Xword  = typename ELF_T::Elf_Xword;
+  using Elf_Sxword = typename ELF_T::Elf_Sxword;
 
-      if (isRela) {
-        Elf_Rela relahdr;
-        relahdr.r_offset = static_cast<Elf_Addr>(relocation.address());
-        relahdr.r_info   = static_cast<Elf_Xword>(info);
-        relahdr.r_addend = static_cast<Elf_Sxword>(relocation.addend());
+  using Elf_Rela   = typename ELF_T::Elf_Rela;
+  using Elf_Rel    = typename ELF_T::Elf_Rel;
 
-        content.insert(
-            std::end(content),
-            reinterpret_cast<uint8_t*>(&relahdr),
-            reinterpret_cast<uint8_t*>(&relahdr) + sizeof(Elf_Rela));
+  vector_iostream content;
+  for (const Relocation* relocation : this->binary_->relocations_) {
+    // Only write relocation in the matching section
+    // (relocation for .text in .rela.text)
+    // FIXME: static relocation on a new section will be ignored (SILENTLY!!)
+    if (relocation->purpose() != RELOCATION_PURPOSES::RELOC_PURPOSE_OBJECT or
+        relocation->section_ != &section) {
+      continue;
+    }
 
-      } else {
-        Elf_Rel relhdr;
-        relhdr.r_offset = static_cast<Elf_Addr>(relocation.address());
-        relhdr.r_info   = static_cast<Elf_Xword>(info);
-
-        content.insert(
-            std::end(content),
-            reinterpret_cast<uint8_t*>(&relhdr),
-            reinterpret_cast<uint8_t*>(&relhdr) + sizeof(Elf_Rel));
+    uint32_t idx = 0;
+    if (relocation->has_symbol()) {
+      auto it_idx = symbols_idx.find(&relocation->symbol());
+      if (it_idx == std::end(symbols_idx)) {
+        throw not_found("Unable to find the symbol associated with the relocation");
       }
+      idx = it_idx->second;
+    }
 
+    Elf_Xword info = 0;
+    if (std::is_same<ELF_T, ELF32>::value) {
+      info = (static_cast<Elf_Xword>(idx) << 8) | relocation->type();
+    } else {
+      info = (static_cast<Elf_Xword>(idx) << 32) | (relocation->type() & 0xffffffffL);
     }
 
-    LIEF_DEBUG("Section associated with object relocations: {} (is_rela: {})", section->name(), isRela);
-    // Relocation the '.rela.xxxx' section
-    if (content.size() > section->original_size() and section->original_size() > 0) {
-      Section rela_section(section->name(), (isRela)?ELF_SECTION_TYPES::SHT_RELA:ELF_SECTION_TYPES::SHT_REL);
-      rela_section.content(content);
-      this->binary_->add(rela_section, false);
-      this->binary_->remove(*section, true);
+    if (is_rela) {
+      Elf_Rela relahdr;
+      relahdr.r_offset = static_cast<Elf_Addr>(relocation->address());
+      relahdr.r_info   = static_cast<Elf_Xword>(info);
+      relahdr.r_addend = static_cast<Elf_Sxword>(relocation->addend());
 
-      return this->build<ELF_T>();
+      content.write(reinterpret_cast<const uint8_t*>(&relahdr), sizeof(Elf_Rela));
+    } else {
+      Elf_Rel relhdr;
+      relhdr.r_offset = static_cast<Elf_Addr>(relocation->address());
+      relhdr.r_info   = static_cast<Elf_Xword>(info);
 
+      content.write(reinterpret_cast<const uint8_t*>(&relhdr), sizeof(Elf_Rel));
     }
-    section->content(std::move(content));
   }
+  return std::move(content.raw());
 }
 
+
 template<typename ELF_T>
 void Builder::build_dynamic_relocations() {
   using Elf_Addr   = typename ELF_T::Elf_Addr;
@@ -1485,13 +1545,13 @@ void Builder::build_dynamic_relocations() {
       relahdr.r_info   = static_cast<Elf_Xword>(r_info);
       relahdr.r_addend = static_cast<Elf_Sxword>(relocation.addend());
 
-      content.write_conv<Elf_Rela>(relahdr);
+      content.write(reinterpret_cast<const uint8_t*>(&relahdr), sizeof(Elf_Rela));
     } else {
       Elf_Rel relhdr;
       relhdr.r_offset = static_cast<Elf_Addr>(relocation.address());
       relhdr.r_info   = static_cast<Elf_Xword>(r_info);
 
-      content.write_conv<Elf_Rel>(relhdr);
+      content.write(reinterpret_cast<const uint8_t*>(&relhdr), sizeof(Elf_Rel));
     }
 
   }
@@ -1626,13 +1686,13 @@ void Builder::build_pltgot_relocations() {
       relahdr.r_info   = static_cast<Elf_Xword>(info);
       relahdr.r_addend = static_cast<Elf_Sxword>(relocation.addend());
 
-      content.write_conv<Elf_Rela>(relahdr);
+      content.write(reinterpret_cast<const uint8_t*>(&relahdr), sizeof(Elf_Rela));
     } else {
       Elf_Rel relhdr;
       relhdr.r_offset = static_cast<Elf_Addr>(relocation.address());
       relhdr.r_info   = static_cast<Elf_Xword>(info);
 
-      content.write_conv<Elf_Rel>(relhdr);
+      content.write(reinterpret_cast<const uint8_t*>(&relhdr), sizeof(Elf_Rel));
     }
   }
 
@@ -1960,19 +2020,15 @@ void Builder::relocate_dynamic_array(DynamicEntryArray& entry_array, DynamicEntr
 
     const ARCH arch = this->binary_->header().machine_type();
 
+    // The new relocations are registered once the array is processed
+    // so that the lookups below don't invalidate the address index
+    std::vector<Relocation*> new_relocations;
     for (size_t i = 0; i < array.size(); ++i) {
       Relocation* relocation = nullptr;
       uint64_t address_relocation = new_segment.virtual_address() + i * sizeof(uint__);
-      auto&& it_relocation = std::find_if(
-          std::begin(this->binary_->relocations_),
-          std::end(this->binary_->relocations_),
-          [&address_relocation] (const Relocation* r) {
-            return r->address() == address_relocation;
-          });
-
 
       // It's ok there is a relocation for the entry #i
-      if (it_relocation != std::end(this->binary_->relocations_)) {
+      if (this->binary_->get_relocation(address_relocation) != nullptr) {
         continue;
       }
 
@@ -1990,38 +2046,38 @@ void Builder::relocate_dynamic_array(DynamicEntryArray& entry_array, DynamicEntr
       switch (arch) {
         case ARCH::EM_ARM:
         {
-          relocation = new Relocation(address_relocation, RELOC_ARM::R_ARM_RELATIVE, array[i], is_rela);
+          relocation = this->binary_->relocations_pool_->create(address_relocation, RELOC_ARM::R_ARM_RELATIVE, array[i], is_rela).release();
           break;
         }
 
         case ARCH::EM_AARCH64:
         {
-          relocation = new Relocation(address_relocation, RELOC_AARCH64::R_AARCH64_RELATIVE, array[i], is_rela);
+          relocation = this->binary_->relocations_pool_->create(address_relocation, RELOC_AARCH64::R_AARCH64_RELATIVE, array[i], is_rela).release();
           break;
         }
 
         case ARCH::EM_386:
         {
-          relocation = new Relocation(address_relocation, RELOC_i386::R_386_RELATIVE, array[i], is_rela);
+          relocation = this->binary_->relocations_pool_->create(address_relocation, RELOC_i386::R_386_RELATIVE, array[i], is_rela).release();
           break;
         }
 
         case ARCH::EM_X86_64:
         {
-          relocation = new Relocation(address_relocation, RELOC_x86_64::R_X86_64_RELATIVE, array[i], is_rela);
+          relocation = this->binary_->relocations_pool_->create(address_relocation, RELOC_x86_64::R_X86_64_RELATIVE, array[i], is_rela).release();
           break;
         }
 
         case ARCH::EM_PPC:
         {
-          relocation = new Relocation(address_relocation, RELOC_POWERPC32::R_PPC_RELATIVE, array[i], is_rela);
+          relocation = this->binary_->relocations_pool_->create(address_relocation, RELOC_POWERPC32::R_PPC_RELATIVE, array[i], is_rela).release();
           break;
         }
 
         /*
         case ARCH::EM_PPC64:
         {
-          relocation = new Relocation(address_relocation, RELOC_POWERPC64::R_PPC64_RELATIVE, array[i], is_rela);
+          relocation = this->binary_->relocations_pool_->create(address_relocation, RELOC_POWERPC64::R_PPC64_RELATIVE, array[i], is_rela).release();
           break;
         }
         */
@@ -2035,10 +2091,13 @@ void Builder::relocate_dynamic_array(DynamicEntryArray& entry_array, DynamicEntr
       if (relocation != nullptr) {
         relocation->purpose(RELOCATION_PURPOSES::RELOC_PURPOSE_DYNAMIC);
         relocation->architecture_ = arch;
-        this->binary_->relocations_.push_back(relocation);
+        new_relocations.push_back(relocation);
         LIEF_DEBUG("Relocation added: {}", *relocation);
       }
     }
+    this->binary_->relocations_.insert(std::end(this->binary_->relocations_),
+        std::begin(new_relocations), std::end(new_relocations));
+    this->binary_->invalidate_address_index();
   }
 
   entry_array.value(new_segment.virtual_address());
@@ -2104,49 +2163,12 @@ void Builder::build_interpreter() {
 }
 
 template<typename ELF_T>
-void Builder::build_notes() {
+void Builder::build_notes(std::vector<uint8_t> raw_notes) {
   if (not this->binary_->has(SEGMENT_TYPES::PT_NOTE)) {
     return;
   }
 
   Segment& segment_note = this->binary_->get(SEGMENT_TYPES::PT_NOTE);
-  vector_iostream raw_notes(this->should_swap());
-  for (const Note& note : this->binary_->notes()) {
-    // First we have to write the length of the Note's name
-    const uint32_t namesz = static_cast<uint32_t>(note.name().size() + 1);
-    raw_notes.write_conv<uint32_t>(namesz);
-
-    // Then the length of the Note's description
-    const uint32_t descsz = static_cast<uint32_t>(note.description().size());
-    //const uint32_t descsz = 20;
-    raw_notes.write_conv<uint32_t>(descsz);
-
-    // Then the note's type
-    const NOTE_TYPES type = note.type();
-    raw_notes.write_conv<uint32_t>(static_cast<uint32_t>(type));
-
-    // Then we write the note's name
-    const std::string& name = note.name();
-    raw_notes.write(name);
-
-    // Alignment
-    raw_notes.align(sizeof(uint32_t), 0);
-
-    // description content (manipulated in 4 byte/uint32_t chunks)
-    const std::vector<uint8_t>& description = note.description();
-    const uint32_t *desc_ptr = reinterpret_cast<const uint32_t*>(description.data()) ;
-    size_t i = 0;
-    for (; i < description.size() / sizeof(uint32_t); i++) {
-      raw_notes.write_conv<uint32_t>(desc_ptr[i]);
-    }
-    if (description.size() % sizeof(uint32_t) != 0) {
-      uint32_t padded = 0;
-      uint8_t *ptr = reinterpret_cast<uint8_t*>(&padded);
-      memcpy(ptr, desc_ptr + i, description.size() % sizeof(uint32_t));
-      raw_notes.write_conv<uint32_t>(padded);
-    }
-  }
-
   if (segment_note.physical_size() < raw_notes.size() and segment_note.physical_size() > 0) {
     LIEF_INFO("Segment Note needs to be relocated");
     Segment note = segment_note;
@@ -2155,12 +2177,12 @@ void Builder::build_notes() {
     note.physical_address(0);
     note.physical_size(0);
     note.virtual_size(0);
-    note.content(raw_notes.raw());
+    note.content(raw_notes);
     this->binary_->replace(note, segment_note);
     return this->build<ELF_T>();
   }
 
-  segment_note.content(raw_notes.raw());
+  segment_note.content(std::move(raw_notes));
 
   // ".note.ABI-tag" // NOTE_TYPES::NT_GNU_ABI_TAG
   // ===============
@@ -2234,8 +2256,7 @@ void Builder::build_overlay() {
   const uint64_t last_offset = this->binary_->eof_offset();
 
   if (last_offset > 0 and overlay.size() > 0) {
-    this->ios_.seekp(last_offset);
-    this->ios_.write(overlay);
+    this->emit(last_offset, overlay);
   }
 }
 
@@ -16,11 +16,13 @@
 #include <iostream>
 #include <stdexcept>
 #include <algorithm>
+#include <cstring>
 
 #include "logging.hpp"
 
 #include "LIEF/BinaryStream/MemoryStream.hpp"
 #include "LIEF/BinaryStream/VectorStream.hpp"
+#include "LIEF/BinaryStream/MmapStream.hpp"
 
 #include "LIEF/ELF/DataHandler/Handler.hpp"
 #include "LIEF/exception.hpp"
@@ -34,71 +36,451 @@ Handler& Handler::operator=(const Handler&) = default;
 Handler::Handler(const Handler&) = default;
 
 Handler::Handler(const std::vector<uint8_t>& content) :
-  data_{content}
-{}
+  size_{content.size()}
+{
+  if (this->size_ > 0) {
+    this->chunks_.emplace(0, Chunk{Chunk::KIND::OWNED, this->size_, 0, content});
+  }
+}
 
 
 Handler::Handler(std::vector<uint8_t>&& content) :
-  data_{std::move(content)}
-{}
+  size_{content.size()}
+{
+  if (this->size_ > 0) {
+    this->chunks_.emplace(0, Chunk{Chunk::KIND::OWNED, this->size_, 0, std::move(content)});
+  }
+}
 
 Handler::Handler(BinaryStream& stream) {
+  if (stream.type() == BinaryStream::STREAM_TYPE::UNKNOWN) {
+    LIEF_ERR("Unknown stream type!");
+    return;
+  }
 
-  switch (stream.type()) {
-    case BinaryStream::STREAM_TYPE::FILE:
-      {
-        auto& vs = reinterpret_cast<VectorStream&>(stream);
-        data_ = vs.content();
-        break;
+  const uint64_t size = stream.size();
+  if (size == static_cast<uint64_t>(-1)) {
+    LIEF_ERR("Can't create a data handler from a stream without size");
+    return;
+  }
+
+  const uint8_t* raw = stream.peek_array<uint8_t>(0, size, /* check */ false);
+  if (raw == nullptr or size == 0) {
+    return;
+  }
+  this->size_ = size;
+  this->chunks_.emplace(0, Chunk{Chunk::KIND::OWNED, size, 0, {raw, raw + size}});
+}
+
+Handler::Handler(std::shared_ptr<BinaryStream> stream) :
+  stream_{std::move(stream)}
+{
+  if (this->stream_ == nullptr or this->stream_->type() == BinaryStream::STREAM_TYPE::UNKNOWN) {
+    LIEF_ERR("Unknown stream type!");
+    return;
+  }
+
+  const uint64_t size = this->stream_->size();
+  if (size == static_cast<uint64_t>(-1)) {
+    LIEF_ERR("Can't create a data handler from a stream without size");
+    return;
+  }
+
+  this->base_ = this->stream_->peek_array<uint8_t>(0, size, /* check */ false);
+  if (this->base_ == nullptr or size == 0) {
+    return;
+  }
+  this->size_      = size;
+  this->base_size_ = size;
+  this->chunks_.emplace(0, Chunk{Chunk::KIND::BASE, size, 0, {}});
+}
+
+uint64_t Handler::size() const {
+  return this->size_;
+}
+
+const std::vector<uint8_t>& Handler::content() const {
+  return const_cast<Handler*>(this)->content();
+}
+
+std::vector<uint8_t>& Handler::content() {
+  if (this->size_ == 0) {
+    this->empty_.clear();
+    return this->empty_;
+  }
+  // Materializing the whole range merges the chunks into a single one
+  this->materialize(0, this->size_);
+  return std::begin(this->chunks_)->second.data;
+}
+
+Handler::chunks_t::iterator Handler::split(uint64_t offset) {
+  if (offset >= this->size_) {
+    return std::end(this->chunks_);
+  }
+
+  auto it = this->chunks_.upper_bound(offset);
+  --it;
+  if (it->first == offset) {
+    return it;
+  }
+
+  Chunk& chunk = it->second;
+  const uint64_t delta = offset - it->first;
+
+  Chunk tail{chunk.kind, chunk.size - delta, chunk.base_offset + delta, {}};
+  if (chunk.kind == Chunk::KIND::OWNED) {
+    tail.data.assign(std::begin(chunk.data) + delta, std::end(chunk.data));
+    chunk.data.resize(delta);
+  }
+  chunk.size = delta;
+  return this->chunks_.emplace_hint(std::next(it), offset, std::move(tail));
+}
+
+void Handler::materialize(uint64_t offset, uint64_t size) {
+  if (size == 0 or offset >= this->size_) {
+    return;
+  }
+
+  const uint64_t start = offset - (offset % PAGE_GRANULARITY);
+  const uint64_t end   = std::min<uint64_t>(align(offset + size, PAGE_GRANULARITY), this->size_);
+
+  this->split(end);
+  auto it = this->split(start);
+
+  for (; it != std::end(this->chunks_) and it->first < end; ++it) {
+    Chunk& chunk = it->second;
+    if (chunk.kind == Chunk::KIND::BASE) {
+      const uint8_t* ptr = this->base_ + chunk.base_offset;
+      chunk.data.assign(ptr, ptr + chunk.size);
+    }
+    else if (chunk.kind == Chunk::KIND::ZERO) {
+      chunk.data.assign(chunk.size, 0);
+    }
+    chunk.kind = Chunk::KIND::OWNED;
+  }
+
+  // Coalesce the owned chunks around the range to keep the map small
+  auto first = this->chunks_.upper_bound(start);
+  --first;
+  if (first != std::begin(this->chunks_) and std::prev(first)->second.kind == Chunk::KIND::OWNED) {
+    --first;
+  }
+  auto last = std::next(first);
+  while (last != std::end(this->chunks_) and
+         last->second.kind == Chunk::KIND::OWNED and last->first <= end)
+  {
+    Chunk& dst = first->second;
+    Chunk& src = last->second;
+    dst.data.insert(std::end(dst.data), std::begin(src.data), std::end(src.data));
+    dst.size += src.size;
+    last = this->chunks_.erase(last);
+  }
+}
+
+void Handler::read(uint64_t offset, uint64_t size, uint8_t* out) const {
+  if (size == 0) {
+    return;
+  }
+
+  const uint64_t available = offset < this->size_ ? std::min<uint64_t>(size, this->size_ - offset) : 0;
+  if (available < size) {
+    std::memset(out + available, 0, size - available);
+  }
+
+  if (available == 0) {
+    return;
+  }
+
+  auto it = this->chunks_.upper_bound(offset);
+  --it;
+
+  uint64_t pos = offset;
+  uint64_t remaining = available;
+  while (remaining > 0) {
+    const Chunk& chunk = it->second;
+    const uint64_t delta = pos - it->first;
+    const uint64_t count = std::min<uint64_t>(chunk.size - delta, remaining);
+    switch (chunk.kind) {
+      case Chunk::KIND::BASE:
+        {
+          std::memcpy(out, this->base_ + chunk.base_offset + delta, count);
+          break;
+        }
+      case Chunk::KIND::ZERO:
+        {
+          std::memset(out, 0, count);
+          break;
+        }
+      case Chunk::KIND::OWNED:
+        {
+          std::memcpy(out, chunk.data.data() + delta, count);
+          break;
+        }
+    }
+    out       += count;
+    pos       += count;
+    remaining -= count;
+    ++it;
+  }
+}
+
+Handler::Extent::Extent(uint64_t offset, uint64_t size, const uint8_t* data,
+                        bool from_stream, uint64_t stream_offset) :
+  offset{offset},
+  size{size},
+  data{data},
+  from_stream{from_stream},
+  stream_offset{stream_offset}
+{}
+
+std::vector<Handler::Extent> Handler::extents(uint64_t offset, uint64_t size) const {
+  std::vector<Extent> extents;
+  if (size == 0) {
+    return extents;
+  }
+
+  const uint64_t available = offset < this->size_ ? std::min<uint64_t>(size, this->size_ - offset) : 0;
+  if (available > 0) {
+    auto it = this->chunks_.upper_bound(offset);
+    --it;
+
+    uint64_t pos = offset;
+    uint64_t remaining = available;
+    while (remaining > 0) {
+      const Chunk& chunk = it->second;
+      const uint64_t delta = pos - it->first;
+      const uint64_t count = std::min<uint64_t>(chunk.size - delta, remaining);
+      switch (chunk.kind) {
+        case Chunk::KIND::BASE:
+          {
+            const uint64_t base_offset = chunk.base_offset + delta;
+            extents.emplace_back(pos, count, this->base_ + base_offset, /* from_stream */ true, base_offset);
+            break;
+          }
+        case Chunk::KIND::ZERO:
+          {
+            extents.emplace_back(pos, count, nullptr, /* from_stream */ false, 0);
+            break;
+          }
+        case Chunk::KIND::OWNED:
+          {
+            extents.emplace_back(pos, count, chunk.data.data() + delta, /* from_stream */ false, 0);
+            break;
+          }
       }
+      pos       += count;
+      remaining -= count;
+      ++it;
+    }
+  }
 
-    case BinaryStream::STREAM_TYPE::MEMORY:
+  if (available < size) {
+    extents.emplace_back(offset + available, size - available, nullptr, /* from_stream */ false, 0);
+  }
+  return extents;
+}
+
+int Handler::stream_fd() const {
+  if (this->stream_ == nullptr or this->base_ == nullptr or
+      this->stream_->type() != BinaryStream::STREAM_TYPE::MMAP)
+  {
+    return -1;
+  }
+  return static_cast<const MmapStream&>(*this->stream_).fd();
+}
+
+std::vector<uint8_t> Handler::read(uint64_t offset, uint64_t size) const {
+  std::vector<uint8_t> out(size);
+  this->read(offset, size, out.data());
+  return out;
+}
+
+const uint8_t* Handler::view(uint64_t offset, uint64_t size) const {
+  if (size == 0 or offset >= this->size_ or size > this->size_ - offset) {
+    return nullptr;
+  }
+
+  auto it = this->chunks_.upper_bound(offset);
+  --it;
+
+  const Chunk& chunk = it->second;
+  const uint64_t delta = offset - it->first;
+  if (chunk.size - delta < size) {
+    return nullptr;
+  }
+
+  switch (chunk.kind) {
+    case Chunk::KIND::BASE:
       {
-        throw std::runtime_error("Not impletemented yet");
-        break;
+        return this->base_ + chunk.base_offset + delta;
       }
-
-    case BinaryStream::STREAM_TYPE::UNKNOWN:
-    default:
+    case Chunk::KIND::OWNED:
       {
-        LIEF_ERR("Unknown stream type!");
+        return chunk.data.data() + delta;
+      }
+    case Chunk::KIND::ZERO:
+      {
+        return nullptr;
       }
   }
+  return nullptr;
 }
 
-const std::vector<uint8_t>& Handler::content() const {
-  return this->data_;
+void Handler::write(uint64_t offset, const uint8_t* data, uint64_t size) {
+  if (size == 0) {
+    return;
+  }
+  this->reserve(offset, size);
+  this->materialize(offset, size);
+
+  auto it = this->chunks_.upper_bound(offset);
+  --it;
+
+  uint64_t pos = offset;
+  uint64_t remaining = size;
+  while (remaining > 0) {
+    Chunk& chunk = it->second;
+    const uint64_t delta = pos - it->first;
+    const uint64_t count = std::min<uint64_t>(chunk.size - delta, remaining);
+    std::memcpy(chunk.data.data() + delta, data, count);
+    data      += count;
+    pos       += count;
+    remaining -= count;
+    ++it;
+  }
 }
 
-std::vector<uint8_t>& Handler::content() {
-  return const_cast<std::vector<uint8_t>&>(static_cast<const Handler*>(this)->content());
+void Handler::fill(uint64_t offset, uint64_t size, uint8_t value) {
+  if (size == 0) {
+    return;
+  }
+  this->reserve(offset, size);
+  this->materialize(offset, size);
+
+  auto it = this->chunks_.upper_bound(offset);
+  --it;
+
+  uint64_t pos = offset;
+  uint64_t remaining = size;
+  while (remaining > 0) {
+    Chunk& chunk = it->second;
+    const uint64_t delta = pos - it->first;
+    const uint64_t count = std::min<uint64_t>(chunk.size - delta, remaining);
+    std::memset(chunk.data.data() + delta, value, count);
+    pos       += count;
+    remaining -= count;
+    ++it;
+  }
 }
 
-bool Handler::has(uint64_t offset, uint64_t size, Node::Type type) {
-  Node tmp{offset, size, type};
-  auto&& it_node = std::find_if(
-      std::begin(this->nodes_),
-      std::end(this->nodes_),
-      [&tmp] (const Node* node)
+uint64_t Handler::materialized_size() const {
+  uint64_t size = 0;
+  for (const auto& p : this->chunks_) {
+    if (p.second.kind == Chunk::KIND::OWNED) {
+      size += p.second.size;
+    }
+  }
+  return size;
+}
+
+bool Handler::is_patchable() const {
+  return this->base_ != nullptr and not this->shifted_ and this->size_ == this->base_size_;
+}
+
+std::vector<std::pair<uint64_t, std::vector<uint8_t>>> Handler::diff() const {
+  // Unmodified bytes shorter than this gap are merged in the surrounding
+  // patches to keep the list compact
+  static constexpr uint64_t MIN_GAP = 8;
+
+  std::vector<std::pair<uint64_t, std::vector<uint8_t>>> patches;
+  if (not this->is_patchable()) {
+    LIEF_ERR("The content can't be expressed as patches of the original stream");
+    return patches;
+  }
+
+  for (const auto& p : this->chunks_) {
+    const uint64_t offset = p.first;
+    const Chunk& chunk    = p.second;
+    if (chunk.kind == Chunk::KIND::BASE) {
+      continue;
+    }
+    const uint8_t* original = this->base_ + offset;
+    for (uint64_t i = 0; i < chunk.size; ++i) {
+      const uint8_t value = chunk.kind == Chunk::KIND::OWNED ? chunk.data[i] : 0;
+      if (value == original[i]) {
+        continue;
+      }
+      const uint64_t current = offset + i;
+      if (patches.empty() or
+          current > patches.back().first + patches.back().second.size() + MIN_GAP)
       {
-        return tmp == *node;
-      });
-  return it_node != std::end(this->nodes_);
+        patches.emplace_back(current, std::vector<uint8_t>{});
+      }
+      // Fill the gap with the (unmodified) bytes of the content
+      std::vector<uint8_t>& bytes = patches.back().second;
+      const uint64_t end = patches.back().first + bytes.size();
+      if (end < current) {
+        const size_t gap = bytes.size();
+        bytes.resize(gap + (current - end));
+        this->read(end, current - end, bytes.data() + gap);
+      }
+      bytes.push_back(value);
+    }
+  }
+  return patches;
 }
 
-Node& Handler::get(uint64_t offset, uint64_t size, Node::Type type) {
-  Node tmp{offset, size, type};
+bool Handler::is_mapping(const std::string& path) const {
+  if (this->stream_ == nullptr or this->base_ == nullptr or
+      this->stream_->type() != BinaryStream::STREAM_TYPE::MMAP)
+  {
+    return false;
+  }
+  return static_cast<const MmapStream&>(*this->stream_).is_mapping(path);
+}
 
-  auto&& it_node = std::find_if(
-        std::begin(this->nodes_),
-        std::end(this->nodes_),
-        [&tmp] (const Node* node)
-        {
-          return tmp == *node;
-        });
+void Handler::detach() {
+  if (this->stream_ == nullptr) {
+    return;
+  }
+  for (auto& p : this->chunks_) {
+    Chunk& chunk = p.second;
+    if (chunk.kind == Chunk::KIND::BASE) {
+      const uint8_t* ptr = this->base_ + chunk.base_offset;
+      chunk.data.assign(ptr, ptr + chunk.size);
+      chunk.kind = Chunk::KIND::OWNED;
+    }
+  }
+  this->stream_.reset();
+  this->base_ = nullptr;
+}
 
+Handler::nodes_t::iterator Handler::find(const Node& node) {
+  const node_key_t key{node.type(), node.offset(), node.size()};
+  auto range = this->nodes_.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == &node) {
+      return it;
+    }
+  }
+  return std::end(this->nodes_);
+}
+
+Node& Handler::insert(Node* node) {
+  uint64_t& max_size = this->max_node_size_[node->type()];
+  max_size = std::max(max_size, node->size());
+  this->nodes_.emplace(node_key_t{node->type(), node->offset(), node->size()}, node);
+  return *node;
+}
+
+bool Handler::has(uint64_t offset, uint64_t size, Node::Type type) {
+  return this->nodes_.find(node_key_t{type, offset, size}) != std::end(this->nodes_);
+}
+
+Node& Handler::get(uint64_t offset, uint64_t size, Node::Type type) {
+  auto it_node = this->nodes_.find(node_key_t{type, offset, size});
   if (it_node != std::end(this->nodes_)) {
-    return **it_node;
+    return *it_node->second;
   } else {
     throw not_found("Unable to find node");
   }
@@ -106,19 +488,9 @@ Node& Handler::get(uint64_t offset, uint64_t size, Node::Type type) {
 
 
 void Handler::remove(uint64_t offset, uint64_t size, Node::Type type) {
-
-  Node tmp{offset, size, type};
-
-  auto&& it_node = std::find_if(
-        std::begin(this->nodes_),
-        std::end(this->nodes_),
-        [&tmp] (const Node* node)
-        {
-          return tmp == *node;
-        });
-
+  auto it_node = this->nodes_.find(node_key_t{type, offset, size});
   if (it_node != std::end(this->nodes_)) {
-    delete *it_node;
+    delete it_node->second;
     this->nodes_.erase(it_node);
   } else {
     throw not_found("Unable to find node");
@@ -127,19 +499,77 @@ void Handler::remove(uint64_t offset, uint64_t size, Node::Type type) {
 
 
 Node& Handler::create(uint64_t offset, uint64_t size, Node::Type type) {
-  this->nodes_.emplace_back(new Node{offset, size, type});
-  return *this->nodes_.back();
+  return this->insert(new Node{offset, size, type});
 }
 
 
 Node& Handler::add(const Node& node) {
-  this->nodes_.push_back(new Node{node});
-  return *this->nodes_.back();
+  return this->insert(new Node{node});
+}
+
+
+Node& Handler::move(Node& node, uint64_t offset) {
+  auto it_node = this->find(node);
+  if (it_node == std::end(this->nodes_)) {
+    throw not_found("Unable to find node");
+  }
+  this->nodes_.erase(it_node);
+  node.offset(offset);
+  return this->insert(&node);
+}
+
+
+Node& Handler::resize(Node& node, uint64_t size) {
+  auto it_node = this->find(node);
+  if (it_node == std::end(this->nodes_)) {
+    throw not_found("Unable to find node");
+  }
+  this->nodes_.erase(it_node);
+  node.size(size);
+  return this->insert(&node);
+}
+
+
+std::vector<Node*> Handler::overlapping(uint64_t offset, uint64_t size, Node::Type type) const {
+  std::vector<Node*> result;
+  const uint64_t max_size = this->max_node_size_[type];
+  const uint64_t start    = offset > max_size ? offset - max_size : 0;
+  const uint64_t end      = offset + std::max<uint64_t>(size, 1);
+
+  for (auto it = this->nodes_.lower_bound(node_key_t{type, start, 0});
+       it != std::end(this->nodes_); ++it)
+  {
+    const Node& node = *it->second;
+    if (node.type() != type or node.offset() >= end) {
+      break;
+    }
+    if (node.offset() + std::max<uint64_t>(node.size(), 1) > offset) {
+      result.push_back(it->second);
+    }
+  }
+  return result;
 }
 
 void Handler::make_hole(uint64_t offset, uint64_t size) {
   this->reserve(offset, size);
-  this->data_.insert(std::begin(this->data_) + offset, size, 0);
+  if (size == 0) {
+    return;
+  }
+
+  // Shift the chunks located after the hole
+  std::vector<std::pair<uint64_t, Chunk>> tail;
+  auto it = this->split(offset);
+  for (auto shifted = it; shifted != std::end(this->chunks_); ++shifted) {
+    tail.emplace_back(shifted->first + size, std::move(shifted->second));
+  }
+  this->chunks_.erase(it, std::end(this->chunks_));
+
+  this->chunks_.emplace(offset, Chunk{Chunk::KIND::ZERO, size, 0, {}});
+  for (std::pair<uint64_t, Chunk>& p : tail) {
+    this->chunks_.emplace_hint(std::end(this->chunks_), p.first, std::move(p.second));
+  }
+  this->size_ += size;
+  this->shifted_ = true;
 }
 
 
@@ -147,14 +577,23 @@ void Handler::reserve(uint64_t offset, uint64_t size) {
   if ((offset + size) > Handler::MAX_SIZE) {
     throw std::bad_alloc();
   }
-  if (this->data_.size() < (offset + size)) {
-    this->data_.resize((offset + size), 0);
+  if (this->size_ >= (offset + size)) {
+    return;
+  }
+
+  const uint64_t delta = (offset + size) - this->size_;
+  auto last = this->chunks_.rbegin();
+  if (last != this->chunks_.rend() and last->second.kind == Chunk::KIND::ZERO) {
+    last->second.size += delta;
+  } else {
+    this->chunks_.emplace_hint(std::end(this->chunks_), this->size_, Chunk{Chunk::KIND::ZERO, delta, 0, {}});
   }
+  this->size_ = offset + size;
 }
 
 Handler::~Handler() {
-  for (Node* n : this->nodes_) {
-    delete n;
+  for (auto& p : this->nodes_) {
+    delete p.second;
   }
 }
 
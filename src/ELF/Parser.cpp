@@ -25,6 +25,8 @@
 
 #include "LIEF/exception.hpp"
 #include "LIEF/BinaryStream/VectorStream.hpp"
+#include "LIEF/BinaryStream/MmapStream.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
 
 #include "LIEF/ELF/utils.hpp"
 #include "LIEF/ELF/Parser.hpp"
@@ -40,6 +42,9 @@
 
 #include "filesystem/filesystem.h"
 
+#include "index_tracker.hpp"
+#include "symbols_index.hpp"
+
 #include "Parser.tcc"
 
 namespace LIEF {
@@ -62,11 +67,11 @@ constexpr const char AndroidNote::NAME[];
 Parser::~Parser() = default;
 Parser::Parser()  = default;
 
-Parser::Parser(const std::vector<uint8_t>& data, const std::string& name, DYNSYM_COUNT_METHODS count_mtd, Binary* output) :
+Parser::Parser(const std::vector<uint8_t>& data, const std::string& name, const ParserConfig& conf, Binary* output) :
   stream_{std::unique_ptr<VectorStream>(new VectorStream{data})},
   binary_{nullptr},
   type_{ELF_CLASS::ELFCLASSNONE},
-  count_mtd_{count_mtd}
+  config_{conf}
 {
   if (output) {
     this->binary_ = output;
@@ -76,11 +81,21 @@ Parser::Parser(const std::vector<uint8_t>& data, const std::string& name, DYNSYM
   this->init(name);
 }
 
-Parser::Parser(const std::string& file, DYNSYM_COUNT_METHODS count_mtd, Binary* output) :
+Parser::Parser(const uint8_t* data, size_t size, const std::string& name, const ParserConfig& conf) :
+  stream_{std::unique_ptr<SpanStream>(new SpanStream{data, size})},
+  binary_{new Binary{}},
+  type_{ELF_CLASS::ELFCLASSNONE},
+  config_{conf}
+{
+  this->binary_size_ = size;
+  this->init(name);
+}
+
+Parser::Parser(const std::string& file, const ParserConfig& conf, Binary* output) :
   LIEF::Parser{file},
   binary_{nullptr},
   type_{ELF_CLASS::ELFCLASSNONE},
-  count_mtd_{count_mtd}
+  config_{conf}
 {
   if (output) {
     this->binary_ = output;
@@ -88,7 +103,7 @@ Parser::Parser(const std::string& file, DYNSYM_COUNT_METHODS count_mtd, Binary*
     this->binary_ = new Binary{};
   }
 
-  this->stream_ = std::unique_ptr<VectorStream>(new VectorStream{file});
+  this->stream_ = std::unique_ptr<MmapStream>(new MmapStream{file});
   this->init(filesystem::path(file).filename());
 }
 
@@ -121,7 +136,7 @@ void Parser::init(const std::string& name) {
   try {
     this->binary_->original_size_ = this->binary_size_;
     this->binary_->name(name);
-    this->binary_->datahandler_ = new DataHandler::Handler{*stream_};
+    this->binary_->datahandler_ = new DataHandler::Handler{this->stream_};
 
     const Elf32_Ehdr& elf_hdr = this->stream_->peek<Elf32_Ehdr>(0);
     this->stream_->set_endian_swap(this->should_swap());
@@ -154,27 +169,141 @@ void Parser::init(const std::string& name) {
 }
 
 std::unique_ptr<Binary> Parser::parse(const std::string& filename, DYNSYM_COUNT_METHODS count_mtd) {
-  if (not is_elf(filename)) {
-    LIEF_ERR("{} is not an ELF", filename);
-    return nullptr;
-  }
-
-  Parser parser{filename, count_mtd};
-  return std::unique_ptr<Binary>{parser.binary_};
+  ParserConfig conf = ParserConfig::all();
+  conf.count_mtd = count_mtd;
+  return Parser::parse(filename, conf);
 }
 
 std::unique_ptr<Binary> Parser::parse(
     const std::vector<uint8_t>& data,
     const std::string& name,
     DYNSYM_COUNT_METHODS count_mtd) {
+  ParserConfig conf = ParserConfig::all();
+  conf.count_mtd = count_mtd;
+  return Parser::parse(data, name, conf);
+}
+
+std::unique_ptr<Binary> Parser::parse(const std::string& filename, const ParserConfig& conf) {
+  if (not is_elf(filename)) {
+    LIEF_ERR("{} is not an ELF", filename);
+    return nullptr;
+  }
+
+  std::unique_ptr<Parser> parser{new Parser{filename, conf}};
+  return Parser::take_binary(std::move(parser));
+}
 
+std::unique_ptr<Binary> Parser::parse(const std::vector<uint8_t>& data, const std::string& name,
+                                      const ParserConfig& conf) {
   if (not is_elf(data)) {
     LIEF_ERR("{} is not an ELF", name);
     return nullptr;
   }
 
-  Parser parser{data, name, count_mtd};
-  return std::unique_ptr<Binary>{parser.binary_};
+  std::unique_ptr<Parser> parser{new Parser{data, name, conf}};
+  return Parser::take_binary(std::move(parser));
+}
+
+std::unique_ptr<Binary> Parser::parse(const uint8_t* data, size_t size, const std::string& name,
+                                      const ParserConfig& conf) {
+  if (not is_elf(data, size)) {
+    LIEF_ERR("{} is not an ELF", name);
+    return nullptr;
+  }
+
+  std::unique_ptr<Parser> parser{new Parser{data, size, name, conf}};
+  return Parser::take_binary(std::move(parser));
+}
+
+std::unique_ptr<Binary> Parser::take_binary(std::unique_ptr<Parser> parser) {
+  std::unique_ptr<Binary> binary{parser->binary_};
+  // The tables are the ones of the file: the Builder can keep them as-is
+  binary->modified_ = Binary::MODIFIED_NONE;
+  // Likewise, the hash tables can be used by the lookups until a dynamic symbol
+  // is added, removed or renamed. The symbols must be indexed to be tracked.
+  binary->dynamic_symbols_index_->refresh();
+  binary->index_tracker_->reset(IndexTracker::DYNAMIC_HASH);
+  // The parser is kept alive to parse the skipped tables on demand
+  if (parser->has_deferred()) {
+    binary->parser_ = std::move(parser);
+    binary->has_deferred_ = true;
+  }
+  return binary;
+}
+
+bool Parser::has_deferred() const {
+  return not this->config_.parse_static_symbols or
+         not this->config_.parse_relocations or
+         not this->config_.parse_symbol_versions or
+         not this->config_.parse_notes;
+}
+
+void Parser::parse_deferred_static_symbols() {
+  if (this->config_.parse_static_symbols) {
+    return;
+  }
+  this->config_.parse_static_symbols = true;
+  LIEF_DEBUG("Parsing the deferred static symbols");
+  try {
+    if (this->type_ == ELF_CLASS::ELFCLASS32) {
+      this->parse_static_symbols_table<ELF32>();
+    } else {
+      this->parse_static_symbols_table<ELF64>();
+    }
+  } catch (const std::exception& e) {
+    LIEF_WARN("{}", e.what());
+  }
+}
+
+void Parser::parse_deferred_relocations() {
+  if (this->config_.parse_relocations) {
+    return;
+  }
+  // The relocations of the object files reference the static symbols
+  this->parse_deferred_static_symbols();
+
+  this->config_.parse_relocations = true;
+  LIEF_DEBUG("Parsing the deferred relocations");
+  try {
+    if (this->type_ == ELF_CLASS::ELFCLASS32) {
+      this->parse_relocations<ELF32>();
+    } else {
+      this->parse_relocations<ELF64>();
+    }
+  } catch (const std::exception& e) {
+    LIEF_WARN("{}", e.what());
+  }
+  this->binary_->invalidate_address_index();
+}
+
+void Parser::parse_deferred_symbol_versions() {
+  if (this->config_.parse_symbol_versions) {
+    return;
+  }
+  this->config_.parse_symbol_versions = true;
+  LIEF_DEBUG("Parsing the deferred symbol versions");
+  try {
+    if (this->type_ == ELF_CLASS::ELFCLASS32) {
+      this->parse_symbol_versions<ELF32>();
+    } else {
+      this->parse_symbol_versions<ELF64>();
+    }
+  } catch (const std::exception& e) {
+    LIEF_WARN("{}", e.what());
+  }
+}
+
+void Parser::parse_deferred_notes() {
+  if (this->config_.parse_notes) {
+    return;
+  }
+  this->config_.parse_notes = true;
+  LIEF_DEBUG("Parsing the deferred notes");
+  try {
+    this->parse_notes();
+  } catch (const std::exception& e) {
+    LIEF_WARN("{}", e.what());
+  }
 }
 
 
@@ -184,12 +313,14 @@ void Parser::parse_symbol_version(uint64_t symbol_version_offset) {
 
   const uint32_t nb_entries = static_cast<uint32_t>(this->binary_->dynamic_symbols_.size());
 
+  this->binary_->symbol_versions_pool_->reserve(nb_entries);
   this->stream_->setpos(symbol_version_offset);
   for (size_t i = 0; i < nb_entries; ++i) {
     if (not this->stream_->can_read<uint16_t>()) {
       break;
     }
-    this->binary_->symbol_version_table_.push_back(new SymbolVersion{this->stream_->read_conv<uint16_t>()});
+    const uint16_t value = this->stream_->read_conv<uint16_t>();
+    this->binary_->symbol_version_table_.push_back(this->binary_->symbol_versions_pool_->create(value).release());
   }
 }
 
@@ -324,6 +455,18 @@ void Parser::parse_symbol_sysv_hash(uint64_t offset) {
 
 }
 
+void Parser::parse_notes() {
+  // The PT_NOTE segment and the SHT_NOTE sections (see: locate_tables())
+  for (const table_t& note : this->tables_.notes) {
+    try {
+      this->parse_notes(note.offset, note.size);
+    } catch (const conversion_error&) {
+    } catch (const exception& e) {
+      LIEF_WARN("{}", e.what());
+    }
+  }
+}
+
 void Parser::parse_notes(uint64_t offset, uint64_t size) {
   LIEF_DEBUG("== Parsing note segment ==");
 
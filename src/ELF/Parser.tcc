@@ -41,9 +41,21 @@
 
 
 #include "Object.tcc"
+#include "object_pool.hpp"
+#include "string_pool.hpp"
 
 namespace LIEF {
 namespace ELF {
+
+//! Bound `nb_entries` with the number of `T` that can be read from `offset`.
+//! It prevents the object pools from reserving memory for corrupted counts.
+template<class T>
+size_t nb_readable(const BinaryStream& stream, uint64_t offset, size_t nb_entries) {
+  if (offset >= stream.size()) {
+    return 0;
+  }
+  return std::min<size_t>(nb_entries, (stream.size() - offset) / sizeof(T));
+}
 template<typename ELF_T>
 void Parser::parse_binary() {
   using Elf_Off  = typename ELF_T::Elf_Off;
@@ -138,206 +150,109 @@ void Parser::parse_binary() {
     }
   }
 
-  // Parse dynamic relocations
-  // =========================
+  this->locate_tables<ELF_T>();
 
-  // RELA
-  // ----
-  auto&& it_dynamic_relocations = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_RELA;
-      });
-
-  auto&& it_dynamic_relocations_size = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_RELASZ;
-      });
-
-  if (it_dynamic_relocations != std::end(this->binary_->dynamic_entries_) and
-      it_dynamic_relocations_size != std::end(this->binary_->dynamic_entries_)) {
-    const uint64_t virtual_address = (*it_dynamic_relocations)->value();
-    const uint64_t size            = (*it_dynamic_relocations_size)->value();
-    try {
-      uint64_t offset = this->binary_->virtual_address_to_offset(virtual_address);
-      this->parse_dynamic_relocations<ELF_T, typename ELF_T::Elf_Rela>(offset, size);
-    } catch (const LIEF::exception& e) {
-      LIEF_WARN(e.what());
-    }
+  // Parse static symbols
+  // ====================
+  if (this->config_.parse_static_symbols) {
+    this->parse_static_symbols_table<ELF_T>();
   }
 
+  // Parse relocations
+  // =================
+  if (this->config_.parse_relocations) {
+    this->parse_relocations<ELF_T>();
+  }
 
-  // REL
-  // ---
-  it_dynamic_relocations = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_REL;
-      });
-
-  it_dynamic_relocations_size = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_RELSZ;
-      });
-
-  if (it_dynamic_relocations != std::end(this->binary_->dynamic_entries_) and
-      it_dynamic_relocations_size != std::end(this->binary_->dynamic_entries_)) {
-    const uint64_t virtual_address = (*it_dynamic_relocations)->value();
-    const uint64_t size            = (*it_dynamic_relocations_size)->value();
-    try {
-      const uint64_t offset = this->binary_->virtual_address_to_offset(virtual_address);
-      this->parse_dynamic_relocations<ELF_T, typename ELF_T::Elf_Rel>(offset, size);
-    } catch (const LIEF::exception& e) {
-      LIEF_WARN(e.what());
-    }
-
+  // Parse symbols version
+  // =====================
+  if (this->config_.parse_symbol_versions) {
+    this->parse_symbol_versions<ELF_T>();
   }
 
-  // Parse PLT/GOT Relocations
-  // ==========================
-  auto&& it_pltgot_relocations = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_JMPREL;
-      });
+  // Parse Symbols's hash
+  // ====================
 
-  auto&& it_pltgot_relocations_size = std::find_if(
+  auto&& it_symbol_hash = std::find_if(
       std::begin(this->binary_->dynamic_entries_),
       std::end(this->binary_->dynamic_entries_),
       [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_PLTRELSZ;
+        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_HASH;
       });
 
-  auto&& it_pltgot_relocations_type = std::find_if(
+  auto&& it_symbol_gnu_hash = std::find_if(
       std::begin(this->binary_->dynamic_entries_),
       std::end(this->binary_->dynamic_entries_),
       [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_PLTREL;
+        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_GNU_HASH;
       });
 
-  if (it_pltgot_relocations != std::end(this->binary_->dynamic_entries_) and
-      it_pltgot_relocations_size != std::end(this->binary_->dynamic_entries_)) {
-    const uint64_t virtual_address = (*it_pltgot_relocations)->value();
-    const uint64_t size            = (*it_pltgot_relocations_size)->value();
-    DYNAMIC_TAGS type;
-    if (it_pltgot_relocations_type != std::end(this->binary_->dynamic_entries_)) {
-      type = static_cast<DYNAMIC_TAGS>((*it_pltgot_relocations_type)->value());
-    } else {
-      // Try to guess: We assume that on ELF64 -> DT_RELA and on ELF32 -> DT_REL
-      if (std::is_same<ELF_T, ELF64>::value) {
-        type = DYNAMIC_TAGS::DT_RELA;
-      } else {
-        type = DYNAMIC_TAGS::DT_REL;
-      }
-    }
-
+  if (it_symbol_hash != std::end(this->binary_->dynamic_entries_)) {
     try {
-      const uint64_t offset = this->binary_->virtual_address_to_offset(virtual_address);
-      if (type == DYNAMIC_TAGS::DT_RELA) {
-        this->parse_pltgot_relocations<ELF_T, typename ELF_T::Elf_Rela>(offset, size);
-      } else {
-        this->parse_pltgot_relocations<ELF_T, typename ELF_T::Elf_Rel>(offset, size);
-      }
-    } catch (const LIEF::exception& e) {
-      LIEF_WARN(e.what());
-
+      const uint64_t symbol_sys_hash_offset = this->binary_->virtual_address_to_offset((*it_symbol_hash)->value());
+      this->parse_symbol_sysv_hash(symbol_sys_hash_offset);
+    } catch (const conversion_error&) {
+    } catch (const exception& e) {
+      LIEF_WARN("{}", e.what());
     }
-
-
   }
 
-  // Parse Symbol Version
-  // ====================
-  auto&& it_symbol_versions = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_VERSYM;
-      });
 
-  if (it_symbol_versions != std::end(this->binary_->dynamic_entries_)) {
-    const uint64_t virtual_address = (*it_symbol_versions)->value();
+  if (it_symbol_gnu_hash != std::end(this->binary_->dynamic_entries_)) {
     try {
-      uint64_t offset = this->binary_->virtual_address_to_offset(virtual_address);
-      this->parse_symbol_version(offset);
-    } catch (const LIEF::exception&) {
-
+      const uint64_t symbol_gnu_hash_offset = this->binary_->virtual_address_to_offset((*it_symbol_gnu_hash)->value());
+      this->parse_symbol_gnu_hash<ELF_T>(symbol_gnu_hash_offset);
+    } catch (const conversion_error&) {
+    } catch (const exception& e) {
+      LIEF_WARN("{}", e.what());
     }
-
   }
 
-  // Parse Symbol Version Requirement
-  // ================================
-  auto&& it_symbol_version_requirement = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_VERNEED;
-      });
+  // Parse notes
+  // ===========
+  if (this->config_.parse_notes) {
+    this->parse_notes();
+  }
 
-  auto&& it_symbol_version_requirement_size = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_VERNEEDNUM;
-      });
+  this->parse_overlay();
+}
 
-  if (it_symbol_version_requirement != std::end(this->binary_->dynamic_entries_) and
-      it_symbol_version_requirement_size != std::end(this->binary_->dynamic_entries_)) {
+template<typename ELF_T>
+void Parser::locate_tables() {
+  tables_t& tables = this->tables_;
 
-    const DynamicEntry* dt_verneed     = *it_symbol_version_requirement;
-    const DynamicEntry* dt_verneed_num = *it_symbol_version_requirement_size;
+  const auto find_entry = [this] (DYNAMIC_TAGS tag) -> const DynamicEntry* {
+    auto it = std::find_if(
+        std::begin(this->binary_->dynamic_entries_),
+        std::end(this->binary_->dynamic_entries_),
+        [tag] (const DynamicEntry* entry) {
+          return entry != nullptr and entry->tag() == tag;
+        });
+    return it != std::end(this->binary_->dynamic_entries_) ? *it : nullptr;
+  };
 
-    const uint64_t virtual_address = dt_verneed->value();
-    const uint32_t nb_entries = std::min(Parser::NB_MAX_SYMBOLS, static_cast<uint32_t>(dt_verneed_num->value()));
-    try {
-      const uint64_t offset = this->binary_->virtual_address_to_offset(virtual_address);
-      this->parse_symbol_version_requirement<ELF_T>(offset, nb_entries);
-    } catch (const LIEF::exception& e) {
-      LIEF_WARN("{}", e.what());
+  // Translate the (virtual address, size) of the given dynamic entries
+  const auto locate = [this, &find_entry] (DYNAMIC_TAGS tag_address, DYNAMIC_TAGS tag_size, bool warn) -> table_t {
+    table_t table = table_t();
+    const DynamicEntry* address = find_entry(tag_address);
+    const DynamicEntry* size    = find_entry(tag_size);
+    if (address == nullptr or size == nullptr) {
+      return table;
     }
-
-  }
-
-  // Parse Symbol Version Definition
-  // ===============================
-  auto&& it_symbol_version_definition = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_VERDEF;
-      });
-
-  auto&& it_symbol_version_definition_size = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_VERDEFNUM;
-      });
-
-  if (it_symbol_version_definition != std::end(this->binary_->dynamic_entries_) and
-      it_symbol_version_definition_size != std::end(this->binary_->dynamic_entries_)) {
-    const uint64_t virtual_address = (*it_symbol_version_definition)->value();
-    const uint32_t size            = static_cast<uint32_t>((*it_symbol_version_definition_size)->value());
     try {
-      const uint64_t offset = this->binary_->virtual_address_to_offset(virtual_address);
-      this->parse_symbol_version_definition<ELF_T>(offset, size);
-    } catch (const LIEF::exception&) {
-
+      table.offset  = this->binary_->virtual_address_to_offset(address->value());
+      table.size    = size->value();
+      table.present = true;
+    } catch (const LIEF::exception& e) {
+      if (warn) {
+        LIEF_WARN("{}", e.what());
+      }
     }
+    return table;
+  };
 
-  }
-
-
-  // Parse static symbols
-  // ====================
+  // Static symbols
+  // ==============
   auto&& it_symtab_section = std::find_if(
       std::begin(this->binary_->sections_),
       std::end(this->binary_->sections_),
@@ -348,7 +263,6 @@ void Parser::parse_binary() {
 
   if (it_symtab_section != std::end(this->binary_->sections_)) {
     const Section* section = *it_symtab_section;
-    uint32_t nb_entries = static_cast<uint32_t>((section->size() / sizeof(typename ELF_T::Elf_Sym)));
 
     if (section->link() == 0 or section->link() >= this->binary_->sections_.size()) {
       LIEF_WARN("section->link() is not valid !");
@@ -356,10 +270,10 @@ void Parser::parse_binary() {
       // We should have:
       // nb_entries == section->information())
       // but lots of compiler not respect this rule
-      this->parse_static_symbols<ELF_T>(
-          section->file_offset(),
-          nb_entries,
-          this->binary_->sections_[section->link()]);
+      tables.symtab.present  = true;
+      tables.symtab.offset   = section->file_offset();
+      tables.symtab.size     = section->size() / sizeof(typename ELF_T::Elf_Sym);
+      tables.strtab_offset   = this->binary_->sections_[section->link()]->file_offset();
     }
 
     it_symtab_section = std::find_if(
@@ -375,47 +289,59 @@ void Parser::parse_binary() {
     }
   }
 
+  // Relocations
+  // ===========
+  tables.rela   = locate(DYNAMIC_TAGS::DT_RELA,   DYNAMIC_TAGS::DT_RELASZ,   /* warn */ true);
+  tables.rel    = locate(DYNAMIC_TAGS::DT_REL,    DYNAMIC_TAGS::DT_RELSZ,    /* warn */ true);
+  tables.jmprel = locate(DYNAMIC_TAGS::DT_JMPREL, DYNAMIC_TAGS::DT_PLTRELSZ, /* warn */ true);
 
-  // Parse Symbols's hash
-  // ====================
-
-  auto&& it_symbol_hash = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_HASH;
-      });
-
-  auto&& it_symbol_gnu_hash = std::find_if(
-      std::begin(this->binary_->dynamic_entries_),
-      std::end(this->binary_->dynamic_entries_),
-      [] (const DynamicEntry* entry) {
-        return entry != nullptr and entry->tag() == DYNAMIC_TAGS::DT_GNU_HASH;
-      });
-
-  if (it_symbol_hash != std::end(this->binary_->dynamic_entries_)) {
-    try {
-      const uint64_t symbol_sys_hash_offset = this->binary_->virtual_address_to_offset((*it_symbol_hash)->value());
-      this->parse_symbol_sysv_hash(symbol_sys_hash_offset);
-    } catch (const conversion_error&) {
-    } catch (const exception& e) {
-      LIEF_WARN("{}", e.what());
-    }
+  if (const DynamicEntry* pltrel = find_entry(DYNAMIC_TAGS::DT_PLTREL)) {
+    tables.jmprel_is_rela = static_cast<DYNAMIC_TAGS>(pltrel->value()) == DYNAMIC_TAGS::DT_RELA;
+  } else {
+    // Try to guess: We assume that on ELF64 -> DT_RELA and on ELF32 -> DT_REL
+    tables.jmprel_is_rela = std::is_same<ELF_T, ELF64>::value;
   }
 
-
-  if (it_symbol_gnu_hash != std::end(this->binary_->dynamic_entries_)) {
+  for (const Section* section : this->binary_->sections_) {
+    if (section->type() != ELF_SECTION_TYPES::SHT_REL and
+        section->type() != ELF_SECTION_TYPES::SHT_RELA)
+    {
+      continue;
+    }
+    // A relocation section can reference two other sections: a symbol table,
+    // identified by the sh_info section header entry, and a section to modify,
+    // identified by the sh_link
+    // BUT: in practice sh_info and sh_link are inverted
+    Section* applies_to = nullptr;
+    if (section->information() > 0 and section->information() < this->binary_->sections_.size()) {
+      applies_to = this->binary_->sections_[section->information()];
+    }
+    relocation_section_t relocations;
+    relocations.name          = section->name();
+    relocations.table.present = true;
+    relocations.table.offset  = section->file_offset();
+    relocations.table.size    = section->size();
+    relocations.is_rela       = section->type() == ELF_SECTION_TYPES::SHT_RELA;
+    relocations.is_allocated  = section->has(ELF_SECTION_FLAGS::SHF_ALLOC);
+    relocations.applies_to    = applies_to;
+    tables.relocation_sections.push_back(std::move(relocations));
+  }
+
+  // Symbol versions
+  // ===============
+  if (const DynamicEntry* versym = find_entry(DYNAMIC_TAGS::DT_VERSYM)) {
     try {
-      const uint64_t symbol_gnu_hash_offset = this->binary_->virtual_address_to_offset((*it_symbol_gnu_hash)->value());
-      this->parse_symbol_gnu_hash<ELF_T>(symbol_gnu_hash_offset);
-    } catch (const conversion_error&) {
-    } catch (const exception& e) {
-      LIEF_WARN("{}", e.what());
+      tables.versym.offset  = this->binary_->virtual_address_to_offset(versym->value());
+      tables.versym.present = true;
+    } catch (const LIEF::exception&) {
     }
   }
 
-  // Parse Note segment
-  // ==================
+  tables.verneed = locate(DYNAMIC_TAGS::DT_VERNEED, DYNAMIC_TAGS::DT_VERNEEDNUM, /* warn */ true);
+  tables.verdef  = locate(DYNAMIC_TAGS::DT_VERDEF,  DYNAMIC_TAGS::DT_VERDEFNUM,  /* warn */ false);
+
+  // Notes
+  // =====
   auto&& it_segment_note = std::find_if(
       std::begin(this->binary_->segments_),
       std::end(this->binary_->segments_),
@@ -426,25 +352,73 @@ void Parser::parse_binary() {
   if (it_segment_note != std::end(this->binary_->segments_)) {
     try {
       const uint64_t note_offset = this->binary_->virtual_address_to_offset((*it_segment_note)->virtual_address());
-      this->parse_notes(note_offset, (*it_segment_note)->physical_size());
+      tables.notes.push_back(table_t{true, note_offset, (*it_segment_note)->physical_size()});
     } catch (const conversion_error&) {
     } catch (const exception& e) {
       LIEF_WARN("{}", e.what());
     }
   }
 
-  // Parse Note Sections
-  // ===================
-  for (const Section& section : this->binary_->sections()) {
-    if (section.type() != ELF_SECTION_TYPES::SHT_NOTE) {
-      continue;
+  for (const Section* section : this->binary_->sections_) {
+    if (section->type() == ELF_SECTION_TYPES::SHT_NOTE) {
+      tables.notes.push_back(table_t{true, section->offset(), section->size()});
+    }
+  }
+}
+
+template<typename ELF_T>
+void Parser::parse_static_symbols_table() {
+  const table_t& symtab = this->tables_.symtab;
+  if (symtab.present) {
+    this->parse_static_symbols<ELF_T>(
+        symtab.offset,
+        static_cast<uint32_t>(symtab.size),
+        this->tables_.strtab_offset);
+  }
+}
+
+template<typename ELF_T>
+void Parser::parse_relocations() {
+  // Parse dynamic relocations
+  // =========================
+
+  // RELA
+  // ----
+  const table_t& rela = this->tables_.rela;
+  if (rela.present) {
+    try {
+      this->parse_dynamic_relocations<ELF_T, typename ELF_T::Elf_Rela>(rela.offset, rela.size);
+    } catch (const LIEF::exception& e) {
+      LIEF_WARN(e.what());
     }
+  }
+
 
+  // REL
+  // ---
+  const table_t& rel = this->tables_.rel;
+  if (rel.present) {
     try {
-      this->parse_notes(section.offset(), section.size());
-    } catch (const conversion_error&) {
-    } catch (const exception& e) {
-      LIEF_WARN("{}", e.what());
+      this->parse_dynamic_relocations<ELF_T, typename ELF_T::Elf_Rel>(rel.offset, rel.size);
+    } catch (const LIEF::exception& e) {
+      LIEF_WARN(e.what());
+    }
+
+  }
+
+  // Parse PLT/GOT Relocations
+  // ==========================
+  const table_t& jmprel = this->tables_.jmprel;
+  if (jmprel.present) {
+    try {
+      if (this->tables_.jmprel_is_rela) {
+        this->parse_pltgot_relocations<ELF_T, typename ELF_T::Elf_Rela>(jmprel.offset, jmprel.size);
+      } else {
+        this->parse_pltgot_relocations<ELF_T, typename ELF_T::Elf_Rel>(jmprel.offset, jmprel.size);
+      }
+    } catch (const LIEF::exception& e) {
+      LIEF_WARN(e.what());
+
     }
 
 
@@ -455,28 +429,66 @@ void Parser::parse_binary() {
   // otherwise, only the non-allocated sections to avoid parsing dynamic
   // relocations (or plt relocations) twice.
   bool skip_allocated_sections = this->binary_->relocations_.size() > 0;
-  for (const Section& section : this->binary_->sections()) {
-    if(skip_allocated_sections && section.has(ELF_SECTION_FLAGS::SHF_ALLOC)){
+  for (const relocation_section_t& section : this->tables_.relocation_sections) {
+    if(skip_allocated_sections && section.is_allocated){
       continue;
     }
     try {
-      if (section.type() == ELF_SECTION_TYPES::SHT_REL) {
-        this->parse_section_relocations<ELF_T, typename ELF_T::Elf_Rel>(section);
-      }
-      else if (section.type() == ELF_SECTION_TYPES::SHT_RELA) {
-        this->parse_section_relocations<ELF_T, typename ELF_T::Elf_Rela>(section);
+      if (section.is_rela) {
+        this->parse_section_relocations<ELF_T, typename ELF_T::Elf_Rela>(
+            section.table.offset, section.table.size, section.applies_to);
+      } else {
+        this->parse_section_relocations<ELF_T, typename ELF_T::Elf_Rel>(
+            section.table.offset, section.table.size, section.applies_to);
       }
 
     } catch (const exception& e) {
-      LIEF_WARN("Unable to parse relocations from section '{}' ({})", section.name(), e.what());
+      LIEF_WARN("Unable to parse relocations from section '{}' ({})", section.name, e.what());
+    }
+  }
+}
+
+template<typename ELF_T>
+void Parser::parse_symbol_versions() {
+  // Parse Symbol Version
+  // ====================
+  if (this->tables_.versym.present) {
+    try {
+      this->parse_symbol_version(this->tables_.versym.offset);
+    } catch (const LIEF::exception&) {
+
+    }
+
+  }
+
+  // Parse Symbol Version Requirement
+  // ================================
+  const table_t& verneed = this->tables_.verneed;
+  if (verneed.present) {
+    const uint32_t nb_entries = std::min(Parser::NB_MAX_SYMBOLS, static_cast<uint32_t>(verneed.size));
+    try {
+      this->parse_symbol_version_requirement<ELF_T>(verneed.offset, nb_entries);
+    } catch (const LIEF::exception& e) {
+      LIEF_WARN("{}", e.what());
     }
+
+  }
+
+  // Parse Symbol Version Definition
+  // ===============================
+  const table_t& verdef = this->tables_.verdef;
+  if (verdef.present) {
+    try {
+      this->parse_symbol_version_definition<ELF_T>(verdef.offset, static_cast<uint32_t>(verdef.size));
+    } catch (const LIEF::exception&) {
+
+    }
+
   }
 
   this->link_symbol_version();
-  this->parse_overlay();
 }
 
-
 template<typename ELF_T>
 bool Parser::parse_header() {
   using Elf_Ehdr = typename ELF_T::Elf_Ehdr;
@@ -890,13 +902,11 @@ void Parser::parse_sections() {
       const Elf_Off size                = section->size();
       this->binary_->datahandler_->reserve(section->file_offset(), section->size());
 
+      // The data handler reads the content from the stream: it is not copied
+      // so that the unmodified ranges remain in the original file
       const uint8_t* content = this->stream_->peek_array<uint8_t>(offset_to_content, size, /* check */false);
-      if (content == nullptr) {
-        if (section->type() != ELF_SECTION_TYPES::SHT_NOBITS) {
-          LIEF_WARN("  Unable to get content of section #{:d}", i);
-        }
-      } else {
-        section->content({content, content + size});
+      if (content == nullptr and section->type() != ELF_SECTION_TYPES::SHT_NOBITS) {
+        LIEF_WARN("  Unable to get content of section #{:d}", i);
       }
     }
     this->binary_->sections_.push_back(section.release());
@@ -959,7 +969,6 @@ void Parser::parse_segments() {
       this->binary_->datahandler_->reserve(segment->file_offset(), segment->physical_size());
       const uint8_t* content = this->stream_->peek_array<uint8_t>(offset_to_content, size, /* check */false);
       if (content != nullptr) {
-        segment->content({content, content + size});
         if (segment->type() == SEGMENT_TYPES::PT_INTERP) {
           this->binary_->interpreter_ = this->stream_->peek_string_at(offset_to_content, segment->physical_size());
         }
@@ -998,13 +1007,14 @@ void Parser::parse_dynamic_relocations(uint64_t relocations_offset, uint64_t siz
 
   nb_entries = std::min<uint32_t>(nb_entries, Parser::NB_MAX_RELOCATIONS);
 
+  this->binary_->relocations_pool_->reserve(nb_readable<REL_T>(*this->stream_, relocations_offset, nb_entries));
   this->stream_->setpos(relocations_offset);
   for (uint32_t i = 0; i < nb_entries; ++i) {
     if (not this->stream_->can_read<REL_T>()) {
       break;
     }
     const REL_T raw_reloc = this->stream_->read_conv<REL_T>();
-    std::unique_ptr<Relocation> reloc{new Relocation{&raw_reloc}};
+    ObjectPool<Relocation>::ptr_t reloc = this->binary_->relocations_pool_->create(&raw_reloc);
     reloc->purpose(RELOCATION_PURPOSES::RELOC_PURPOSE_DYNAMIC);
     reloc->architecture_ = this->binary_->header().machine_type();
 
@@ -1023,11 +1033,12 @@ void Parser::parse_dynamic_relocations(uint64_t relocations_offset, uint64_t siz
 
 
 template<typename ELF_T>
-void Parser::parse_static_symbols(uint64_t offset, uint32_t nbSymbols, const Section* string_section) {
+void Parser::parse_static_symbols(uint64_t offset, uint32_t nbSymbols, uint64_t string_table_offset) {
 
   using Elf_Sym = typename ELF_T::Elf_Sym;
   LIEF_DEBUG("== Parsing static symbols ==");
 
+  this->binary_->symbols_pool_->reserve(nb_readable<Elf_Sym>(*this->stream_, offset, nbSymbols));
   this->stream_->setpos(offset);
   for (uint32_t i = 0; i < nbSymbols; ++i) {
     if (not this->stream_->can_read<Elf_Sym>()) {
@@ -1035,9 +1046,9 @@ void Parser::parse_static_symbols(uint64_t offset, uint32_t nbSymbols, const Sec
     }
     const Elf_Sym raw_sym = this->stream_->read_conv<Elf_Sym>();
 
-    std::unique_ptr<Symbol> symbol{new Symbol{&raw_sym}};
-    std::string symbol_name = this->stream_->peek_string_at(string_section->file_offset() + raw_sym.st_name);
-    symbol->name(symbol_name);
+    ObjectPool<Symbol>::ptr_t symbol = this->binary_->symbols_pool_->create(&raw_sym);
+    symbol->interned_name_ = this->binary_->names_pool_->intern(
+        this->stream_->peek_string_at(string_table_offset + raw_sym.st_name));
     this->binary_->static_symbols_.push_back(symbol.release());
   }
 } // build_static_symbols
@@ -1050,7 +1061,7 @@ void Parser::parse_dynamic_symbols(uint64_t offset) {
 
   LIEF_DEBUG("== Parsing dynamics symbols ==");
 
-  uint32_t nb_symbols = this->get_numberof_dynamic_symbols<ELF_T>(this->count_mtd_);
+  uint32_t nb_symbols = this->get_numberof_dynamic_symbols<ELF_T>(this->config_.count_mtd);
 
   const Elf_Off dynamic_symbols_offset = offset;
   const Elf_Off string_offset          = this->get_dynamic_string_table();
@@ -1064,6 +1075,7 @@ void Parser::parse_dynamic_symbols(uint64_t offset) {
     return;
   }
 
+  this->binary_->symbols_pool_->reserve(nb_readable<Elf_Sym>(*this->stream_, dynamic_symbols_offset, nb_symbols));
   this->stream_->setpos(dynamic_symbols_offset);
   for (size_t i = 0; i < nb_symbols; ++i) {
     if (not this->stream_->can_read<Elf_Sym>()) {
@@ -1072,7 +1084,7 @@ void Parser::parse_dynamic_symbols(uint64_t offset) {
     }
 
     const Elf_Sym symbol_header = this->stream_->read_conv<Elf_Sym>();
-    std::unique_ptr<Symbol> symbol{new Symbol{&symbol_header}};
+    ObjectPool<Symbol>::ptr_t symbol = this->binary_->symbols_pool_->create(&symbol_header);
 
     if (symbol_header.st_name > 0) {
       if (not this->stream_->can_read<char>(string_offset + symbol_header.st_name)) {
@@ -1086,7 +1098,7 @@ void Parser::parse_dynamic_symbols(uint64_t offset) {
         LIEF_DEBUG("Symbol's name #{:d} is empty!", i);
       }
 
-      symbol->name(name);
+      symbol->interned_name_ = this->binary_->names_pool_->intern(std::move(name));
     }
     this->binary_->dynamic_symbols_.push_back(symbol.release());
   }
@@ -1361,13 +1373,14 @@ void Parser::parse_pltgot_relocations(uint64_t offset, uint64_t size) {
 
   nb_entries = std::min<uint32_t>(nb_entries, Parser::NB_MAX_RELOCATIONS);
 
+  this->binary_->relocations_pool_->reserve(nb_readable<REL_T>(*this->stream_, offset_relocations, nb_entries));
   this->stream_->setpos(offset_relocations);
   for (uint32_t i = 0; i < nb_entries; ++i) {
     if (not this->stream_->can_read<REL_T>()) {
       break;
     }
     const REL_T rel_hdr = this->stream_->read_conv<REL_T>();
-    std::unique_ptr<Relocation> reloc{new Relocation{&rel_hdr}};
+    ObjectPool<Relocation>::ptr_t reloc = this->binary_->relocations_pool_->create(&rel_hdr);
     reloc->architecture_ = this->binary_->header_.machine_type();
     reloc->purpose(RELOCATION_PURPOSES::RELOC_PURPOSE_PLTGOT);
 
@@ -1404,38 +1417,22 @@ struct RelocationKey {
 };
 
 template<typename ELF_T, typename REL_T>
-void Parser::parse_section_relocations(Section const& section) {
+void Parser::parse_section_relocations(uint64_t offset, uint64_t size, Section* applies_to) {
   using Elf_Rel = typename ELF_T::Elf_Rel;
   using Elf_Rela = typename ELF_T::Elf_Rela;
 
   static_assert(std::is_same<REL_T, Elf_Rel>::value or
                 std::is_same<REL_T, Elf_Rela>::value, "REL_T must be Elf_Rel or Elf_Rela");
 
-  // A relocation section can reference two other sections: a symbol table,
-  // identified by the sh_info section header entry, and a section to modify,
-  // identified by the sh_link
-  // BUT: in practice sh_info and sh_link are inverted
-  Section* applies_to = nullptr;
-  if (section.information() > 0 and section.information() < this->binary_->sections_.size()) {
-    const size_t sh_info = section.information();
-    applies_to = this->binary_->sections_[sh_info];
-  }
-
-  // FIXME: Use it
-  // Section* section_associated = nullptr;
-  // if (section.link() > 0 and section.link() < this->binary_->sections_.size()) {
-  //   const size_t sh_link = section.link();
-  //   section_associated = this->binary_->sections_[sh_link];
-  // }
-
-  const uint64_t offset_relocations = section.file_offset();
+  const uint64_t offset_relocations = offset;
   const uint8_t shift = std::is_same<ELF_T, ELF32>::value ? 8 : 32;
 
-  uint32_t nb_entries = static_cast<uint32_t>(section.size() / sizeof(REL_T));
+  uint32_t nb_entries = static_cast<uint32_t>(size / sizeof(REL_T));
   nb_entries = std::min<uint32_t>(nb_entries, Parser::NB_MAX_RELOCATIONS);
 
   std::map<RelocationKey, Relocation*> map;
 
+  this->binary_->relocations_pool_->reserve(nb_readable<REL_T>(*this->stream_, offset_relocations, nb_entries));
   this->stream_->setpos(offset_relocations);
   for (uint32_t i = 0; i < nb_entries; ++i) {
     if (not this->stream_->can_read<REL_T>()) {
@@ -1443,7 +1440,7 @@ void Parser::parse_section_relocations(Section const& section) {
     }
     const REL_T rel_hdr = this->stream_->read_conv<REL_T>();
 
-    std::unique_ptr<Relocation> reloc{new Relocation{&rel_hdr}};
+    ObjectPool<Relocation>::ptr_t reloc = this->binary_->relocations_pool_->create(&rel_hdr);
     reloc->architecture_ = this->binary_->header_.machine_type();
     reloc->section_      = applies_to;
     if (this->binary_->header().file_type() == ELF::E_TYPE::ET_REL and
@@ -0,0 +1,35 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/ELF/ParserConfig.hpp"
+
+namespace LIEF {
+namespace ELF {
+
+ParserConfig ParserConfig::all() {
+  return ParserConfig{};
+}
+
+ParserConfig ParserConfig::quick() {
+  ParserConfig conf;
+  conf.parse_static_symbols  = false;
+  conf.parse_relocations     = false;
+  conf.parse_symbol_versions = false;
+  conf.parse_notes           = false;
+  return conf;
+}
+
+}
+}
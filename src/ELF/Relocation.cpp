@@ -23,6 +23,7 @@
 #include "LIEF/ELF/Symbol.hpp"
 
 #include "RelocationSizes.hpp"
+#include "index_tracker.hpp"
 #include "logging.hpp"
 
 namespace LIEF {
@@ -141,6 +142,12 @@ void Relocation::swap(Relocation& other) {
   std::swap(this->purpose_,      other.purpose_);
   std::swap(this->section_,      other.section_);
   std::swap(this->info_,         other.info_);
+  IndexTracker::changed(this->index_tracker_, IndexTracker::RELOCATIONS);
+  IndexTracker::changed(other.index_tracker_, IndexTracker::RELOCATIONS);
+}
+
+uint64_t Relocation::address() const {
+  return this->address_;
 }
 
 int64_t Relocation::addend() const {
@@ -293,6 +300,11 @@ size_t Relocation::size() const {
 }
 
 
+void Relocation::address(uint64_t address) {
+  this->address_ = address;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::RELOCATIONS);
+}
+
 void Relocation::addend(int64_t addend) {
   this->addend_ = addend;
 }
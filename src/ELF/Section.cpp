@@ -32,6 +32,8 @@
 #include "LIEF/ELF/Section.hpp"
 #include "LIEF/ELF/Segment.hpp"
 
+#include "index_tracker.hpp"
+
 namespace LIEF {
 namespace ELF {
 
@@ -167,6 +169,8 @@ void Section::swap(Section& other) {
   std::swap(this->segments_,       other.segments_);
   std::swap(this->datahandler_,    other.datahandler_);
   std::swap(this->content_c_,      other.content_c_);
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
+  IndexTracker::changed(other.index_tracker_, IndexTracker::SECTIONS);
 }
 
 uint32_t Section::name_idx() const {
@@ -231,9 +235,10 @@ void Section::size(uint64_t size) {
     DataHandler::Node& node = this->datahandler_->get(
         this->file_offset(), this->size(),
         DataHandler::Node::SECTION);
-    node.size(size);
+    this->datahandler_->resize(node, size);
   }
   this->size_ = size;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
 }
 
 
@@ -242,9 +247,19 @@ void Section::offset(uint64_t offset) {
     DataHandler::Node& node = this->datahandler_->get(
         this->file_offset(), this->size(),
         DataHandler::Node::SECTION);
-    node.offset(offset);
+    this->datahandler_->move(node, offset);
   }
   this->offset_ = offset;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
+}
+
+uint64_t Section::virtual_address() const {
+  return this->virtual_address_;
+}
+
+void Section::virtual_address(uint64_t virtual_address) {
+  this->virtual_address_ = virtual_address;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
 }
 
 std::vector<uint8_t> Section::content() const {
@@ -261,8 +276,29 @@ std::vector<uint8_t> Section::content() const {
   }
 
   DataHandler::Node& node = this->datahandler_->get(this->offset(), this->size(), DataHandler::Node::SECTION);
-  const std::vector<uint8_t>& binary_content = this->datahandler_->content();
-  return {binary_content.data() + node.offset(), binary_content.data() + node.offset() + node.size()};
+  return this->datahandler_->read(node.offset(), node.size());
+}
+
+Section::content_view_t Section::content_view(std::vector<uint8_t>& buffer) const {
+  if (this->size() == 0) {
+    return {};
+  }
+
+  if (this->datahandler_ == nullptr) {
+    return {this->content_c_.data(), this->content_c_.size()};
+  }
+
+  if (this->size() > Parser::MAX_SECTION_SIZE) {
+    return {};
+  }
+
+  DataHandler::Node& node = this->datahandler_->get(this->offset(), this->size(), DataHandler::Node::SECTION);
+  const uint8_t* data = this->datahandler_->view(node.offset(), node.size());
+  if (data != nullptr) {
+    return {data, static_cast<size_t>(node.size())};
+  }
+  buffer = this->datahandler_->read(node.offset(), node.size());
+  return {buffer.data(), buffer.size()};
 }
 
 uint32_t Section::link() const {
@@ -302,9 +338,6 @@ void Section::content(const std::vector<uint8_t>& content) {
       this->size(),
       DataHandler::Node::SECTION);
 
-  std::vector<uint8_t>& binary_content = this->datahandler_->content();
-  this->datahandler_->reserve(node.offset(), content.size());
-
   if (node.size() < content.size()) {
     LIEF_INFO("You inserted 0x{:x} bytes in the section '{}' which is 0x{:x} wide",
         content.size(), this->name(), node.size());
@@ -312,10 +345,7 @@ void Section::content(const std::vector<uint8_t>& content) {
 
   this->size(content.size());
 
-  std::copy(
-      std::begin(content),
-      std::end(content),
-      std::begin(binary_content) + node.offset());
+  this->datahandler_->write(node.offset(), content.data(), content.size());
 
 }
 
@@ -343,9 +373,6 @@ void Section::content(std::vector<uint8_t>&& content) {
       this->size(),
       DataHandler::Node::SECTION);
 
-  std::vector<uint8_t>& binary_content = this->datahandler_->content();
-  this->datahandler_->reserve(node.offset(), content.size());
-
   if (node.size() < content.size()) {
     LIEF_INFO("You inserted 0x{:x} bytes in the section '{}' which is 0x{:x} wide",
         content.size(), this->name(), node.size());
@@ -353,10 +380,7 @@ void Section::content(std::vector<uint8_t>&& content) {
 
   this->size(content.size());
 
-  std::move(
-      std::begin(content),
-      std::end(content),
-      std::begin(binary_content) + node.offset());
+  this->datahandler_->write(node.offset(), content.data(), content.size());
 }
 
 void Section::type(ELF_SECTION_TYPES type) {
@@ -419,13 +443,12 @@ Section& Section::clear(uint8_t value) {
     return *this;
   }
 
-  std::vector<uint8_t>& binary_content = this->datahandler_->content();
   DataHandler::Node& node = this->datahandler_->get(
       this->file_offset(),
       this->size(),
       DataHandler::Node::SECTION);
 
-  std::fill_n(std::begin(binary_content) + node.offset(), this->size(), value);
+  this->datahandler_->fill(node.offset(), this->size(), value);
   return *this;
 
 }
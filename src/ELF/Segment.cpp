@@ -20,6 +20,7 @@
 #include "logging.hpp"
 
 #include "LIEF/exception.hpp"
+#include "LIEF/utils.hpp"
 
 #include "LIEF/ELF/hash.hpp"
 
@@ -29,6 +30,8 @@
 #include "LIEF/ELF/DataHandler/Handler.hpp"
 #include "LIEF/ELF/Section.hpp"
 
+#include "index_tracker.hpp"
+
 
 namespace LIEF {
 namespace ELF {
@@ -105,6 +108,8 @@ void Segment::swap(Segment& other) {
   std::swap(this->sections_,         other.sections_);
   std::swap(this->datahandler_,      other.datahandler_);
   std::swap(this->content_c_,        other.content_c_);
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SEGMENTS);
+  IndexTracker::changed(other.index_tracker_, IndexTracker::SEGMENTS);
 }
 
 
@@ -182,8 +187,36 @@ std::vector<uint8_t> Segment::content() const {
       this->file_offset(),
       this->physical_size(),
       DataHandler::Node::SEGMENT);
-  const std::vector<uint8_t>& binary_content = this->datahandler_->content();
-  return {binary_content.data() + node.offset(), binary_content.data() + node.offset() + node.size()};
+  return this->datahandler_->read(node.offset(), node.size());
+}
+
+LIEF::Section::content_view_t Segment::content_view(std::vector<uint8_t>& buffer) const {
+  if (this->datahandler_ == nullptr) {
+    return {this->content_c_.data(), this->content_c_.size()};
+  }
+
+  DataHandler::Node& node = this->datahandler_->get(
+      this->file_offset(),
+      this->physical_size(),
+      DataHandler::Node::SEGMENT);
+  const uint8_t* data = this->datahandler_->view(node.offset(), node.size());
+  if (data != nullptr) {
+    return {data, static_cast<size_t>(node.size())};
+  }
+  buffer = this->datahandler_->read(node.offset(), node.size());
+  return {buffer.data(), buffer.size()};
+}
+
+double Segment::entropy() const {
+  std::vector<uint8_t> buffer;
+  const LIEF::Section::content_view_t content = this->content_view(buffer);
+  return LIEF::entropy(content.data, content.size);
+}
+
+std::vector<double> Segment::entropy_profile(size_t window, size_t stride) const {
+  std::vector<uint8_t> buffer;
+  const LIEF::Section::content_view_t content = this->content_view(buffer);
+  return LIEF::entropy_profile(content.data, content.size, window, stride);
 }
 
 size_t Segment::get_content_size() const {
@@ -204,8 +237,7 @@ template<typename T> T Segment::get_content_value(size_t offset) const {
         this->file_offset(),
         this->physical_size(),
         DataHandler::Node::SEGMENT);
-    const std::vector<uint8_t>& binary_content = this->datahandler_->content();
-    memcpy(&ret, binary_content.data() + node.offset() + offset, sizeof(T));
+    this->datahandler_->read(node.offset() + offset, sizeof(T), reinterpret_cast<uint8_t*>(&ret));
   }
   return ret;
 }
@@ -229,16 +261,14 @@ template<typename T> void Segment::set_content_value(size_t offset, T value) {
         this->file_offset(),
         this->physical_size(),
         DataHandler::Node::SEGMENT);
-    std::vector<uint8_t>& binary_content = this->datahandler_->content();
-
-    if (offset + sizeof(T) > binary_content.size()) {
+    if (offset + sizeof(T) > this->datahandler_->size()) {
       this->datahandler_->reserve(node.offset(), offset + sizeof(T));
 
       LIEF_INFO("You up to bytes in the segment {}@0x{:x} which is 0x{:x} wide",
-        offset + sizeof(T), to_string(this->type()), this->virtual_size(), binary_content.size());
+        offset + sizeof(T), to_string(this->type()), this->virtual_size(), this->datahandler_->size());
     }
     this->physical_size(node.size());
-    memcpy(binary_content.data() + node.offset() + offset, &value, sizeof(T));
+    this->datahandler_->write(node.offset() + offset, reinterpret_cast<const uint8_t*>(&value), sizeof(T));
   }
 }
 template void Segment::set_content_value<unsigned short>(size_t offset, unsigned short value);
@@ -308,14 +338,16 @@ void Segment::file_offset(uint64_t file_offset) {
     DataHandler::Node& node = this->datahandler_->get(
         this->file_offset(), this->physical_size(),
         DataHandler::Node::SEGMENT);
-    node.offset(file_offset);
+    this->datahandler_->move(node, file_offset);
   }
   this->file_offset_ = file_offset;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SEGMENTS);
 }
 
 
 void Segment::virtual_address(uint64_t virtualAddress) {
   this->virtual_address_ = virtualAddress;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SEGMENTS);
 }
 
 
@@ -329,14 +361,16 @@ void Segment::physical_size(uint64_t physicalSize) {
     DataHandler::Node& node = this->datahandler_->get(
         this->file_offset(), this->physical_size(),
         DataHandler::Node::SEGMENT);
-    node.size(physicalSize);
+    this->datahandler_->resize(node, physicalSize);
   }
   this->size_ = physicalSize;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SEGMENTS);
 }
 
 
 void Segment::virtual_size(uint64_t virtualSize) {
   this->virtual_size_ = virtualSize;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SEGMENTS);
 }
 
 
@@ -366,9 +400,6 @@ void Segment::content(const std::vector<uint8_t>& content) {
       this->physical_size(),
       DataHandler::Node::SEGMENT);
 
-  std::vector<uint8_t>& binary_content = this->datahandler_->content();
-  this->datahandler_->reserve(node.offset(), content.size());
-
   if (node.size() < content.size()) {
       LIEF_INFO("You inserted 0x{:x} bytes in the segment {}@0x{:x} which is 0x{:x} wide",
         content.size(), to_string(this->type()), this->virtual_size(), node.size());
@@ -376,10 +407,7 @@ void Segment::content(const std::vector<uint8_t>& content) {
 
   this->physical_size(node.size());
 
-  std::copy(
-      std::begin(content),
-      std::end(content),
-      std::begin(binary_content) + node.offset());
+  this->datahandler_->write(node.offset(), content.data(), content.size());
 }
 
 
@@ -401,9 +429,6 @@ void Segment::content(std::vector<uint8_t>&& content) {
       this->physical_size(),
       DataHandler::Node::SEGMENT);
 
-  std::vector<uint8_t>& binary_content = this->datahandler_->content();
-  this->datahandler_->reserve(node.offset(), content.size());
-
   if (node.size() < content.size()) {
       LIEF_INFO("You inserted 0x{:x} bytes in the segment {}@0x{:x} which is 0x{:x} wide",
         content.size(), to_string(this->type()), this->virtual_size(), node.size());
@@ -411,10 +436,7 @@ void Segment::content(std::vector<uint8_t>&& content) {
 
   this->physical_size(node.size());
 
-  std::move(
-      std::begin(content),
-      std::end(content),
-      std::begin(binary_content) + node.offset());
+  this->datahandler_->write(node.offset(), content.data(), content.size());
 }
 
 void Segment::accept(Visitor& visitor) const {
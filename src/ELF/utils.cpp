@@ -42,20 +42,14 @@ bool is_elf(const std::string& file) {
 }
 
 bool is_elf(const std::vector<uint8_t>& raw) {
+  return is_elf(raw.data(), raw.size());
+}
 
-  char magic[sizeof(ElfMagic)];
-
-  if (raw.size() < sizeof(ElfMagic)) {
+bool is_elf(const uint8_t* data, size_t size) {
+  if (data == nullptr or size < sizeof(ElfMagic)) {
     return false;
   }
-
-
-  std::copy(
-    reinterpret_cast<const uint8_t*>(raw.data()),
-    reinterpret_cast<const uint8_t*>(raw.data()) + sizeof(ElfMagic),
-    magic);
-
-  return std::equal(std::begin(magic), std::end(magic), std::begin(ElfMagic));
+  return std::equal(std::begin(ElfMagic), std::end(ElfMagic), reinterpret_cast<const char*>(data));
 }
 
 //! SYSV hash function
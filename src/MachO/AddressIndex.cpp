@@ -0,0 +1,90 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/MachO/Section.hpp"
+#include "LIEF/MachO/SegmentCommand.hpp"
+
+#include "AddressIndex.hpp"
+
+namespace LIEF {
+namespace MachO {
+
+AddressIndex::AddressIndex(IndexTracker& tracker, const sections_t& sections,
+                           const segments_t& segments) :
+  tracker_{tracker},
+  sections_{sections},
+  segments_{segments}
+{}
+
+const AddressIndex& AddressIndex::refresh(uint32_t kinds) {
+  if (this->nb_sections_.load(std::memory_order_relaxed) != this->sections_.size()) {
+    this->tracker_.changed(IndexTracker::SECTIONS);
+  }
+  if (this->nb_segments_.load(std::memory_order_relaxed) != this->segments_.size()) {
+    this->tracker_.changed(IndexTracker::SEGMENTS);
+  }
+  this->tracker_.refresh(kinds, [this] (uint32_t stale) {
+      if ((stale & IndexTracker::SECTIONS) != 0) {
+        this->update_sections();
+      }
+      if ((stale & IndexTracker::SEGMENTS) != 0) {
+        this->update_segments();
+      }
+    });
+  return *this;
+}
+
+void AddressIndex::update_sections() {
+  this->sections_by_offset_.clear();
+  this->sections_by_va_.clear();
+  for (size_t i = 0; i < this->sections_.size(); ++i) {
+    Section* section = this->sections_[i];
+    section->index_tracker_ = &this->tracker_;
+    this->sections_by_offset_.add(section->offset(), section->size(), i);
+    this->sections_by_va_.add(section->virtual_address(), section->size(), i);
+  }
+  this->sections_by_offset_.finalize();
+  this->sections_by_va_.finalize();
+  this->nb_sections_.store(this->sections_.size(), std::memory_order_relaxed);
+}
+
+void AddressIndex::update_segments() {
+  this->segments_by_va_.clear();
+  for (size_t i = 0; i < this->segments_.size(); ++i) {
+    SegmentCommand* segment = this->segments_[i];
+    segment->index_tracker_ = &this->tracker_;
+    this->segments_by_va_.add(segment->virtual_address(), segment->virtual_size(), i);
+  }
+  this->segments_by_va_.finalize();
+  this->nb_segments_.store(this->segments_.size(), std::memory_order_relaxed);
+}
+
+const Section* AddressIndex::section_from_offset(uint64_t offset) const {
+  const size_t idx = this->sections_by_offset_.find(offset);
+  return idx == RangesIndex::npos ? nullptr : this->sections_[idx];
+}
+
+const Section* AddressIndex::section_from_virtual_address(uint64_t address) const {
+  const size_t idx = this->sections_by_va_.find(address);
+  return idx == RangesIndex::npos ? nullptr : this->sections_[idx];
+}
+
+const SegmentCommand* AddressIndex::segment_from_virtual_address(uint64_t address) const {
+  const size_t idx = this->segments_by_va_.find(address);
+  return idx == RangesIndex::npos ? nullptr : this->segments_[idx];
+}
+
+}
+}
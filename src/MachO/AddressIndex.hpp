@@ -0,0 +1,67 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_MACHO_ADDRESS_INDEX_H_
+#define LIEF_MACHO_ADDRESS_INDEX_H_
+#include <atomic>
+
+#include "LIEF/MachO/type_traits.hpp"
+
+#include "ranges_index.hpp"
+#include "index_tracker.hpp"
+
+namespace LIEF {
+namespace MachO {
+class Section;
+class SegmentCommand;
+
+//! Sorted view of the sections and segments of a MachO::Binary used to
+//! resolve a virtual address (or an offset) in O(log n).
+//!
+//! As for the ELF format, the index lives as long as the Binary and its parts
+//! are updated when the IndexTracker of the Binary flags them as stale (i.e.
+//! when an address, an offset or a size is changed through the Section /
+//! SegmentCommand setters or when the Binary adds, removes or shifts them).
+class AddressIndex {
+  public:
+  AddressIndex(IndexTracker& tracker, const sections_t& sections, const segments_t& segments);
+
+  //! Update the parts of the index used by the given IndexTracker::KIND
+  //! if they are stale
+  const AddressIndex& refresh(uint32_t kinds);
+
+  const Section* section_from_offset(uint64_t offset) const;
+  const Section* section_from_virtual_address(uint64_t address) const;
+  const SegmentCommand* segment_from_virtual_address(uint64_t address) const;
+
+  private:
+  void update_sections();
+  void update_segments();
+
+  IndexTracker&     tracker_;
+  const sections_t& sections_;
+  const segments_t& segments_;
+
+  std::atomic<size_t> nb_sections_{0};
+  std::atomic<size_t> nb_segments_{0};
+
+  RangesIndex sections_by_offset_;
+  RangesIndex sections_by_va_;
+  RangesIndex segments_by_va_;
+};
+
+}
+}
+#endif
@@ -64,11 +64,18 @@
 
 #include "LIEF/exception.hpp"
 
+#include "symbols_index.hpp"
+#include "AddressIndex.hpp"
+
 
 namespace LIEF {
 namespace MachO {
 
-Binary::Binary() = default;
+Binary::Binary() :
+  index_tracker_{new IndexTracker{}},
+  symbols_index_{new SymbolsIndex<Symbol>{*this->index_tracker_, IndexTracker::SYMBOLS, this->symbols_}},
+  address_index_{new AddressIndex{*this->index_tracker_, this->sections_, this->segments_}}
+{}
 
 LIEF::sections_t Binary::get_abstract_sections() {
   LIEF::sections_t result;
@@ -387,23 +394,25 @@ bool Binary::has_symbol(const std::string& name) const {
 }
 
 const Symbol* Binary::get_symbol(const std::string& name) const {
-  const auto it_symbol = std::find_if(
-      std::begin(this->symbols_), std::end(this->symbols_),
-      [&name] (const Symbol* sym) {
-        return sym->name() == name;
-      });
-
-  if (it_symbol == std::end(this->symbols_)) {
-    return nullptr;
-  }
-
-  return *it_symbol;
+  return this->symbols_index().find(name);
 }
 
 Symbol* Binary::get_symbol(const std::string& name) {
   return const_cast<Symbol*>(static_cast<const Binary*>(this)->get_symbol(name));
 }
 
+SymbolsIndex<Symbol>& Binary::symbols_index() const {
+  return *this->symbols_index_;
+}
+
+const AddressIndex& Binary::address_index(uint32_t kinds) const {
+  return this->address_index_->refresh(kinds);
+}
+
+void Binary::invalidate_address_index() {
+  this->index_tracker_->changed(IndexTracker::SECTIONS | IndexTracker::SEGMENTS);
+}
+
 // =====
 
 
@@ -413,19 +422,7 @@ void Binary::write(const std::string& filename) {
 
 
 const Section* Binary::section_from_offset(uint64_t offset) const {
-  it_const_sections sections = this->sections();
-  const auto it_section = std::find_if(
-      sections.cbegin(), sections.cend(),
-      [offset] (const Section& section) {
-        return ((section.offset() <= offset) and
-            offset < (section.offset() + section.size()));
-      });
-
-  if (it_section == sections.cend()) {
-    return nullptr;
-  }
-
-  return &(*it_section);
+  return this->address_index(IndexTracker::SECTIONS).section_from_offset(offset);
 }
 
 Section* Binary::section_from_offset(uint64_t offset) {
@@ -434,19 +431,7 @@ Section* Binary::section_from_offset(uint64_t offset) {
 
 
 const Section* Binary::section_from_virtual_address(uint64_t address) const {
-  it_const_sections sections = this->sections();
-  const auto it_section = std::find_if(
-      std::begin(sections), std::end(sections),
-      [address] (const Section& section) {
-        return ((section.virtual_address() <= address) and
-            address < (section.virtual_address() + section.size()));
-      });
-
-  if (it_section == std::end(sections)) {
-    return nullptr;
-  }
-
-  return &(*it_section);
+  return this->address_index(IndexTracker::SECTIONS).section_from_virtual_address(address);
 }
 
 Section* Binary::section_from_virtual_address(uint64_t address) {
@@ -454,19 +439,7 @@ Section* Binary::section_from_virtual_address(uint64_t address) {
 }
 
 const SegmentCommand* Binary::segment_from_virtual_address(uint64_t virtual_address) const {
-  it_const_segments segments = this->segments();
-  auto it_segment = std::find_if(
-      std::begin(segments), std::end(segments),
-      [virtual_address] (const SegmentCommand& segment) {
-        return ((segment.virtual_address() <= virtual_address) and
-            virtual_address < (segment.virtual_address() + segment.virtual_size()));
-      });
-
-  if (it_segment == std::end(segments)) {
-    return nullptr;
-  }
-
-  return &(*it_segment);
+  return this->address_index(IndexTracker::SEGMENTS).segment_from_virtual_address(virtual_address);
 }
 
 size_t Binary::segment_index(const SegmentCommand& segment) const {
@@ -745,7 +718,7 @@ void Binary::shift(size_t value) {
 
     this->offset_seg_[segment.file_offset()] = &segment;
   }
-
+  this->invalidate_address_index();
 }
 
 
@@ -895,6 +868,7 @@ bool Binary::remove(const LoadCommand& command) {
         (*it)->index_--;
       }
       this->segments_.erase(it_cache);
+      this->invalidate_address_index();
     }
     auto it_offset = this->offset_seg_.find(seg->file_offset());
     if (it_offset != std::end(this->offset_seg_)) {
@@ -1049,6 +1023,7 @@ bool Binary::extend_segment(const SegmentCommand& segment, size_t size) {
   target_segment.virtual_size(target_segment.virtual_size() + size_aligned);
   target_segment.file_size(target_segment.file_size() + size_aligned);
   target_segment.data_.resize(target_segment.file_size());
+  this->invalidate_address_index();
   return true;
 }
 
@@ -1102,6 +1077,7 @@ void Binary::remove_section(const std::string& name, bool clear) {
 
   delete section;
   segment.sections_.erase(it_section);
+  this->invalidate_address_index();
 }
 
 Section* Binary::add_section(const Section& section) {
@@ -1173,6 +1149,7 @@ Section* Binary::add_section(const SegmentCommand& segment, const Section& secti
 
   // Copy the new section in the cache
   this->sections_.push_back(new_section);
+  this->invalidate_address_index();
 
   // Copy data to segment
   const size_t relative_offset = new_section->offset() - target_segment.file_offset();
@@ -1282,6 +1259,7 @@ size_t Binary::add_cached_segment(SegmentCommand& segment) {
   }
   this->segments_.insert(it_linkedit, &segment);
   this->offset_seg_[segment.file_offset()] = &segment;
+  this->invalidate_address_index();
   return segment.index();
 }
 
@@ -1320,19 +1298,13 @@ bool Binary::unexport(const Symbol& sym) {
 bool Binary::remove(const Symbol& sym) {
   /* bool export_removed = */ this->unexport(sym);
 
-  const auto it_symbol = std::find_if(
-      std::begin(this->symbols_), std::end(this->symbols_),
-      [&sym] (const Symbol* s) {
-        return s->name() == sym.name();
-      });
+  Symbol* symbol_to_remove = this->symbols_index().find(sym.name());
 
   // No Symbol
-  if (it_symbol == std::end(this->symbols_)) {
+  if (symbol_to_remove == nullptr) {
     return false;
   }
 
-  Symbol* symbol_to_remove = *it_symbol;
-
 
   // Remove from the symbol command
   // ------------------------------
@@ -1427,8 +1399,10 @@ bool Binary::remove(const Symbol& sym) {
 
   // Remove from symbol table
   // ------------------------
-  delete symbol_to_remove;
+  const auto it_symbol = std::find(std::begin(this->symbols_), std::end(this->symbols_), symbol_to_remove);
   this->symbols_.erase(it_symbol);
+  this->symbols_index_->remove(*symbol_to_remove, this->symbols_);
+  delete symbol_to_remove;
   symbol_to_remove = nullptr;
   return true;
 }
@@ -22,6 +22,7 @@
 #include "BinaryParser.tcc"
 
 #include "LIEF/BinaryStream/VectorStream.hpp"
+#include "LIEF/BinaryStream/MmapStream.hpp"
 #include "LIEF/exception.hpp"
 
 #include "LIEF/MachO/BinaryParser.hpp"
@@ -79,7 +80,7 @@ BinaryParser::BinaryParser(const std::string& file, const ParserConfig& conf) :
     throw bad_file("'" + file + "' is a FAT MachO, this parser takes fit binary");
   }
 
-  this->stream_ = std::unique_ptr<VectorStream>(new VectorStream{file});
+  this->stream_ = std::unique_ptr<MmapStream>(new MmapStream{file});
 
   this->binary_ = new Binary{};
   this->binary_->name_ = filesystem::path(file).filename();
@@ -49,6 +49,7 @@
 #include "LIEF/MachO/FilesetCommand.hpp"
 
 #include "Object.tcc"
+#include "index_tracker.hpp"
 
 
 namespace LIEF {
@@ -73,6 +74,10 @@ void BinaryParser::parse() {
     this->parse_load_commands<MACHO_T>();
   }
 
+  // The sections and the segments are now known: build the address index
+  // once so that do_rebase() resolves its sections in O(log n)
+  this->binary_->address_index(IndexTracker::SECTIONS | IndexTracker::SEGMENTS);
+
   for (Section& section : this->binary_->sections()) {
     try {
       this->parse_relocations<MACHO_T>(section);
@@ -388,8 +393,7 @@ void BinaryParser::parse_load_commands() {
             std::unique_ptr<Symbol> symbol{new Symbol{&nlist[j]}};
             uint32_t idx = nlist[j].n_strx;
             if (idx > 0) {
-              symbol->name(
-                  this->stream_->peek_string_at(cmd->stroff + idx));
+              symbol->name_ = this->stream_->peek_string_at(cmd->stroff + idx);
             }
             Symbol* symbol_ptr = symbol.release();
             this->binary_->symbols_.push_back(symbol_ptr);
@@ -339,17 +339,17 @@ void Builder::write(const std::string& filename) const {
 
   std::ofstream output_file{filename, std::ios::out | std::ios::binary | std::ios::trunc};
   if (output_file) {
-    std::vector<uint8_t> content;
-    this->raw_.get(content);
-
-    std::copy(
-        std::begin(content), std::end(content),
-        std::ostreambuf_iterator<char>(output_file));
+    this->write(output_file);
   } else {
     LIEF_ERR("Fail to write binary file");
   }
 
 }
 
+void Builder::write(std::ostream& os) const {
+  const std::vector<uint8_t>& content = this->raw_.raw();
+  os.write(reinterpret_cast<const char*>(content.data()), content.size());
+}
+
 }
 }
@@ -20,11 +20,15 @@
 #include <regex>
 #include <stdexcept>
 #include <functional>
+#include <future>
+#include <exception>
 
 #include "logging.hpp"
 
 #include "LIEF/exception.hpp"
 #include "LIEF/BinaryStream/VectorStream.hpp"
+#include "LIEF/BinaryStream/MmapStream.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
 
 #include "LIEF/MachO/Structures.hpp"
 #include "LIEF/MachO/FatBinary.hpp"
@@ -44,7 +48,7 @@ Parser::~Parser() = default;
 // From File
 Parser::Parser(const std::string& file, const ParserConfig& conf) :
   LIEF::Parser{file},
-  stream_{std::unique_ptr<VectorStream>(new VectorStream{file})},
+  stream_{std::unique_ptr<MmapStream>(new MmapStream{file})},
   binaries_{},
   config_{conf}
 {
@@ -102,6 +106,10 @@ void Parser::build_fat() {
 
   const fat_arch* arch = &this->stream_->peek<fat_arch>(sizeof(fat_header));
 
+  // The slices are views on this->stream_ which outlives the parsing
+  std::vector<std::pair<uint32_t, std::unique_ptr<BinaryStream>>> slices;
+  slices.reserve(nb_arch);
+
   for (size_t i = 0; i < nb_arch; ++i) {
 
     const uint32_t offset = BinaryStream::swap_endian(arch[i].offset);
@@ -118,10 +126,48 @@ void Parser::build_fat() {
       continue;
     }
 
-    std::vector<uint8_t> data = {raw, raw + size};
+    slices.emplace_back(offset, std::unique_ptr<BinaryStream>(new SpanStream{raw, size}));
+  }
+
+  if (not this->config_.parallel_fat or slices.size() < 2) {
+    for (auto& slice : slices) {
+      Binary *binary = BinaryParser{std::move(slice.second), slice.first, this->config_}.get_binary();
+      this->binaries_.push_back(binary);
+    }
+    return;
+  }
+
+  std::vector<std::future<Binary*>> jobs;
+  jobs.reserve(slices.size());
+  for (auto& slice : slices) {
+    const uint32_t offset = slice.first;
+    // The stream is moved into the task's arguments (no init-capture in C++11)
+    jobs.push_back(std::async(std::launch::async,
+      [this, offset] (std::unique_ptr<BinaryStream> stream) {
+        return BinaryParser{std::move(stream), offset, this->config_}.get_binary();
+      }, std::move(slice.second)));
+  }
+
+  // Mirror the sequential behavior: the binaries that follow
+  // a slice that failed to parse are discarded
+  std::exception_ptr error;
+  for (std::future<Binary*>& job : jobs) {
+    try {
+      Binary* binary = job.get();
+      if (error) {
+        delete binary;
+      } else {
+        this->binaries_.push_back(binary);
+      }
+    } catch (...) {
+      if (not error) {
+        error = std::current_exception();
+      }
+    }
+  }
 
-    Binary *binary = BinaryParser{std::move(data), offset, this->config_}.get_binary();
-    this->binaries_.push_back(binary);
+  if (error) {
+    std::rethrow_exception(error);
   }
 }
 
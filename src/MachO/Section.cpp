@@ -27,6 +27,8 @@
 #include "LIEF/MachO/SegmentCommand.hpp"
 #include "LIEF/MachO/EnumToString.hpp"
 
+#include "index_tracker.hpp"
+
 namespace LIEF {
 namespace MachO {
 
@@ -140,7 +142,8 @@ void Section::swap(Section& other) {
   std::swap(this->content_,             other.content_);
   std::swap(this->segment_,             other.segment_);
   std::swap(this->relocations_,         other.relocations_);
-
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
+  IndexTracker::changed(other.index_tracker_, IndexTracker::SECTIONS);
 }
 
 
@@ -177,6 +180,23 @@ Section::content_t Section::content() const {
   return section_content;
 }
 
+Section::content_view_t Section::content_view(std::vector<uint8_t>&) const {
+  if (this->segment_ == nullptr) {
+    return {this->content_.data(), this->content_.size()};
+  }
+
+  if (this->size_ == 0 or this->offset_ == 0) { // bss section for instance
+    return {};
+  }
+
+  uint64_t relative_offset = this->offset_ - this->segment_->file_offset();
+  const std::vector<uint8_t>& content = this->segment_->content();
+  if ((relative_offset + this->size_) > content.size()) {
+    throw LIEF::corrupted("Section's size is bigger than segment's size");
+  }
+  return {content.data() + relative_offset, static_cast<size_t>(this->size_)};
+}
+
 void Section::content(const Section::content_t& data) {
   if (this->segment_ == nullptr) {
     this->content_ = data;
@@ -202,6 +222,33 @@ void Section::content(const Section::content_t& data) {
   this->segment_->content(content);
 }
 
+uint64_t Section::size() const {
+  return this->size_;
+}
+
+void Section::size(uint64_t size) {
+  this->size_ = size;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
+}
+
+uint64_t Section::offset() const {
+  return this->offset_;
+}
+
+void Section::offset(uint64_t offset) {
+  this->offset_ = offset;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
+}
+
+uint64_t Section::virtual_address() const {
+  return this->virtual_address_;
+}
+
+void Section::virtual_address(uint64_t virtual_address) {
+  this->virtual_address_ = virtual_address;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
+}
+
 const std::string& Section::segment_name() const {
   if (this->segment_ != nullptr) {
     return this->segment_->name();
@@ -16,6 +16,7 @@
 #include <iomanip>
 #include <memory>
 
+#include "LIEF/utils.hpp"
 #include "LIEF/MachO/hash.hpp"
 
 #include "LIEF/MachO/Structures.hpp"
@@ -23,6 +24,8 @@
 #include "LIEF/MachO/Relocation.hpp"
 #include "LIEF/MachO/SegmentCommand.hpp"
 
+#include "index_tracker.hpp"
+
 namespace LIEF {
 namespace MachO {
 
@@ -121,6 +124,8 @@ void SegmentCommand::swap(SegmentCommand& other) {
   std::swap(this->data_,           other.data_);
   std::swap(this->sections_,       other.sections_);
   std::swap(this->relocations_,    other.relocations_);
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SEGMENTS);
+  IndexTracker::changed(other.index_tracker_, IndexTracker::SEGMENTS);
 }
 
 SegmentCommand* SegmentCommand::clone() const {
@@ -200,16 +205,26 @@ const SegmentCommand::content_t& SegmentCommand::content() const {
   return this->data_;
 }
 
+double SegmentCommand::entropy() const {
+  return LIEF::entropy(this->data_);
+}
+
+std::vector<double> SegmentCommand::entropy_profile(size_t window, size_t stride) const {
+  return LIEF::entropy_profile(this->data_, window, stride);
+}
+
 void SegmentCommand::name(const std::string& name) {
   this->name_ = name;
 }
 
 void SegmentCommand::virtual_address(uint64_t virtualAddress) {
   this->virtualAddress_ = virtualAddress;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SEGMENTS);
 }
 
 void SegmentCommand::virtual_size(uint64_t virtualSize) {
   this->virtualSize_ = virtualSize;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SEGMENTS);
 }
 
 void SegmentCommand::file_size(uint64_t fileSize) {
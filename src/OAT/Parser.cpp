@@ -71,7 +71,7 @@ Parser::Parser(const std::vector<uint8_t>& data, const std::string& name) :
   oat_binary_{new Binary{}},
   stream_{nullptr}
 {
-  LIEF::ELF::Parser{data, name, LIEF::ELF::DYNSYM_COUNT_METHODS::COUNT_AUTO, this->oat_binary_};
+  LIEF::ELF::Parser{data, name, LIEF::ELF::ParserConfig::all(), this->oat_binary_};
 }
 
 Parser::Parser(const std::string& file) :
@@ -79,7 +79,7 @@ Parser::Parser(const std::string& file) :
   oat_binary_{new Binary{}},
   stream_{nullptr}
 {
-  LIEF::ELF::Parser{file, LIEF::ELF::DYNSYM_COUNT_METHODS::COUNT_AUTO, this->oat_binary_};
+  LIEF::ELF::Parser{file, LIEF::ELF::ParserConfig::all(), this->oat_binary_};
 }
 
 
@@ -48,6 +48,8 @@
 #include "LIEF/PE/Symbol.hpp"
 #include "LIEF/PE/LoadConfigurations/LoadConfiguration.hpp"
 
+#include "SectionsIndex.hpp"
+
 namespace LIEF {
 namespace PE {
 
@@ -119,7 +121,9 @@ Binary::Binary() :
   debug_{},
   overlay_{},
   dos_stub_{},
-  load_configuration_{nullptr}
+  load_configuration_{nullptr},
+  index_tracker_{new IndexTracker{}},
+  sections_index_{new SectionsIndex{*this->index_tracker_, this->sections_}}
 {
 }
 
@@ -240,21 +244,14 @@ uint64_t Binary::imagebase() const {
 }
 
 uint64_t Binary::offset_to_virtual_address(uint64_t offset, uint64_t slide) const {
-  const auto it_section = std::find_if(
-      std::begin(this->sections_), std::end(this->sections_),
-      [offset] (const Section* section)
-      {
-        return (offset >= section->offset() and
-            offset < (section->offset() + section->sizeof_raw_data()));
-      });
+  const Section* section = this->sections_index().section_from_offset(offset);
 
-  if (it_section == std::end(sections_)) {
+  if (section == nullptr) {
     if (slide > 0) {
       return slide + offset;
     }
     return offset;
   }
-  const Section* section = *it_section;
   const uint64_t base_rva = section->virtual_address() - section->offset();
   if (slide > 0) {
     return slide + base_rva + offset;
@@ -264,20 +261,13 @@ uint64_t Binary::offset_to_virtual_address(uint64_t offset, uint64_t slide) cons
 }
 
 uint64_t Binary::rva_to_offset(uint64_t RVA) {
-  const auto it_section = std::find_if(
-      std::begin(this->sections_), std::end(this->sections_),
-      [RVA] (const Section* section) {
-        const uint64_t vsize_adj = std::max<uint64_t>(section->virtual_size(), section->sizeof_raw_data());
-        return (RVA >= section->virtual_address() and
-                RVA < (section->virtual_address() + vsize_adj));
-      });
+  const Section* section = this->sections_index().section_from_rva_adjusted(RVA);
 
-  if (it_section == std::end(sections_)) {
+  if (section == nullptr) {
     // If not found within a section,
     // we assume that rva == offset
     return RVA;
   }
-  const Section* section = *it_section;
 
   // rva - virtual_address + pointer_to_raw_data
   uint32_t section_alignment = this->optional_header().section_alignment();
@@ -295,23 +285,11 @@ uint64_t Binary::rva_to_offset(uint64_t RVA) {
 }
 
 const Section& Binary::section_from_offset(uint64_t offset) const {
-  auto&& it_section = std::find_if(
-      std::begin(this->sections_),
-      std::end(this->sections_),
-      [&offset] (const Section* section) {
-        if (section == nullptr) {
-          return false;
-        }
-        return (
-            offset >= section->pointerto_raw_data() and
-            offset < (section->pointerto_raw_data() + section->sizeof_raw_data()));
-      });
-
-  if (it_section == std::end(this->sections_)) {
+  const Section* section = this->sections_index().section_from_offset(offset);
+  if (section == nullptr) {
     throw LIEF::not_found("Section not found");
   }
-
-  return **it_section;
+  return *section;
 }
 
 Section& Binary::section_from_offset(uint64_t offset) {
@@ -320,24 +298,11 @@ Section& Binary::section_from_offset(uint64_t offset) {
 
 
 const Section& Binary::section_from_rva(uint64_t virtual_address) const {
-  auto&& it_section = std::find_if(
-      std::begin(this->sections_),
-      std::end(this->sections_),
-      [&virtual_address] (const Section* section) {
-        if (section == nullptr) {
-          return false;
-        }
-        return (
-            virtual_address >= section->virtual_address() and
-            virtual_address < (section->virtual_address() + section->virtual_size()));
-      });
-
-  if (it_section == std::end(this->sections_)) {
+  const Section* section = this->sections_index().section_from_rva(virtual_address);
+  if (section == nullptr) {
     throw LIEF::not_found("Section not found");
   }
-
-
-  return **it_section;
+  return *section;
 }
 
 Section& Binary::section_from_rva(uint64_t virtual_address) {
@@ -622,6 +587,7 @@ void Binary::remove(const Section& section, bool clear) {
 
   delete to_remove;
   this->sections_.erase(it_section);
+  this->invalidate_sections_index();
 
   this->header().numberof_sections(this->header().numberof_sections() - 1);
 
@@ -640,6 +606,7 @@ void Binary::make_space_for_new_section() {
     section->pointerto_raw_data(section->pointerto_raw_data() + shift);
   }
   this->available_sections_space_++;
+  this->invalidate_sections_index();
 }
 
 Section& Binary::add_section(const Section& section, PE_SECTION_TYPES type) {
@@ -768,6 +735,7 @@ Section& Binary::add_section(const Section& section, PE_SECTION_TYPES type) {
 
   this->available_sections_space_--;
   this->sections_.push_back(new_section);
+  this->invalidate_sections_index();
 
   // Update headers
   this->header().numberof_sections(static_cast<uint16_t>(this->sections_.size()));
@@ -1060,6 +1028,11 @@ it_const_signatures Binary::signatures() const {
 }
 
 std::vector<uint8_t> Binary::authentihash(ALGORITHMS algo) const {
+  std::vector<std::vector<uint8_t>> hashes = this->authentihash(std::vector<ALGORITHMS>{algo});
+  return std::move(hashes.front());
+}
+
+std::vector<std::vector<uint8_t>> Binary::authentihash(const std::vector<ALGORITHMS>& algos) const {
   static const std::map<ALGORITHMS, hashstream::HASH> HMAP = {
     {ALGORITHMS::MD5,     hashstream::HASH::MD5},
     {ALGORITHMS::SHA_1,   hashstream::HASH::SHA1},
@@ -1067,16 +1040,24 @@ std::vector<uint8_t> Binary::authentihash(ALGORITHMS algo) const {
     {ALGORITHMS::SHA_384, hashstream::HASH::SHA384},
     {ALGORITHMS::SHA_512, hashstream::HASH::SHA512},
   };
-  auto it_hash = HMAP.find(algo);
-  if (it_hash == std::end(HMAP)) {
-    LIEF_WARN("Unsupported hash algorithm: {}", to_string(algo));
-    return {};
+  std::vector<std::unique_ptr<hashstream>> streams;
+  streams.reserve(algos.size());
+  for (ALGORITHMS algo : algos) {
+    auto it_hash = HMAP.find(algo);
+    if (it_hash == std::end(HMAP)) {
+      LIEF_WARN("Unsupported hash algorithm: {}", to_string(algo));
+      streams.emplace_back(nullptr);
+      continue;
+    }
+    streams.emplace_back(new hashstream{it_hash->second});
   }
+
   const size_t sizeof_ptr = this->type_ == PE_TYPE::PE32 ? sizeof(uint32_t) : sizeof(uint64_t);
-  const hashstream::HASH hash_type = it_hash->second;
-  hashstream ios(hash_type);
-  //vector_iostream ios;
-  ios // Hash dos header
+
+  // The headers are serialized once for all the digests. The other parts
+  // of the image (DOS stub, sections, overlay) are hashed from the binary's memory.
+  vector_iostream dos_header;
+  dos_header
     .write(this->dos_header_.magic())
     .write(this->dos_header_.used_bytes_in_the_last_page())
     .write(this->dos_header_.file_size_in_pages())
@@ -1095,9 +1076,12 @@ std::vector<uint8_t> Binary::authentihash(ALGORITHMS algo) const {
     .write(this->dos_header_.oem_id())
     .write(this->dos_header_.oem_info())
     .write(this->dos_header_.reserved2())
-    .write(this->dos_header_.addressof_new_exeheader())
-    .write(this->dos_stub_);
+    .write(this->dos_header_.addressof_new_exeheader());
 
+  vector_iostream ios;
+  ios.reserve(sizeof(pe_header) + sizeof(pe64_optional_header) +
+              this->data_directories_.size() * sizeof(pe_data_directory) +
+              this->sections_.size() * sizeof(pe_section));
   ios // Hash PE Header
     .write(this->header_.signature())
     .write(static_cast<uint16_t>(this->header_.machine()))
@@ -1170,8 +1154,15 @@ std::vector<uint8_t> Binary::authentihash(ALGORITHMS algo) const {
       .write(sec->numberof_line_numbers())
       .write(static_cast<uint32_t>(sec->characteristics()));
   }
-  //LIEF_DEBUG("Section padding at 0x{:x}", ios.tellp());
-  ios.write(this->section_offset_padding_);
+
+  // (pointer, size) of the parts of the image in the order of the hash
+  using span_t = std::pair<const uint8_t*, size_t>;
+  std::vector<span_t> spans;
+  spans.reserve(this->sections_.size() * 2 + 6);
+  spans.emplace_back(dos_header.raw().data(), dos_header.raw().size());
+  spans.emplace_back(this->dos_stub_.data(), this->dos_stub_.size());
+  spans.emplace_back(ios.raw().data(), ios.raw().size());
+  spans.emplace_back(this->section_offset_padding_.data(), this->section_offset_padding_.size());
 
   std::vector<Section*> sections = this->sections_;
 
@@ -1182,34 +1173,32 @@ std::vector<uint8_t> Binary::authentihash(ALGORITHMS algo) const {
         return  lhs->pointerto_raw_data() < rhs->pointerto_raw_data();
     });
 
+  std::vector<uint8_t> unused;
   uint64_t position = 0;
   for (const Section* sec : sections) {
     if (sec->sizeof_raw_data() == 0) {
       continue;
     }
-    const std::vector<uint8_t>& pad     = sec->padding();
-    const std::vector<uint8_t>& content = sec->content();
+    const std::vector<uint8_t>& pad = sec->padding();
+    const Section::content_view_t content = sec->content_view(unused);
     LIEF_DEBUG("Authentihash:  Append section {:<8}: [0x{:04x}, 0x{:04x}] + [0x{:04x}] = [0x{:04x}, 0x{:04x}]",
         sec->name(),
-        sec->offset(), sec->offset() + content.size(), pad.size(),
-        sec->offset(), sec->offset() + content.size() + pad.size());
+        sec->offset(), sec->offset() + content.size, pad.size(),
+        sec->offset(), sec->offset() + content.size + pad.size());
     if (/* overlapping */ sec->offset() < position) {
       // Trunc the beginning of the overlap
-      if (position <= sec->offset() + content.size()) {
+      if (position <= sec->offset() + content.size) {
         const uint64_t start_p = position - sec->offset();
-        const uint64_t size = content.size() - start_p;
-        ios
-          .write(content.data() + start_p, size)
-          .write(pad);
+        spans.emplace_back(content.data + start_p, content.size - start_p);
+        spans.emplace_back(pad.data(), pad.size());
       } else {
         LIEF_WARN("Overlapping in the padding area");
       }
     } else {
-      ios
-        .write(content)
-        .write(pad);
+      spans.emplace_back(content.data, content.size);
+      spans.emplace_back(pad.data(), pad.size());
     }
-    position = sec->offset() + content.size() + pad.size();
+    position = sec->offset() + content.size + pad.size();
   }
   if (this->overlay_.size() > 0) {
     const DataDirectory& cert_dir = this->data_directory(DATA_DIRECTORY::CERTIFICATE_TABLE);
@@ -1222,33 +1211,61 @@ std::vector<uint8_t> Binary::authentihash(ALGORITHMS algo) const {
         LIEF_DEBUG("Add [0x{:x}, 0x{:x}]",
             this->overlay_offset_ + end_cert_offset,
             this->overlay_offset_ + this->overlay_.size() - end_cert_offset);
-        ios
-          .write(this->overlay_.data(), start_cert_offset)
-          .write(this->overlay_.data() + end_cert_offset, this->overlay_.size() - end_cert_offset);
+        spans.emplace_back(this->overlay_.data(), start_cert_offset);
+        spans.emplace_back(this->overlay_.data() + end_cert_offset, this->overlay_.size() - end_cert_offset);
       } else {
-        ios.write(this->overlay());
+        spans.emplace_back(this->overlay_.data(), this->overlay_.size());
       }
     } else {
-      ios.write(this->overlay());
+      spans.emplace_back(this->overlay_.data(), this->overlay_.size());
     }
   }
-  // When something gets wrong with the hash:
-  // std::vector<uint8_t> out = ios.raw();
-  // std::ofstream output_file{"/tmp/hash.blob", std::ios::out | std::ios::binary | std::ios::trunc};
-  // if (output_file) {
-  //   std::copy(
-  //       std::begin(out),
-  //       std::end(out),
-  //       std::ostreambuf_iterator<char>(output_file));
-  // }
-  // std::vector<uint8_t> hash = hashstream(hash_type).write(out).raw();
 
-  std::vector<uint8_t> hash = ios.raw();
-  LIEF_DEBUG("{}", hex_dump(hash));
-  return hash;
+  // The spans are processed by blocks so that a block is still
+  // in the cache when it is hashed by the next algorithm
+  const size_t block_size = 64 * 1024;
+  for (const span_t& span : spans) {
+    for (size_t pos = 0; pos < span.second; pos += block_size) {
+      const size_t size = std::min(block_size, span.second - pos);
+      for (std::unique_ptr<hashstream>& stream : streams) {
+        if (stream != nullptr) {
+          stream->write(span.first + pos, size);
+        }
+      }
+    }
+  }
+
+  std::vector<std::vector<uint8_t>> hashes;
+  hashes.reserve(streams.size());
+  for (std::unique_ptr<hashstream>& stream : streams) {
+    if (stream == nullptr) {
+      hashes.emplace_back();
+      continue;
+    }
+    hashes.push_back(stream->raw());
+    LIEF_DEBUG("{}", hex_dump(hashes.back()));
+  }
+  return hashes;
 }
 
 Signature::VERIFICATION_FLAGS Binary::verify_signature(Signature::VERIFICATION_CHECKS checks) const {
+  return this->verify_signature(checks, nullptr);
+}
+
+Signature::VERIFICATION_FLAGS Binary::verify_signature(Signature::VERIFICATION_CHECKS checks, VerificationCache& cache) const {
+  return this->verify_signature(checks, &cache);
+}
+
+Signature::VERIFICATION_FLAGS Binary::verify_signature(const Signature& sig, Signature::VERIFICATION_CHECKS checks) const {
+  return this->verify_signature(sig, checks, nullptr);
+}
+
+Signature::VERIFICATION_FLAGS Binary::verify_signature(const Signature& sig, Signature::VERIFICATION_CHECKS checks,
+                                                       VerificationCache& cache) const {
+  return this->verify_signature(sig, checks, &cache);
+}
+
+Signature::VERIFICATION_FLAGS Binary::verify_signature(Signature::VERIFICATION_CHECKS checks, VerificationCache* cache) const {
   if (not this->has_signatures()) {
     return Signature::VERIFICATION_FLAGS::NO_SIGNATURE;
   }
@@ -1257,7 +1274,7 @@ Signature::VERIFICATION_FLAGS Binary::verify_signature(Signature::VERIFICATION_C
 
   for (size_t i = 0; i < this->signatures_.size(); ++i) {
     const Signature& sig = this->signatures_[i];
-    flags |= this->verify_signature(sig, checks);
+    flags |= this->verify_signature(sig, checks, cache);
     if (flags != Signature::VERIFICATION_FLAGS::OK) {
       LIEF_INFO("Verification failed for signature #{:d} (0b{:b})", i, static_cast<uintptr_t>(flags));
       break;
@@ -1266,10 +1283,11 @@ Signature::VERIFICATION_FLAGS Binary::verify_signature(Signature::VERIFICATION_C
   return flags;
 }
 
-Signature::VERIFICATION_FLAGS Binary::verify_signature(const Signature& sig, Signature::VERIFICATION_CHECKS checks) const {
+Signature::VERIFICATION_FLAGS Binary::verify_signature(const Signature& sig, Signature::VERIFICATION_CHECKS checks,
+                                                       VerificationCache* cache) const {
   Signature::VERIFICATION_FLAGS flags = Signature::VERIFICATION_FLAGS::OK;
   if (not is_true(checks & Signature::VERIFICATION_CHECKS::HASH_ONLY)) {
-    const Signature::VERIFICATION_FLAGS value = sig.check(checks);
+    const Signature::VERIFICATION_FLAGS value = sig.check(checks, cache);
     if (value != Signature::VERIFICATION_FLAGS::OK) {
       LIEF_INFO("Bad signature (0b{:b})", static_cast<uintptr_t>(value));
       flags |= value;
@@ -1760,5 +1778,13 @@ std::ostream& Binary::print(std::ostream& os) const {
   return os;
 }
 
+const SectionsIndex& Binary::sections_index() const {
+  return this->sections_index_->refresh();
+}
+
+void Binary::invalidate_sections_index() {
+  this->index_tracker_->changed(IndexTracker::SECTIONS);
+}
+
 } // namesapce PE
 } // namespace LIEF
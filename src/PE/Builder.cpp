@@ -95,15 +95,15 @@ Builder& Builder::build_dos_stub(bool flag) {
 void Builder::write(const std::string& filename) const {
   std::ofstream output_file{filename, std::ios::out | std::ios::binary | std::ios::trunc};
   if (output_file) {
-    std::vector<uint8_t> content;
-    this->ios_.get(content);
-    std::copy(
-        std::begin(content),
-        std::end(content),
-        std::ostreambuf_iterator<char>(output_file));
+    this->write(output_file);
   }
 }
 
+void Builder::write(std::ostream& os) const {
+  const std::vector<uint8_t>& content = this->ios_.raw();
+  os.write(reinterpret_cast<const char*>(content.data()), content.size());
+}
+
 
 void Builder::build() {
 
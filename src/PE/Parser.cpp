@@ -30,6 +30,7 @@
 #include "LIEF/exception.hpp"
 
 #include "LIEF/BinaryStream/VectorStream.hpp"
+#include "LIEF/BinaryStream/MmapStream.hpp"
 #include "LIEF/Abstract/Relocation.hpp"
 #include "LIEF/PE/signature/Signature.hpp"
 #include "LIEF/PE/signature/SignatureParser.hpp"
@@ -81,7 +82,7 @@ Parser::Parser(const std::string& file) :
   }
 
   // Read from file
-  this->stream_ = std::unique_ptr<VectorStream>(new VectorStream{file});
+  this->stream_ = std::unique_ptr<MmapStream>(new MmapStream{file});
   this->init(filesystem::path(file).filename());
 }
 
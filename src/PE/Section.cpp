@@ -26,6 +26,8 @@
 #include "LIEF/PE/Section.hpp"
 #include "LIEF/PE/EnumToString.hpp"
 
+#include "index_tracker.hpp"
+
 namespace LIEF {
 namespace PE {
 
@@ -34,8 +36,36 @@ Section::~Section() = default;
 Section::Section() = default;
 
 
-Section& Section::operator=(const Section&) = default;
-Section::Section(const Section&) = default;
+// The copy is not registered in the index of the original section
+Section::Section(const Section& other) :
+  LIEF::Section{other},
+  content_{other.content_},
+  padding_{other.padding_},
+  virtual_size_{other.virtual_size_},
+  pointer_to_relocations_{other.pointer_to_relocations_},
+  pointer_to_linenumbers_{other.pointer_to_linenumbers_},
+  number_of_relocations_{other.number_of_relocations_},
+  number_of_linenumbers_{other.number_of_linenumbers_},
+  characteristics_{other.characteristics_},
+  types_{other.types_}
+{}
+
+Section& Section::operator=(const Section& other) {
+  if (this != &other) {
+    LIEF::Section::operator=(other);
+    this->content_                = other.content_;
+    this->padding_                = other.padding_;
+    this->virtual_size_           = other.virtual_size_;
+    this->pointer_to_relocations_ = other.pointer_to_relocations_;
+    this->pointer_to_linenumbers_ = other.pointer_to_linenumbers_;
+    this->number_of_relocations_  = other.number_of_relocations_;
+    this->number_of_linenumbers_  = other.number_of_linenumbers_;
+    this->characteristics_        = other.characteristics_;
+    this->types_                  = other.types_;
+    IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
+  }
+  return *this;
+}
 
 Section::Section(const pe_section* header) :
   virtual_size_{header->VirtualSize},
@@ -82,6 +112,10 @@ std::vector<uint8_t> Section::content() const {
   return this->content_;
 }
 
+Section::content_view_t Section::content_view(std::vector<uint8_t>&) const {
+  return {this->content_.data(), this->content_.size()};
+}
+
 std::vector<uint8_t>& Section::content_ref() {
   return this->content_;
 }
@@ -152,8 +186,27 @@ void Section::content(const std::vector<uint8_t>& data) {
 }
 
 
+void Section::size(uint64_t size) {
+  LIEF::Section::size(size);
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
+}
+
+
+void Section::offset(uint64_t offset) {
+  LIEF::Section::offset(offset);
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
+}
+
+
+void Section::virtual_address(uint64_t virtual_address) {
+  LIEF::Section::virtual_address(virtual_address);
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
+}
+
+
 void Section::virtual_size(uint32_t virtualSize) {
   this->virtual_size_ = virtualSize;
+  IndexTracker::changed(this->index_tracker_, IndexTracker::SECTIONS);
 }
 
 
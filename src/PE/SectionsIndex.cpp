@@ -0,0 +1,77 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+
+#include "LIEF/PE/Section.hpp"
+
+#include "SectionsIndex.hpp"
+
+namespace LIEF {
+namespace PE {
+
+SectionsIndex::SectionsIndex(IndexTracker& tracker, const sections_t& sections) :
+  tracker_{tracker},
+  sections_{sections}
+{}
+
+const SectionsIndex& SectionsIndex::refresh() {
+  if (this->nb_sections_.load(std::memory_order_relaxed) != this->sections_.size()) {
+    this->tracker_.changed(IndexTracker::SECTIONS);
+  }
+  this->tracker_.refresh(IndexTracker::SECTIONS, [this] (uint32_t) { this->update(); });
+  return *this;
+}
+
+void SectionsIndex::update() {
+  this->by_offset_.clear();
+  this->by_rva_.clear();
+  this->by_rva_adjusted_.clear();
+  for (size_t i = 0; i < this->sections_.size(); ++i) {
+    Section* section = this->sections_[i];
+    if (section == nullptr) {
+      continue;
+    }
+    section->index_tracker_ = &this->tracker_;
+    const uint64_t va = section->virtual_address();
+    this->by_offset_.add(section->offset(), section->sizeof_raw_data(), i);
+    this->by_rva_.add(va, section->virtual_size(), i);
+    this->by_rva_adjusted_.add(va, std::max(section->virtual_size(), section->sizeof_raw_data()), i);
+  }
+
+  this->by_offset_.finalize();
+  this->by_rva_.finalize();
+  this->by_rva_adjusted_.finalize();
+  this->nb_sections_.store(this->sections_.size(), std::memory_order_relaxed);
+}
+
+const Section* SectionsIndex::get(size_t idx) const {
+  return idx == npos ? nullptr : this->sections_[idx];
+}
+
+const Section* SectionsIndex::section_from_offset(uint64_t offset) const {
+  return this->get(this->by_offset_.find(offset));
+}
+
+const Section* SectionsIndex::section_from_rva(uint64_t rva) const {
+  return this->get(this->by_rva_.find(rva));
+}
+
+const Section* SectionsIndex::section_from_rva_adjusted(uint64_t rva) const {
+  return this->get(this->by_rva_adjusted_.find(rva));
+}
+
+}
+}
@@ -0,0 +1,71 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_PE_SECTIONS_INDEX_H_
+#define LIEF_PE_SECTIONS_INDEX_H_
+#include <atomic>
+
+#include "LIEF/PE/type_traits.hpp"
+
+#include "ranges_index.hpp"
+#include "index_tracker.hpp"
+
+namespace LIEF {
+namespace PE {
+class Section;
+
+//! Sorted view of the sections of a PE::Binary used to translate an RVA
+//! or an offset in O(log n).
+//!
+//! Like the ELF::AddressIndex, the index lives as long as the Binary and it is
+//! updated when the IndexTracker of the Binary flags the sections as stale:
+//! the Section setters that modify an address, an offset or a size flag the
+//! tracker of their binary.
+class SectionsIndex {
+  public:
+  static constexpr size_t npos = RangesIndex::npos;
+
+  SectionsIndex(IndexTracker& tracker, const sections_t& sections);
+
+  //! Update the index if it is stale
+  const SectionsIndex& refresh();
+
+  //! Section whose raw data (``PointerToRawData``, ``SizeOfRawData``) contains the offset
+  const Section* section_from_offset(uint64_t offset) const;
+
+  //! Section whose ``[VirtualAddress, VirtualAddress + VirtualSize)`` range contains the RVA
+  const Section* section_from_rva(uint64_t rva) const;
+
+  //! Same as section_from_rva() but the size of the section is
+  //! ``max(VirtualSize, SizeOfRawData)``, as used by Binary::rva_to_offset
+  const Section* section_from_rva_adjusted(uint64_t rva) const;
+
+  private:
+  void update();
+  const Section* get(size_t idx) const;
+
+  IndexTracker&     tracker_;
+  const sections_t& sections_;
+
+  std::atomic<size_t> nb_sections_{0};
+
+  RangesIndex by_offset_;
+  RangesIndex by_rva_;
+  RangesIndex by_rva_adjusted_;
+};
+
+}
+}
+#endif
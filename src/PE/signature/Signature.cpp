@@ -22,6 +22,7 @@
 
 #include "LIEF/PE/signature/Signature.hpp"
 #include "LIEF/PE/signature/OIDToString.hpp"
+#include "LIEF/PE/signature/VerificationCache.hpp"
 #include "LIEF/PE/EnumToString.hpp"
 
 #include "LIEF/PE/signature/Attribute.hpp"
@@ -69,8 +70,17 @@ std::string Signature::flag_to_string(Signature::VERIFICATION_FLAGS flag) {
   return it == enumStrings.end() ? "UNDEFINED" : it->second;
 }
 
+inline bool check_signature(const x509& cert, const std::vector<uint8_t>& hash,
+                            const std::vector<uint8_t>& signature, ALGORITHMS digest,
+                            VerificationCache* cache) {
+  if (cache != nullptr) {
+    return cache->check_signature(cert, hash, signature, digest);
+  }
+  return cert.check_signature(hash, signature, digest);
+}
+
 Signature::VERIFICATION_FLAGS verify_ts_counter_signature(const SignerInfo& signer,
-    const PKCS9CounterSignature& cs, Signature::VERIFICATION_CHECKS checks) {
+    const PKCS9CounterSignature& cs, Signature::VERIFICATION_CHECKS checks, VerificationCache* cache) {
   LIEF_DEBUG("PKCS #9 Counter signature found");
   Signature::VERIFICATION_FLAGS flags = Signature::VERIFICATION_FLAGS::OK;
    const SignerInfo& cs_signer = cs.signer();
@@ -90,7 +100,7 @@ Signature::VERIFICATION_FLAGS verify_ts_counter_signature(const SignerInfo& sign
   const ALGORITHMS cs_digest_algo = cs_signer.digest_algorithm();
   const std::vector<uint8_t>& cs_hash = Signature::hash(cs_auth_data, cs_digest_algo);
   LIEF_DEBUG("Signed data digest: {}", hex_dump(cs_hash));
-  bool check_sig = cs_cert.check_signature(cs_hash, cs_enc_digest, cs_digest_algo);
+  bool check_sig = check_signature(cs_cert, cs_hash, cs_enc_digest, cs_digest_algo, cache);
 
   if (not check_sig) {
     LIEF_WARN("Authenticated signature (counter signature) mismatch");
@@ -248,6 +258,14 @@ it_const_signers_t Signature::signers() const {
 }
 
 Signature::VERIFICATION_FLAGS Signature::check(VERIFICATION_CHECKS checks) const {
+  return this->check(checks, nullptr);
+}
+
+Signature::VERIFICATION_FLAGS Signature::check(VERIFICATION_CHECKS checks, VerificationCache& cache) const {
+  return this->check(checks, &cache);
+}
+
+Signature::VERIFICATION_FLAGS Signature::check(VERIFICATION_CHECKS checks, VerificationCache* cache) const {
   // According to the Authenticode documentation,
   // *SignerInfos contains one SignerInfo structure*
   const size_t nb_signers = this->signers_.size();
@@ -328,7 +346,7 @@ Signature::VERIFICATION_FLAGS Signature::check(VERIFICATION_CHECKS checks) const
 
     const std::vector<uint8_t> auth_attr_hash = Signature::hash(auth_data, digest_algo);
     LIEF_DEBUG("Authenticated attribute digest: {}", hex_dump(auth_attr_hash));
-    bool check_sig = cert.check_signature(auth_attr_hash, enc_digest, digest_algo);
+    bool check_sig = check_signature(cert, auth_attr_hash, enc_digest, digest_algo, cache);
 
     if (not check_sig) {
       LIEF_WARN("Authenticated signature mismatch");
@@ -355,7 +373,7 @@ Signature::VERIFICATION_FLAGS Signature::check(VERIFICATION_CHECKS checks) const
     /*
      * If there is no authenticated attributes, then the encrypted digested should match ENC(content_info_hash)
      */
-    if (not cert.check_signature(content_info_hash, enc_digest, digest_algo)) {
+    if (not check_signature(cert, content_info_hash, enc_digest, digest_algo, cache)) {
       return flags | VERIFICATION_FLAGS::BAD_SIGNATURE;
     }
   }
@@ -375,7 +393,7 @@ Signature::VERIFICATION_FLAGS Signature::check(VERIFICATION_CHECKS checks) const
   }
   bool timeless_signature = false;
   if (counter != nullptr) {
-    VERIFICATION_FLAGS cs_flags = verify_ts_counter_signature(signer, *counter, checks);
+    VERIFICATION_FLAGS cs_flags = verify_ts_counter_signature(signer, *counter, checks, cache);
     if (cs_flags == VERIFICATION_FLAGS::OK) {
       timeless_signature = true;
     }
@@ -0,0 +1,249 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <array>
+
+#include "mbedtls/sha256.h"
+#include "mbedtls/x509_crt.h"
+#include "mbedtls/pk.h"
+#include "mbedtls/rsa.h"
+
+#include "logging.hpp"
+
+#include "LIEF/PE/signature/VerificationCache.hpp"
+
+namespace LIEF {
+namespace PE {
+
+namespace {
+enum class KIND : char {
+  TRUSTED_BY = 'T',
+  VERIFY     = 'V',
+};
+
+class sha256_t {
+  public:
+  sha256_t() {
+    mbedtls_sha256_init(&this->ctx_);
+    mbedtls_sha256_starts(&this->ctx_, /* is224 */ 0);
+  }
+
+  sha256_t& update(const uint8_t* data, size_t size) {
+    mbedtls_sha256_update(&this->ctx_, data, size);
+    return *this;
+  }
+
+  sha256_t& update(const std::vector<uint8_t>& data) {
+    return this->update(data.data(), data.size());
+  }
+
+  std::array<uint8_t, 32> finish() {
+    std::array<uint8_t, 32> digest;
+    mbedtls_sha256_finish(&this->ctx_, digest.data());
+    return digest;
+  }
+
+  ~sha256_t() {
+    mbedtls_sha256_free(&this->ctx_);
+  }
+
+  private:
+  mbedtls_sha256_context ctx_;
+};
+
+template<class T>
+inline void append(std::string& key, const T& data) {
+  key.append(reinterpret_cast<const char*>(data.data()), data.size());
+}
+}
+
+constexpr size_t VerificationCache::DEFAULT_MAX_ENTRIES;
+
+VerificationCache::VerificationCache(size_t max_entries) :
+  max_entries_{max_entries}
+{}
+
+VerificationCache::~VerificationCache() = default;
+
+x509::VERIFICATION_FLAGS VerificationCache::is_trusted_by(const x509& cert, const std::vector<x509>& ca) {
+  if (cert.fingerprint().empty() or ca.empty()) {
+    return cert.is_trusted_by(ca);
+  }
+
+  // The order of the CA matters as it defines the chain given to mbedtls
+  sha256_t ca_set;
+  for (const x509& crt : ca) {
+    if (crt.fingerprint().empty()) {
+      return cert.is_trusted_by(ca);
+    }
+    ca_set.update(crt.fingerprint());
+  }
+
+  key_t key(1, static_cast<char>(KIND::TRUSTED_BY));
+  append(key, cert.fingerprint());
+  append(key, ca_set.finish());
+
+  uint32_t value = 0;
+  if (this->lookup(key, value)) {
+    return static_cast<x509::VERIFICATION_FLAGS>(value);
+  }
+  const x509::VERIFICATION_FLAGS flags = cert.is_trusted_by(ca);
+  this->insert(std::move(key), static_cast<uint32_t>(flags));
+  return flags;
+}
+
+x509::VERIFICATION_FLAGS VerificationCache::verify(const x509& ca, const x509& child) {
+  if (ca.fingerprint().empty() or child.fingerprint().empty()) {
+    return ca.verify(child);
+  }
+
+  key_t key(1, static_cast<char>(KIND::VERIFY));
+  append(key, ca.fingerprint());
+  append(key, child.fingerprint());
+
+  uint32_t value = 0;
+  if (this->lookup(key, value)) {
+    return static_cast<x509::VERIFICATION_FLAGS>(value);
+  }
+  const x509::VERIFICATION_FLAGS flags = ca.verify(child);
+  this->insert(std::move(key), static_cast<uint32_t>(flags));
+  return flags;
+}
+
+bool VerificationCache::check_signature(const x509& cert, const std::vector<uint8_t>& hash,
+                                        const std::vector<uint8_t>& signature, ALGORITHMS digest) {
+  if (cert.fingerprint().empty()) {
+    return cert.check_signature(hash, signature, digest);
+  }
+  std::shared_ptr<const x509> key_owner = this->signer(cert);
+  if (key_owner == nullptr) {
+    return cert.check_signature(hash, signature, digest);
+  }
+  return key_owner->check_signature(hash, signature, digest);
+}
+
+std::shared_ptr<const x509> VerificationCache::signer(const x509& cert) {
+  key_t key;
+  append(key, cert.fingerprint());
+  {
+    std::lock_guard<std::mutex> guard{this->lock_};
+    auto it = this->signers_.find(key);
+    if (it != std::end(this->signers_)) {
+      ++this->stats_.hits;
+      return it->second;
+    }
+    ++this->stats_.misses;
+  }
+
+  // mbedtls computes the Montgomery constant of the RSA modulus on the first public
+  // operation and stores it in the key context. It is computed here, before the key is
+  // shared, so that the threads that use this key only read its context.
+  auto key_owner = std::make_shared<const x509>(cert);
+  if (key_owner->x509_cert_ == nullptr) {
+    return nullptr;
+  }
+  mbedtls_pk_context& ctx = key_owner->x509_cert_->private_pk;
+  if (mbedtls_pk_get_type(&ctx) == MBEDTLS_PK_RSA) {
+    auto* ctx_rsa = reinterpret_cast<mbedtls_rsa_context*>(ctx.private_pk_ctx);
+    std::vector<uint8_t> input(ctx_rsa->private_len, 0);
+    std::vector<uint8_t> output(ctx_rsa->private_len, 0);
+    if (not input.empty()) {
+      input.back() = 1;
+      mbedtls_rsa_public(ctx_rsa, input.data(), output.data());
+    }
+  }
+
+  std::lock_guard<std::mutex> guard{this->lock_};
+  auto it = this->signers_.find(key);
+  if (it != std::end(this->signers_)) {
+    // Another thread parsed the same key in the meantime
+    return it->second;
+  }
+  if (this->max_entries_ > 0 and this->signers_.size() >= this->max_entries_) {
+    this->signers_.erase(std::begin(this->signers_));
+    ++this->stats_.evictions;
+  }
+  this->signers_.emplace(std::move(key), key_owner);
+  return key_owner;
+}
+
+bool VerificationCache::lookup(const key_t& key, uint32_t& value) {
+  std::lock_guard<std::mutex> guard{this->lock_};
+  auto it = this->entries_.find(key);
+  if (it == std::end(this->entries_)) {
+    ++this->stats_.misses;
+    return false;
+  }
+  // Move the entry at the front of the LRU list
+  this->lru_.splice(std::begin(this->lru_), this->lru_, it->second);
+  ++this->stats_.hits;
+  value = it->second->second;
+  return true;
+}
+
+void VerificationCache::insert(key_t key, uint32_t value) {
+  std::lock_guard<std::mutex> guard{this->lock_};
+  auto it = this->entries_.find(key);
+  if (it != std::end(this->entries_)) {
+    // Another thread computed the same result in the meantime
+    it->second->second = value;
+    this->lru_.splice(std::begin(this->lru_), this->lru_, it->second);
+    return;
+  }
+
+  if (this->max_entries_ > 0 and this->lru_.size() >= this->max_entries_) {
+    this->entries_.erase(this->lru_.back().first);
+    this->lru_.pop_back();
+    ++this->stats_.evictions;
+  }
+  this->lru_.emplace_front(std::move(key), value);
+  this->entries_.emplace(this->lru_.front().first, std::begin(this->lru_));
+}
+
+VerificationCache::stats_t VerificationCache::stats() const {
+  std::lock_guard<std::mutex> guard{this->lock_};
+  stats_t stats = this->stats_;
+  stats.entries = this->lru_.size() + this->signers_.size();
+  return stats;
+}
+
+void VerificationCache::reset_stats() {
+  std::lock_guard<std::mutex> guard{this->lock_};
+  this->stats_ = stats_t{};
+}
+
+void VerificationCache::clear() {
+  std::lock_guard<std::mutex> guard{this->lock_};
+  LIEF_DEBUG("Clearing {:d} cached verification(s) and {:d} signer key(s)",
+             this->lru_.size(), this->signers_.size());
+  this->entries_.clear();
+  this->lru_.clear();
+  this->signers_.clear();
+}
+
+size_t VerificationCache::max_entries() const {
+  return this->max_entries_;
+}
+
+std::ostream& operator<<(std::ostream& os, const VerificationCache::stats_t& stats) {
+  os << "hits: "       << stats.hits
+     << ", misses: "   << stats.misses
+     << ", evictions: " << stats.evictions
+     << ", entries: "  << stats.entries;
+  return os;
+}
+
+}
+}
@@ -24,6 +24,7 @@
 #include "mbedtls/asn1.h"
 #include "mbedtls/oid.h"
 #include "mbedtls/error.h"
+#include "mbedtls/sha256.h"
 
 #include "logging.hpp"
 
@@ -59,6 +60,15 @@ namespace {
 
       return( ret );
   }
+
+  inline std::vector<uint8_t> fingerprint_of(const mbedtls_x509_crt* crt) {
+    if (crt == nullptr) {
+      return {};
+    }
+    std::vector<uint8_t> digest(32);
+    mbedtls_sha256(crt->private_raw.private_p, crt->private_raw.private_len, digest.data(), /* is224 */ 0);
+    return digest;
+  }
 }
 
 
@@ -259,11 +269,13 @@ bool x509::time_is_future(const date_t& from) {
 x509::x509() = default;
 
 x509::x509(mbedtls_x509_crt* ca) :
-  x509_cert_{ca}
+  x509_cert_{ca},
+  fingerprint_{fingerprint_of(ca)}
 {}
 
 x509::x509(const x509& other) :
-  Object::Object{other}
+  Object::Object{other},
+  fingerprint_{other.fingerprint_}
 {
   mbedtls_x509_crt* crt = new mbedtls_x509_crt{};
   mbedtls_x509_crt_init(crt);
@@ -285,7 +297,8 @@ x509& x509::operator=(x509 other) {
 
 
 void x509::swap(x509& other) {
-  std::swap(this->x509_cert_, other.x509_cert_);
+  std::swap(this->x509_cert_,   other.x509_cert_);
+  std::swap(this->fingerprint_, other.fingerprint_);
 }
 
 uint32_t x509::version() const {
@@ -330,6 +343,10 @@ std::vector<uint8_t> x509::raw() const {
           this->x509_cert_->private_raw.private_p + this->x509_cert_->private_raw.private_len};
 }
 
+const std::vector<uint8_t>& x509::fingerprint() const {
+  return this->fingerprint_;
+}
+
 
 x509::KEY_TYPES x509::key_type() const {
   static const std::map<mbedtls_pk_type_t, x509::KEY_TYPES> mtype2asi = {
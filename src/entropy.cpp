@@ -0,0 +1,173 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+#include "LIEF/utils.hpp"
+#include "LIEF/exception.hpp"
+
+namespace LIEF {
+
+using histogram_t = std::array<uint64_t, 256>;
+
+// Byte histogram computed with 8 interleaved tables of counters: consecutive
+// (and often identical) bytes increment different counters so that the
+// increments don't wait on each other. The data is read 8 bytes at a time.
+static void histogram(const uint8_t* data, size_t size, histogram_t& freq) {
+  // Flush the 32-bit counters before they can overflow
+  static constexpr size_t BLOCK_SIZE = 1llu << 30;
+
+  // Not worth clearing the tables
+  if (size < 4096) {
+    for (size_t i = 0; i < size; ++i) {
+      ++freq[data[i]];
+    }
+    return;
+  }
+
+  while (size > 0) {
+    const size_t block = std::min(size, BLOCK_SIZE);
+    std::array<std::array<uint32_t, 256>, 8> tables{};
+
+    size_t i = 0;
+    for (; i + 8 <= block; i += 8) {
+      uint64_t v;
+      std::memcpy(&v, data + i, sizeof(v));
+      ++tables[0][ v        & 0xFF];
+      ++tables[1][(v >>  8) & 0xFF];
+      ++tables[2][(v >> 16) & 0xFF];
+      ++tables[3][(v >> 24) & 0xFF];
+      ++tables[4][(v >> 32) & 0xFF];
+      ++tables[5][(v >> 40) & 0xFF];
+      ++tables[6][(v >> 48) & 0xFF];
+      ++tables[7][ v >> 56        ];
+    }
+    for (; i < block; ++i) {
+      ++tables[0][data[i]];
+    }
+
+    for (size_t b = 0; b < 256; ++b) {
+      freq[b] += static_cast<uint64_t>(tables[0][b]) + tables[1][b] + tables[2][b] + tables[3][b] +
+                 tables[4][b] + tables[5][b] + tables[6][b] + tables[7][b];
+    }
+    data += block;
+    size -= block;
+  }
+}
+
+// H = -sum(p * log2(p)) = log2(N) - sum(f * log2(f)) / N
+static double entropy(const histogram_t& freq, size_t size) {
+  if (size == 0) {
+    return 0.0;
+  }
+  double sum = 0.0;
+  for (uint64_t f : freq) {
+    if (f > 1) {
+      sum += static_cast<double>(f) * std::log2(static_cast<double>(f));
+    }
+  }
+  return std::log2(static_cast<double>(size)) - sum / static_cast<double>(size);
+}
+
+
+double entropy(const uint8_t* data, size_t size) {
+  histogram_t freq{};
+  histogram(data, size, freq);
+  return entropy(freq, size);
+}
+
+double entropy(const std::vector<uint8_t>& data) {
+  return entropy(data.data(), data.size());
+}
+
+std::vector<double> entropy_profile(const uint8_t* data, size_t size, size_t window, size_t stride) {
+  if (window == 0 or stride == 0) {
+    throw exception("The window and the stride of an entropy profile must be greater than 0");
+  }
+
+  if (size == 0) {
+    return {};
+  }
+
+  if (size <= window) {
+    return {entropy(data, size)};
+  }
+
+  const size_t nb_windows = (size - window) / stride + 1;
+  std::vector<double> profile;
+  profile.reserve(nb_windows);
+
+  if (stride >= window) {
+    for (size_t i = 0; i < nb_windows; ++i) {
+      profile.push_back(entropy(data + i * stride, window));
+    }
+    return profile;
+  }
+
+  // Overlapping windows: the histogram is updated with the bytes that leave
+  // and enter the window and sum(f * log2(f)) is updated from a table.
+  // The sum is recomputed once the window has been fully renewed so that
+  // the rounding errors don't accumulate.
+  std::vector<double> xlog2x(window + 1, 0.0);
+  for (size_t c = 2; c <= window; ++c) {
+    xlog2x[c] = static_cast<double>(c) * std::log2(static_cast<double>(c));
+  }
+
+  histogram_t freq{};
+  histogram(data, window, freq);
+
+  const double log2_window = std::log2(static_cast<double>(window));
+  const size_t refresh = (window + stride - 1) / stride;
+
+  auto compute_sum = [&freq, &xlog2x] () {
+    double sum = 0.0;
+    for (uint64_t f : freq) {
+      sum += xlog2x[f];
+    }
+    return sum;
+  };
+
+  double sum = compute_sum();
+  profile.push_back(log2_window - sum / window);
+
+  for (size_t i = 1; i < nb_windows; ++i) {
+    const uint8_t* leaving  = data + (i - 1) * stride;
+    const uint8_t* entering = leaving + window;
+    for (size_t k = 0; k < stride; ++k) {
+      uint64_t& out = freq[leaving[k]];
+      sum += xlog2x[out - 1] - xlog2x[out];
+      --out;
+
+      uint64_t& in = freq[entering[k]];
+      sum += xlog2x[in + 1] - xlog2x[in];
+      ++in;
+    }
+
+    if (i % refresh == 0) {
+      sum = compute_sum();
+    }
+    profile.push_back(log2_window - sum / window);
+  }
+  return profile;
+}
+
+std::vector<double> entropy_profile(const std::vector<uint8_t>& data, size_t window, size_t stride) {
+  return entropy_profile(data.data(), data.size(), window, stride);
+}
+
+}
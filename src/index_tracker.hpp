@@ -0,0 +1,105 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_INDEX_TRACKER_H_
+#define LIEF_INDEX_TRACKER_H_
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+
+namespace LIEF {
+
+//! Staleness of the lookup indexes owned by a binary.
+//!
+//! Each binary owns one tracker. The objects registered in an index (sections,
+//! segments, relocations, symbols) keep a pointer to the tracker of their binary
+//! and the setters that modify an indexed field only flag their own KIND as
+//! stale: it is a single atomic operation, whatever the number of modifications.
+//! The indexes are then updated once, by the next lookup that needs them.
+//!
+//! The update is serialized by a mutex so that concurrent const lookups on
+//! the same binary are safe. Modifying a binary while another thread reads it
+//! is not supported.
+class IndexTracker {
+  public:
+  enum KIND : uint32_t {
+    SECTIONS       = 1u << 0,
+    SEGMENTS       = 1u << 1,
+    RELOCATIONS    = 1u << 2,
+
+    //! Names of the symbols (ELF .dynsym, Mach-O symbols)
+    SYMBOLS        = 1u << 3,
+    //! Names of the ELF .symtab symbols
+    STATIC_SYMBOLS = 1u << 4,
+
+    //! ELF ``DT_GNU_HASH`` / ``DT_HASH`` tables read by the parser. They are
+    //! never rebuilt: once a dynamic symbol is added, removed, moved or renamed
+    //! the kind stays stale.
+    DYNAMIC_HASH   = 1u << 5,
+
+    ALL = ~0u,
+  };
+
+  IndexTracker() = default;
+  IndexTracker(const IndexTracker&) = delete;
+  IndexTracker& operator=(const IndexTracker&) = delete;
+
+  //! Flag the given kinds as stale
+  void changed(uint32_t kinds) {
+    this->stale_.fetch_or(kinds, std::memory_order_relaxed);
+  }
+
+  //! Flag the given kinds as stale on ``tracker`` if the object
+  //! is registered in an index
+  static void changed(IndexTracker* tracker, uint32_t kinds) {
+    if (tracker != nullptr) {
+      tracker->changed(kinds);
+    }
+  }
+
+  //! Flag the given kinds as up to date
+  void reset(uint32_t kinds) {
+    this->stale_.fetch_and(~kinds, std::memory_order_release);
+  }
+
+  bool is_stale(uint32_t kinds) const {
+    return (this->stale_.load(std::memory_order_acquire) & kinds) != 0;
+  }
+
+  //! Call ``update(stale)`` with the subset of ``kinds`` that are stale.
+  //!
+  //! The stale bits are cleared once the update is done so that the lock-free
+  //! fast path never observes an index being rebuilt.
+  template<class F>
+  void refresh(uint32_t kinds, F&& update) {
+    if (not this->is_stale(kinds)) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock{this->mutex_};
+    const uint32_t stale = this->stale_.load(std::memory_order_acquire) & kinds;
+    if (stale == 0) {
+      return;
+    }
+    update(stale);
+    this->stale_.fetch_and(~stale, std::memory_order_release);
+  }
+
+  private:
+  std::atomic<uint32_t> stale_{ALL};
+  std::mutex mutex_;
+};
+
+}
+#endif
@@ -15,6 +15,7 @@
  */
 
 #include <map>
+#include <mutex>
 #include "LIEF/config.h"
 #include "LIEF/logging.hpp"
 #include "LIEF/platforms.hpp"
@@ -58,10 +59,12 @@ Logger::Logger() {
 }
 
 Logger& Logger::instance() {
-  if (instance_ == nullptr) {
+  // The logger can be reached concurrently by parsers running on different threads
+  static std::once_flag initialized;
+  std::call_once(initialized, [] {
     instance_ = new Logger{};
     std::atexit(destroy);
-  }
+  });
   return *instance_;
 }
 
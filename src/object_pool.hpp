@@ -0,0 +1,131 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_OBJECT_POOL_H_
+#define LIEF_OBJECT_POOL_H_
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+
+namespace LIEF {
+
+//! Pool of objects of type T allocated in contiguous chunks
+//!
+//! It is used by the binaries to allocate the (numerous) objects created by
+//! the parsers with fewer calls to the allocator and a better locality.
+//! The memory is released when the pool is destroyed but the objects
+//! **must** be destroyed with destroy() before.
+//!
+//! All the objects of an owner must be created by its pool: destroy() doesn't
+//! look up the chunk of an object, it only puts its slot back in the free list.
+template<class T>
+class ObjectPool {
+  public:
+  class Deleter {
+    public:
+    Deleter(ObjectPool* pool = nullptr) : pool_{pool} {}
+    void operator()(T* obj) const {
+      if (this->pool_ != nullptr) {
+        this->pool_->destroy(obj);
+      } else {
+        delete obj;
+      }
+    }
+    private:
+    ObjectPool* pool_;
+  };
+  using ptr_t = std::unique_ptr<T, Deleter>;
+
+  static constexpr size_t MIN_CHUNK_SIZE = 64;
+
+  ObjectPool() = default;
+  ObjectPool(const ObjectPool&) = delete;
+  ObjectPool& operator=(const ObjectPool&) = delete;
+
+  //! Construct a new object in the pool
+  template<class... Args>
+  ptr_t create(Args&&... args) {
+    void* slot = this->allocate();
+    try {
+      return ptr_t{new (slot) T(std::forward<Args>(args)...), Deleter{this}};
+    } catch (...) {
+      this->free_.push_back(static_cast<storage_t*>(slot));
+      throw;
+    }
+  }
+
+  //! Destroy an object created by create()
+  void destroy(T* obj) {
+    if (obj == nullptr) {
+      return;
+    }
+    obj->~T();
+    this->free_.push_back(reinterpret_cast<storage_t*>(obj));
+  }
+
+  //! Pre-allocate room for `nb_objects` objects (e.g. the number of entries
+  //! of a table that is about to be parsed)
+  void reserve(size_t nb_objects) {
+    if (this->free_.size() + this->available() >= nb_objects) {
+      return;
+    }
+    this->add_chunk(nb_objects);
+  }
+
+  private:
+  using storage_t = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+  struct chunk_t {
+    std::unique_ptr<storage_t[]> data;
+    size_t capacity;
+    size_t used;
+  };
+
+  size_t available() const {
+    if (this->chunks_.empty()) {
+      return 0;
+    }
+    const chunk_t& chunk = this->chunks_.back();
+    return chunk.capacity - chunk.used;
+  }
+
+  void add_chunk(size_t capacity) {
+    this->chunks_.push_back({std::unique_ptr<storage_t[]>{new storage_t[capacity]}, capacity, 0});
+  }
+
+  void* allocate() {
+    if (not this->free_.empty()) {
+      storage_t* slot = this->free_.back();
+      this->free_.pop_back();
+      return slot;
+    }
+    if (this->available() == 0) {
+      // Geometric growth to keep the number of chunks small
+      const size_t last = this->chunks_.empty() ? 0 : this->chunks_.back().capacity;
+      this->add_chunk(std::max<size_t>(MIN_CHUNK_SIZE, 2 * last));
+    }
+    chunk_t& chunk = this->chunks_.back();
+    return chunk.data.get() + chunk.used++;
+  }
+
+  std::vector<chunk_t>    chunks_;
+  std::vector<storage_t*> free_;
+};
+
+template<class T>
+constexpr size_t ObjectPool<T>::MIN_CHUNK_SIZE;
+
+}
+#endif
@@ -0,0 +1,193 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_PARALLEL_H_
+#define LIEF_PARALLEL_H_
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace LIEF {
+
+//! Resolve a number of threads given by the user: 0 means all the
+//! hardware threads
+inline size_t resolve_nb_threads(size_t nb_threads) {
+  if (nb_threads > 0) {
+    return nb_threads;
+  }
+  return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+//! Call ``fn(i)`` for each ``i`` in ``[0, count)`` on (at most) ``nb_threads``
+//! threads. The calling thread also processes some indexes.
+//!
+//! The first exception raised by ``fn`` is re-thrown once all the threads are done.
+template<class F>
+void parallel_for(size_t nb_threads, size_t count, const F& fn) {
+  nb_threads = std::min(resolve_nb_threads(nb_threads), count);
+  if (nb_threads <= 1) {
+    for (size_t i = 0; i < count; ++i) {
+      fn(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next{0};
+  auto&& worker = [&next, count, &fn] () {
+    for (size_t i = next++; i < count; i = next++) {
+      fn(i);
+    }
+  };
+
+  std::vector<std::future<void>> jobs;
+  jobs.reserve(nb_threads - 1);
+  for (size_t i = 1; i < nb_threads; ++i) {
+    jobs.push_back(std::async(std::launch::async, worker));
+  }
+
+  std::exception_ptr error;
+  try {
+    worker();
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  for (std::future<void>& job : jobs) {
+    try {
+      job.get();
+    } catch (...) {
+      if (not error) {
+        error = std::current_exception();
+      }
+    }
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+//! Same as parallel_for() but the indexes are scheduled with work stealing.
+//!
+//! Each thread starts with a contiguous range of ``[0, count)`` and, once its
+//! range is exhausted, it steals the second half of the range of another thread.
+//! Compared to a shared counter, a thread processes neighbouring indexes (which
+//! usually share some locality) and the threads only contend when they steal.
+//!
+//! ``fn`` is called as ``fn(i, thread_idx)`` where ``thread_idx`` is in ``[0, nb_threads)``.
+template<class F>
+void parallel_for_stealing(size_t nb_threads, size_t count, const F& fn) {
+  nb_threads = std::min(resolve_nb_threads(nb_threads), count);
+  if (nb_threads <= 1) {
+    for (size_t i = 0; i < count; ++i) {
+      fn(i, 0);
+    }
+    return;
+  }
+
+  struct range_t {
+    std::mutex lock;
+    size_t begin = 0;
+    size_t end   = 0;
+  };
+
+  std::vector<range_t> ranges(nb_threads);
+  for (size_t i = 0; i < nb_threads; ++i) {
+    ranges[i].begin = count * i / nb_threads;
+    ranges[i].end   = count * (i + 1) / nb_threads;
+  }
+
+  // Pop the first index of the range owned by the thread
+  auto&& pop = [&ranges] (size_t thread_idx, size_t& idx) {
+    range_t& range = ranges[thread_idx];
+    std::lock_guard<std::mutex> guard{range.lock};
+    if (range.begin == range.end) {
+      return false;
+    }
+    idx = range.begin++;
+    return true;
+  };
+
+  // Move the second half of the range of another thread in the (empty)
+  // range owned by the thread. The ranges are only refilled by their owner
+  // so that once all the other ranges have been found empty, there is
+  // nothing left to steal.
+  auto&& steal = [&ranges, nb_threads] (size_t thread_idx) {
+    for (size_t i = 1; i < nb_threads; ++i) {
+      range_t& victim = ranges[(thread_idx + i) % nb_threads];
+      size_t begin = 0;
+      size_t end   = 0;
+      {
+        std::lock_guard<std::mutex> guard{victim.lock};
+        const size_t remaining = victim.end - victim.begin;
+        if (remaining == 0) {
+          continue;
+        }
+        begin = victim.end - (remaining + 1) / 2;
+        end   = victim.end;
+        victim.end = begin;
+      }
+      range_t& range = ranges[thread_idx];
+      std::lock_guard<std::mutex> guard{range.lock};
+      range.begin = begin;
+      range.end   = end;
+      return true;
+    }
+    return false;
+  };
+
+  auto&& worker = [&pop, &steal, &fn] (size_t thread_idx) {
+    size_t idx = 0;
+    do {
+      while (pop(thread_idx, idx)) {
+        fn(idx, thread_idx);
+      }
+    } while (steal(thread_idx));
+  };
+
+  std::vector<std::future<void>> jobs;
+  jobs.reserve(nb_threads - 1);
+  for (size_t i = 1; i < nb_threads; ++i) {
+    jobs.push_back(std::async(std::launch::async, worker, i));
+  }
+
+  std::exception_ptr error;
+  try {
+    worker(0);
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  for (std::future<void>& job : jobs) {
+    try {
+      job.get();
+    } catch (...) {
+      if (not error) {
+        error = std::current_exception();
+      }
+    }
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}
+#endif
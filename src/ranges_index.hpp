@@ -0,0 +1,100 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_RANGES_INDEX_H_
+#define LIEF_RANGES_INDEX_H_
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+namespace LIEF {
+
+//! Ranges [start, end) sorted by their start and used to find the ranges
+//! that contain a value in O(log n).
+//!
+//! Ranges can overlap (e.g. an ELF PT_LOAD and PT_DYNAMIC) so each entry also
+//! records the highest end seen so far which bounds the backward scan of find()
+class RangesIndex {
+  public:
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+  void add(uint64_t start, uint64_t size, size_t idx) {
+    const uint64_t end = start + size;
+    // Empty and wrapping ranges can't contain any value
+    if (end <= start) {
+      return;
+    }
+    this->ranges_.push_back({start, end, 0, idx});
+  }
+
+  void clear() {
+    this->ranges_.clear();
+  }
+
+  //! Must be called once all the ranges are added
+  void finalize() {
+    std::sort(std::begin(this->ranges_), std::end(this->ranges_),
+        [] (const range_t& lhs, const range_t& rhs) {
+          return lhs.start < rhs.start or (lhs.start == rhs.start and lhs.idx < rhs.idx);
+        });
+
+    uint64_t max_end = 0;
+    for (range_t& r : this->ranges_) {
+      max_end   = std::max(max_end, r.end);
+      r.max_end = max_end;
+    }
+  }
+
+  //! Return the lowest index of the ranges that contain `value` and that
+  //! are accepted by the predicate, or RangesIndex::npos.
+  //!
+  //! Returning the lowest index keeps the result identical to a linear
+  //! std::find_if over the original container.
+  template<class F>
+  size_t find(uint64_t value, F&& accept) const {
+    auto it = std::upper_bound(std::begin(this->ranges_), std::end(this->ranges_), value,
+        [] (uint64_t v, const range_t& r) {
+          return v < r.start;
+        });
+
+    size_t best = npos;
+    while (it != std::begin(this->ranges_)) {
+      --it;
+      if (it->max_end <= value) {
+        break;
+      }
+      if (it->end > value and it->idx < best and accept(it->idx)) {
+        best = it->idx;
+      }
+    }
+    return best;
+  }
+
+  size_t find(uint64_t value) const {
+    return this->find(value, [] (size_t) { return true; });
+  }
+
+  private:
+  struct range_t {
+    uint64_t start;
+    uint64_t end;
+    uint64_t max_end;
+    size_t   idx;
+  };
+  std::vector<range_t> ranges_;
+};
+
+}
+#endif
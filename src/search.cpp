@@ -0,0 +1,248 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+
+#include <limits>
+#include <string>
+
+#include "LIEF/exception.hpp"
+
+#include "search.hpp"
+
+namespace LIEF {
+
+constexpr size_t   PatternsSearch::npos;
+constexpr uint32_t PatternsSearch::MAX_DENSE_STATES;
+constexpr uint32_t PatternsSearch::MATCH;
+
+std::vector<uint8_t> integer_pattern(uint64_t integer, size_t size) {
+  if (size > sizeof(integer)) {
+    throw std::runtime_error("Invalid size (" + std::to_string(size) + ")");
+  }
+
+  size_t minimal_size = size;
+  if (size == 0) {
+    if (integer < std::numeric_limits<uint8_t>::max()) {
+      minimal_size = sizeof(uint8_t);
+    }
+    else if (integer < std::numeric_limits<uint16_t>::max()) {
+      minimal_size = sizeof(uint16_t);
+    }
+    else if (integer < std::numeric_limits<uint32_t>::max()) {
+      minimal_size = sizeof(uint32_t);
+    }
+    else if (integer < std::numeric_limits<uint64_t>::max()) {
+      minimal_size = sizeof(uint64_t);
+    } else {
+      throw exception("Unable to find an appropriated type of " + std::to_string(integer));
+    }
+  }
+
+  std::vector<uint8_t> pattern(minimal_size, 0);
+  std::copy(
+      reinterpret_cast<const uint8_t*>(&integer),
+      reinterpret_cast<const uint8_t*>(&integer) + minimal_size,
+      pattern.data());
+  return pattern;
+}
+
+size_t find_pattern(const uint8_t* data, size_t size,
+                    const uint8_t* pattern, size_t pattern_size, size_t pos) {
+  if (pos > size or (size - pos) < pattern_size) {
+    return PatternsSearch::npos;
+  }
+
+  if (pattern_size == 0) {
+    return pos;
+  }
+
+  const uint8_t* it   = data + pos;
+  const uint8_t* last = data + size - pattern_size + 1;
+  while (it < last) {
+    it = static_cast<const uint8_t*>(std::memchr(it, pattern[0], last - it));
+    if (it == nullptr) {
+      break;
+    }
+    if (std::memcmp(it + 1, pattern + 1, pattern_size - 1) == 0) {
+      return it - data;
+    }
+    ++it;
+  }
+  return PatternsSearch::npos;
+}
+
+std::vector<size_t> find_all_pattern(const uint8_t* data, size_t size,
+                                     const uint8_t* pattern, size_t pattern_size) {
+  std::vector<size_t> result;
+  if (pattern_size == 0) {
+    return result;
+  }
+
+  size_t pos = find_pattern(data, size, pattern, pattern_size, 0);
+  while (pos != PatternsSearch::npos) {
+    result.push_back(pos);
+    pos = find_pattern(data, size, pattern, pattern_size, pos + 1);
+  }
+  return result;
+}
+
+
+PatternsSearch::PatternsSearch(const std::vector<std::vector<uint8_t>>& patterns) {
+  // Trie of the patterns
+  std::vector<std::vector<Edge>> children(1);
+  std::vector<std::vector<uint32_t>> outputs(1);
+
+  this->sizes_.reserve(patterns.size());
+  for (size_t idx = 0; idx < patterns.size(); ++idx) {
+    const std::vector<uint8_t>& pattern = patterns[idx];
+    this->sizes_.push_back(pattern.size());
+    if (pattern.empty()) {
+      continue;
+    }
+
+    uint32_t state = 0;
+    for (uint8_t byte : pattern) {
+      auto it = std::find_if(std::begin(children[state]), std::end(children[state]),
+                             [byte] (const Edge& e) { return e.byte == byte; });
+      if (it != std::end(children[state])) {
+        state = it->target;
+        continue;
+      }
+      const uint32_t target = static_cast<uint32_t>(children.size());
+      children[state].push_back({byte, target});
+      children.emplace_back();
+      outputs.emplace_back();
+      state = target;
+    }
+    outputs[state].push_back(static_cast<uint32_t>(idx));
+  }
+
+  // Renumber the states in breadth-first order: the failure state of
+  // a node is shallower, hence it is processed before the node itself
+  const size_t nb_states = children.size();
+  std::vector<uint32_t> order;
+  std::vector<uint32_t> ids(nb_states);
+  order.reserve(nb_states);
+  order.push_back(0);
+  for (size_t i = 0; i < order.size(); ++i) {
+    std::vector<Edge>& edges = children[order[i]];
+    std::sort(std::begin(edges), std::end(edges),
+              [] (const Edge& lhs, const Edge& rhs) { return lhs.byte < rhs.byte; });
+    for (const Edge& e : edges) {
+      ids[e.target] = static_cast<uint32_t>(order.size());
+      order.push_back(e.target);
+    }
+  }
+
+  this->states_.resize(nb_states);
+  for (size_t i = 0; i < nb_states; ++i) {
+    const uint32_t old_id = order[i];
+    State& state = this->states_[i];
+
+    state.edges_begin = static_cast<uint32_t>(this->edges_.size());
+    for (const Edge& e : children[old_id]) {
+      this->edges_.push_back({e.byte, ids[e.target]});
+    }
+    state.edges_end = static_cast<uint32_t>(this->edges_.size());
+
+    state.outputs_begin = static_cast<uint32_t>(this->outputs_.size());
+    this->outputs_.insert(std::end(this->outputs_), std::begin(outputs[old_id]), std::end(outputs[old_id]));
+    state.outputs_end = static_cast<uint32_t>(this->outputs_.size());
+    state.has_output  = not outputs[old_id].empty();
+  }
+
+  // Failure and output links
+  for (uint32_t i = 0; i < nb_states; ++i) {
+    const State& state = this->states_[i];
+    for (uint32_t e = state.edges_begin; e < state.edges_end; ++e) {
+      const Edge& edge = this->edges_[e];
+      State& child = this->states_[edge.target];
+      if (i != 0) {
+        uint32_t fail = state.fail;
+        uint32_t target = this->edge(fail, edge.byte);
+        while (target == 0 and fail != 0) {
+          fail   = this->states_[fail].fail;
+          target = this->edge(fail, edge.byte);
+        }
+        child.fail = target;
+      }
+      const State& fail = this->states_[child.fail];
+      child.output = fail.has_output ? child.fail : fail.output;
+    }
+  }
+
+  // Tag the transitions which end a pattern
+  auto tag = [this] (uint32_t target) {
+    const State& state = this->states_[target];
+    return (state.has_output or state.output != 0) ? (target | MATCH) : target;
+  };
+
+  for (Edge& edge : this->edges_) {
+    edge.target = tag(edge.target);
+  }
+
+  // Dense transitions of the shallowest states
+  this->nb_dense_ = static_cast<uint32_t>(std::min<size_t>(nb_states, MAX_DENSE_STATES));
+  this->dense_.resize(this->nb_dense_ * 256);
+  for (uint32_t i = 0; i < this->nb_dense_; ++i) {
+    const State& state = this->states_[i];
+    uint32_t* transitions = this->dense_.data() + i * 256;
+    if (i != 0) {
+      const uint32_t* fail = this->dense_.data() + state.fail * 256;
+      std::copy(fail, fail + 256, transitions);
+    }
+    for (uint32_t e = state.edges_begin; e < state.edges_end; ++e) {
+      transitions[this->edges_[e].byte] = this->edges_[e].target;
+    }
+  }
+}
+
+
+uint32_t PatternsSearch::edge(uint32_t state, uint8_t byte) const {
+  const State& s = this->states_[state];
+  const Edge* first = this->edges_.data() + s.edges_begin;
+  const Edge* last  = this->edges_.data() + s.edges_end;
+
+  // Most of the states have a few transitions
+  if (last - first <= 8) {
+    for (; first < last; ++first) {
+      if (first->byte == byte) {
+        return first->target;
+      }
+    }
+    return 0;
+  }
+
+  const Edge* it = std::lower_bound(first, last, byte,
+      [] (const Edge& e, uint8_t b) { return e.byte < b; });
+  if (it != last and it->byte == byte) {
+    return it->target;
+  }
+  return 0;
+}
+
+
+std::vector<std::vector<size_t>> PatternsSearch::search_all(const uint8_t* data, size_t size) const {
+  std::vector<std::vector<size_t>> result(this->sizes_.size());
+  this->search(data, size,
+      [&result] (uint32_t idx, size_t offset) {
+        result[idx].push_back(offset);
+      });
+  return result;
+}
+
+}
@@ -0,0 +1,127 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_SEARCH_H_
+#define LIEF_SEARCH_H_
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace LIEF {
+
+//! Return the bytes of ``integer`` (in the host's endianness) on ``size`` bytes.
+//! If ``size`` is 0, the smallest integer type that can hold the value is used
+std::vector<uint8_t> integer_pattern(uint64_t integer, size_t size);
+
+//! Return the offset of the first occurrence of ``pattern`` in ``data``
+//! starting from ``pos`` or ``npos`` if not found.
+//!
+//! The candidates are located with ``memchr`` on the first byte of the pattern
+//! (vectorized by the libc) and then compared with ``memcmp``.
+size_t find_pattern(const uint8_t* data, size_t size,
+                    const uint8_t* pattern, size_t pattern_size, size_t pos = 0);
+
+//! Return the offsets of all the (possibly overlapping) occurrences of ``pattern``
+std::vector<size_t> find_all_pattern(const uint8_t* data, size_t size,
+                                     const uint8_t* pattern, size_t pattern_size);
+
+//! Aho-Corasick automaton which finds all the occurrences of a set of
+//! patterns in a single pass over the data.
+//!
+//! The states are numbered in breadth-first order. The transitions of the
+//! first (shallowest) states are resolved in a dense table so that scanning
+//! data which doesn't match only hits this table. The deeper states use a
+//! sorted array of transitions and the failure links, which keeps the memory
+//! linear in the total size of the patterns (e.g. thousands of addresses).
+class PatternsSearch {
+  public:
+  static constexpr size_t npos = -1;
+
+  //! Maximum number of states whose transitions are stored in the dense table
+  static constexpr uint32_t MAX_DENSE_STATES = 1024;
+
+  //! Build the automaton. Empty patterns never match
+  PatternsSearch(const std::vector<std::vector<uint8_t>>& patterns);
+
+  //! Call ``callback(pattern_idx, offset)`` for each occurrence found in ``data``
+  //! where ``pattern_idx`` is the index of the pattern given to the constructor
+  template<class F>
+  void search(const uint8_t* data, size_t size, F&& callback) const {
+    uint32_t state = 0;
+    for (size_t i = 0; i < size; ++i) {
+      const uint32_t value = this->next(state, data[i]);
+      state = value & ~MATCH;
+      if ((value & MATCH) == 0) {
+        continue;
+      }
+      for (uint32_t s = this->states_[state].has_output ? state : this->states_[state].output;
+           s != 0; s = this->states_[s].output) {
+        const State& matched = this->states_[s];
+        for (uint32_t o = matched.outputs_begin; o < matched.outputs_end; ++o) {
+          const uint32_t idx = this->outputs_[o];
+          callback(idx, i + 1 - this->sizes_[idx]);
+        }
+      }
+    }
+  }
+
+  //! Return the offsets of the occurrences for each pattern
+  std::vector<std::vector<size_t>> search_all(const uint8_t* data, size_t size) const;
+
+  private:
+  //! Flag set on a transition whose target ends (at least) one pattern
+  static constexpr uint32_t MATCH = 1u << 31;
+
+  struct State {
+    uint32_t fail = 0;
+    //! Closest state on the failure chain which ends a pattern (0 if none)
+    uint32_t output = 0;
+    uint32_t edges_begin = 0;
+    uint32_t edges_end = 0;
+    uint32_t outputs_begin = 0;
+    uint32_t outputs_end = 0;
+    bool has_output = false;
+  };
+
+  struct Edge {
+    uint8_t byte;
+    uint32_t target;
+  };
+
+  //! Transition from ``state`` with ``byte``, without the failure links (0 if none)
+  uint32_t edge(uint32_t state, uint8_t byte) const;
+
+  //! Transition from ``state`` with ``byte``. The result is tagged with MATCH
+  inline uint32_t next(uint32_t state, uint8_t byte) const {
+    while (state >= this->nb_dense_) {
+      const uint32_t target = this->edge(state, byte);
+      if (target != 0) {
+        return target;
+      }
+      state = this->states_[state].fail;
+    }
+    return this->dense_[state * 256 + byte];
+  }
+
+  std::vector<State> states_;
+  std::vector<Edge> edges_;
+  std::vector<uint32_t> outputs_;
+  std::vector<size_t> sizes_;
+  std::vector<uint32_t> dense_;
+  uint32_t nb_dense_ = 0;
+};
+
+}
+#endif
@@ -0,0 +1,51 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_STRING_POOL_H_
+#define LIEF_STRING_POOL_H_
+#include <string>
+#include <unordered_set>
+
+namespace LIEF {
+
+//! Pool of interned strings
+//!
+//! Each distinct string is stored once and intern() returns the same address for
+//! equal strings. The addresses are stable until the pool is destroyed: the
+//! strings are never removed, even if no object references them anymore.
+//!
+//! It is used by the binaries to share the names that appear in several tables
+//! (e.g. the symbols of ``.dynsym`` that are also in ``.symtab``).
+class StringPool {
+  public:
+  StringPool() = default;
+  StringPool(const StringPool&) = delete;
+  StringPool& operator=(const StringPool&) = delete;
+
+  const std::string* intern(std::string str) {
+    return &*this->strings_.insert(std::move(str)).first;
+  }
+
+  //! Number of distinct strings
+  size_t size() const {
+    return this->strings_.size();
+  }
+
+  private:
+  std::unordered_set<std::string> strings_;
+};
+
+}
+#endif
@@ -0,0 +1,139 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <numeric>
+#include <utility>
+
+#include "string_table.hpp"
+
+namespace LIEF {
+
+void StringTableBuilder::reserve(size_t nb_strings) {
+  this->strings_.reserve(nb_strings);
+}
+
+size_t StringTableBuilder::add(const std::string& str) {
+  this->strings_.push_back({str.data(), str.size()});
+  return this->strings_.size() - 1;
+}
+
+int StringTableBuilder::char_tail_at(uint32_t idx, size_t pos) const {
+  const string_ref_t& str = this->strings_[idx];
+  if (pos >= str.size) {
+    return -1;
+  }
+  return static_cast<unsigned char>(str.data[str.size - pos - 1]);
+}
+
+void StringTableBuilder::multikey_sort(uint32_t* first, uint32_t* last, size_t pos) const {
+  // Sort the strings on their reversed content in decreasing order so that a
+  // string comes right after the strings it is a suffix of.
+  //
+  // The largest partition is handled by the loop and the two other ones by
+  // recursive calls: they hold at most half of the strings so that the
+  // depth of the recursion is bounded by log2(n)
+  struct range_t {
+    uint32_t* first;
+    uint32_t* last;
+    size_t pos;
+  };
+
+  while ((last - first) > 1) {
+    // Median of the first, middle and last characters
+    int lo  = this->char_tail_at(*first, pos);
+    int mid = this->char_tail_at(first[(last - first) / 2], pos);
+    int hi  = this->char_tail_at(*(last - 1), pos);
+    if (lo > mid) std::swap(lo, mid);
+    if (mid > hi) std::swap(mid, hi);
+    if (lo > mid) std::swap(lo, mid);
+    const int pivot = mid;
+
+    // Partition in [first, lt) > pivot, [lt, gt) == pivot, [gt, last) < pivot
+    uint32_t* lt = first;
+    uint32_t* gt = last;
+    for (uint32_t* it = first; it < gt;) {
+      const int c = this->char_tail_at(*it, pos);
+      if (c > pivot) {
+        std::swap(*lt++, *it++);
+      } else if (c < pivot) {
+        std::swap(*--gt, *it);
+      } else {
+        ++it;
+      }
+    }
+
+    // The strings equal to the pivot share the same suffix: compare the next
+    // character unless they are all complete (-1)
+    range_t ranges[3] = {
+      {first, lt, pos},
+      {lt, pivot == -1 ? lt : gt, pos + 1},
+      {gt, last, pos},
+    };
+
+    size_t largest = 0;
+    for (size_t i = 1; i < 3; ++i) {
+      if ((ranges[i].last - ranges[i].first) > (ranges[largest].last - ranges[largest].first)) {
+        largest = i;
+      }
+    }
+    for (size_t i = 0; i < 3; ++i) {
+      if (i != largest) {
+        this->multikey_sort(ranges[i].first, ranges[i].last, ranges[i].pos);
+      }
+    }
+    first = ranges[largest].first;
+    last  = ranges[largest].last;
+    pos   = ranges[largest].pos;
+  }
+}
+
+void StringTableBuilder::build() {
+  std::vector<uint32_t> sorted(this->strings_.size());
+  std::iota(std::begin(sorted), std::end(sorted), 0);
+  this->multikey_sort(sorted.data(), sorted.data() + sorted.size(), 0);
+
+  size_t total_size = 1;
+  for (const string_ref_t& str : this->strings_) {
+    total_size += str.size + 1;
+  }
+
+  this->offsets_.assign(this->strings_.size(), 0);
+  this->raw_.clear();
+  this->raw_.reserve(total_size);
+  this->raw_.push_back(0);
+
+  const string_ref_t* previous = nullptr;
+  for (uint32_t idx : sorted) {
+    const string_ref_t& str = this->strings_[idx];
+    if (str.size == 0) {
+      continue;
+    }
+
+    // The previous string ends with this one: point into its tail
+    if (previous != nullptr and previous->size >= str.size and
+        std::equal(str.data, str.data + str.size, previous->data + previous->size - str.size))
+    {
+      this->offsets_[idx] = this->raw_.size() - str.size - 1;
+      continue;
+    }
+
+    this->offsets_[idx] = this->raw_.size();
+    this->raw_.insert(std::end(this->raw_), str.data, str.data + str.size);
+    this->raw_.push_back(0);
+    previous = &str;
+  }
+}
+
+}
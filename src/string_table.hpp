@@ -0,0 +1,77 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_STRING_TABLE_H_
+#define LIEF_STRING_TABLE_H_
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LIEF {
+
+//! Builder of the string tables used by the ELF and the MachO formats
+//! (``.strtab``, ``.dynstr``, ``.shstrtab``, ``LC_SYMTAB`` strings, ...).
+//!
+//! A string which is a suffix of another one is merged into it
+//! (tail merging): ``foo`` is stored as the end of ``barfoo``.
+//! The suffixes are grouped with a multikey quicksort on the reversed
+//! strings, so that the table is built in ``O(n log n + total length)``.
+//!
+//! The strings are referenced (not copied) and must outlive the builder.
+class StringTableBuilder {
+  public:
+  StringTableBuilder() = default;
+
+  void reserve(size_t nb_strings);
+
+  //! Add a string to the table and return its index in offsets()
+  size_t add(const std::string& str);
+
+  //! Build the table once all the strings have been added
+  void build();
+
+  //! Null-terminated strings of the table. It starts with a null byte so
+  //! that the offset of the empty string is 0
+  const std::vector<uint8_t>& raw() const {
+    return this->raw_;
+  }
+
+  std::vector<uint8_t>& raw() {
+    return this->raw_;
+  }
+
+  //! Offsets of the strings in raw() in the order of add()
+  const std::vector<size_t>& offsets() const {
+    return this->offsets_;
+  }
+
+  private:
+  // std::string_view is not available in C++11
+  struct string_ref_t {
+    const char* data;
+    size_t size;
+  };
+
+  //! Character at ``pos`` from the end of the string or -1 past its beginning
+  int char_tail_at(uint32_t idx, size_t pos) const;
+  void multikey_sort(uint32_t* first, uint32_t* last, size_t pos) const;
+
+  std::vector<string_ref_t> strings_;
+  std::vector<uint8_t> raw_;
+  std::vector<size_t> offsets_;
+};
+
+}
+#endif
@@ -0,0 +1,147 @@
+/* Copyright 2017 - 2021 R. Thomas
+ * Copyright 2017 - 2021 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_SYMBOLS_INDEX_H_
+#define LIEF_SYMBOLS_INDEX_H_
+#include <vector>
+#include <string>
+#include <atomic>
+#include <algorithm>
+#include <unordered_map>
+
+#include "index_tracker.hpp"
+
+namespace LIEF {
+
+//! Name -> Symbol index over a symbol table (i.e. `std::vector<SYM*>`)
+//!
+//! When several symbols share the same name, the index references the first
+//! one in the table so that a lookup returns the same symbol as a linear
+//! search over the table.
+//!
+//! The owner is in charge of calling add() / remove() when the table is
+//! modified. The indexed symbols keep a pointer to the IndexTracker of the
+//! binary: a rename through LIEF::Symbol::name(const std::string&) flags the
+//! index which is rebuilt by the next lookup.
+//!
+//! ``dependents`` are the other kinds that are flagged along with the index
+//! when a symbol is added, removed or renamed (e.g. IndexTracker::DYNAMIC_HASH).
+template<class SYM>
+class SymbolsIndex {
+  public:
+  using symbols_t = std::vector<SYM*>;
+
+  SymbolsIndex(IndexTracker& tracker, IndexTracker::KIND kind, const symbols_t& symbols,
+               uint32_t dependents = 0) :
+    tracker_{tracker},
+    kind_{kind},
+    dependents_{dependents},
+    symbols_{symbols}
+  {}
+
+  //! Return the first symbol of the table named ``name`` or a nullptr
+  SYM* find(const std::string& name) {
+    this->refresh();
+    auto it = this->index_.find(name);
+    if (it != std::end(this->index_) and name_of(*it->second) != name) {
+      // The symbol has been renamed through the deprecated `std::string& name()`
+      this->tracker_.changed(this->kind_ | this->dependents_);
+      this->refresh();
+      it = this->index_.find(name);
+    }
+    if (it == std::end(this->index_)) {
+      return nullptr;
+    }
+    return it->second;
+  }
+
+  //! Must be called **after** the symbol is appended to the table
+  void add(SYM& sym) {
+    this->tracker_.changed(this->dependents_);
+    this->track(sym);
+    this->index_.emplace(name_of(sym), &sym);
+    this->nb_symbols_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  //! Must be called **after** the symbol is removed from the table and
+  //! **before** it is deleted.
+  void remove(const SYM& sym, const symbols_t& symbols) {
+    this->tracker_.changed(this->dependents_);
+    this->nb_symbols_.fetch_sub(1, std::memory_order_relaxed);
+    const std::string& name = sym.name();
+    auto it = this->index_.find(name);
+    if (it == std::end(this->index_) or it->second != &sym) {
+      // Either a previous symbol has the same name or the symbol has been
+      // renamed without going through the setter. The index could still
+      // reference it so it must be rebuilt.
+      this->tracker_.changed(this->kind_);
+      return;
+    }
+
+    // Promote the next symbol with the same name (if any)
+    const auto it_next = std::find_if(std::begin(symbols), std::end(symbols),
+        [&name] (const SYM* s) {
+          return s != nullptr and name_of(*s) == name;
+        });
+
+    if (it_next != std::end(symbols)) {
+      it->second = *it_next;
+    } else {
+      this->index_.erase(it);
+    }
+  }
+
+  //! Rebuild the index if it is stale. The symbols are only tracked once they
+  //! have been indexed.
+  void refresh() {
+    if (this->nb_symbols_.load(std::memory_order_relaxed) != this->symbols_.size()) {
+      this->tracker_.changed(this->kind_);
+    }
+    this->tracker_.refresh(this->kind_, [this] (uint32_t) { this->update(); });
+  }
+
+  private:
+  //! The mutable accessor of the name would copy an interned name
+  static const std::string& name_of(const SYM& sym) {
+    return sym.name();
+  }
+
+  void update() {
+    this->index_.clear();
+    this->index_.reserve(this->symbols_.size());
+    for (SYM* sym : this->symbols_) {
+      if (sym != nullptr) {
+        this->track(*sym);
+        this->index_.emplace(name_of(*sym), sym);
+      }
+    }
+    this->nb_symbols_.store(this->symbols_.size(), std::memory_order_relaxed);
+  }
+
+  void track(SYM& sym) {
+    sym.index_tracker_ = &this->tracker_;
+    sym.index_kind_    = this->kind_ | this->dependents_;
+  }
+
+  IndexTracker&          tracker_;
+  IndexTracker::KIND     kind_;
+  uint32_t               dependents_;
+  const symbols_t&       symbols_;
+  std::atomic<size_t>    nb_symbols_{0};
+  std::unordered_map<std::string, SYM*> index_;
+};
+
+}
+#endif
@@ -1,4 +1,8 @@
 #!/usr/bin/env python
+import collections
+import concurrent.futures
+import math
+import mmap
 import unittest
 import lief
 import tempfile
@@ -8,6 +12,7 @@ import stat
 import os
 import logging
 import random
+import re
 
 from subprocess import Popen
 
@@ -112,6 +117,178 @@ class TestAbstract(TestCase):
     #    self.assertTrue(isinstance(binary, lief.PE.Binary))
 
 
+    def test_search(self):
+        for path in ('ELF/ELF64_x86-64_binary_ls.bin',
+                     'MachO/MachO64_x86-64_binary_id.bin',
+                     'PE/PE64_x86-64_binary_ConsoleApplication1.exe'):
+            binary  = TestAbstract.get_abstract_binary(lief.parse(get_sample(path)))
+            section = max(binary.sections, key=lambda s: s.size)
+            content = bytes(section.content)
+
+            patterns = [list(content[i:i + 4]) for i in range(0, len(content) - 4, len(content) // 16)]
+            patterns.append([0xde, 0xad, 0xbe, 0xef, 0xca, 0xfe])
+            found = section.search_patterns(patterns)
+            self.assertEqual(len(found), len(patterns))
+            for pattern, offsets in zip(patterns, found):
+                raw = bytes(pattern)
+                expected = [i for i in range(len(content)) if content.startswith(raw, i)]
+                self.assertEqual(sorted(offsets), expected)
+
+            self.assertEqual(section.search_all("\x00\x00"),
+                             [i for i in range(len(content)) if content.startswith(b"\x00\x00", i)])
+
+    @staticmethod
+    def entropy(data):
+        if len(data) == 0:
+            return 0.0
+        freq = collections.Counter(data)
+        return -sum(c / len(data) * math.log2(c / len(data)) for c in freq.values())
+
+    def test_entropy(self):
+        binary = lief.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin'))
+        for section in binary.sections:
+            content = bytes(section.content)
+            self.assertAlmostEqual(section.entropy, TestAbstract.entropy(content))
+
+        for segment in binary.segments:
+            content = bytes(segment.content)
+            self.assertAlmostEqual(segment.entropy, TestAbstract.entropy(content))
+
+        text    = binary.get_section(".text")
+        content = bytes(text.content)
+        for window, stride in ((4096, 4096), (4096, 1024), (512, 100), (1 << 30, 1)):
+            profile  = text.entropy_profile(window, stride)
+            expected = [TestAbstract.entropy(content[i:i + window])
+                        for i in range(0, max(len(content) - window, 0) + 1, stride)]
+            self.assertEqual(len(profile), len(expected))
+            for value, ref in zip(profile, expected):
+                self.assertAlmostEqual(value, ref)
+
+        with open(get_sample('ELF/ELF64_x86-64_binary_ls.bin'), "rb") as f:
+            raw = f.read()
+        self.assertAlmostEqual(lief.entropy(raw), TestAbstract.entropy(raw))
+        self.assertAlmostEqual(lief.entropy(list(raw[:100])), TestAbstract.entropy(raw[:100]))
+        self.assertEqual(lief.entropy_profile(raw, 1024, 1024)[1], lief.entropy(raw[1024:2048]))
+        self.assertAlmostEqual(lief.entropy(memoryview(raw)[::2]), TestAbstract.entropy(raw[::2]))
+        self.assertEqual(lief.entropy_profile(memoryview(raw)[::2], 1024, 1024), lief.entropy_profile(raw[::2], 1024, 1024))
+
+    def test_xrefs(self):
+        binary    = TestAbstract.get_abstract_binary(lief.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin')))
+        addresses = [binary.entrypoint] + [s.virtual_address for s in binary.sections if s.virtual_address > 0]
+        xrefs     = binary.xrefs(addresses)
+        self.assertEqual(len(xrefs), len(addresses))
+        for address, refs in zip(addresses, xrefs):
+            self.assertEqual(sorted(refs), sorted(binary.xref(address)))
+
+    def test_memoryview(self):
+        path = get_sample('ELF/ELF64_x86-64_binary_ls.bin')
+        with open(path, "rb") as f:
+            raw = f.read()
+
+        binary = lief.parse(path)
+        text   = binary.get_section(".text")
+        view   = text.content_view
+        code   = raw[text.offset:text.offset + text.size]
+        self.assertIsInstance(text.content, list)
+        self.assertEqual(bytes(text.content), code)
+        self.assertIsInstance(view, memoryview)
+        self.assertTrue(view.readonly)
+        self.assertEqual(bytes(view), code)
+        with self.assertRaises(TypeError):
+            view[0] = 0
+
+        segment = binary.segments[0]
+        self.assertEqual(bytes(segment.content_view), raw[segment.file_offset:segment.file_offset + segment.physical_size])
+        self.assertEqual(bytes(segment.content), bytes(segment.content_view))
+
+        # The view keeps the binary alive
+        del text, segment, binary
+        self.assertEqual(bytes(view), code)
+
+        for data in (raw, bytearray(raw), memoryview(raw)):
+            binary = lief.parse(data)
+            self.assertIsInstance(binary, lief.ELF.Binary)
+            self.assertEqual(bytes(binary.get_section(".text").content_view), code)
+
+        with open(path, "rb") as f, mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as mm:
+            binary = lief.ELF.parse(mm)
+            self.assertEqual(bytes(binary.get_section(".text").content_view), code)
+            del binary
+
+        with open(get_sample('PE/PE64_x86-64_binary_ConsoleApplication1.exe'), "rb") as f:
+            self.assertIsInstance(lief.parse(bytearray(f.read())), lief.PE.Binary)
+
+        # A non-contiguous buffer is parsed from a copy of its bytes
+        doubled = bytes(b for c in raw for b in (c, 0))
+        binary  = lief.parse(memoryview(doubled)[::2])
+        self.assertIsInstance(binary, lief.ELF.Binary)
+        self.assertEqual(bytes(binary.get_section(".text").content_view), code)
+
+    @staticmethod
+    def strings(data, min_size):
+        ascii_re = re.compile(rb"[\x20-\x7e\t]{%d,}" % min_size)
+        utf16_re = re.compile(rb"(?:[\x20-\x7e\t]\x00){%d,}" % min_size)
+        entries  = [(m.start(), lief.StringEntry.ENCODING.ASCII, len(m.group())) for m in ascii_re.finditer(data)]
+        entries += [(m.start(), lief.StringEntry.ENCODING.UTF16_LE, len(m.group()) // 2) for m in utf16_re.finditer(data)]
+        return sorted(entries, key=lambda e: e[0])
+
+    def test_strings(self):
+        with open(get_sample('PE/PE64_x86-64_binary_ConsoleApplication1.exe'), "rb") as f:
+            raw = f.read()
+
+        entries = lief.extract_strings(raw, 5)
+        self.assertEqual([(e.offset, e.encoding, e.length) for e in entries], TestAbstract.strings(raw, 5))
+        self.assertEqual([(e.offset, e.length) for e in lief.extract_strings(memoryview(raw)[::2], 5)],
+                         [(e.offset, e.length) for e in lief.extract_strings(raw[::2], 5)])
+        self.assertTrue(any(e.encoding == lief.StringEntry.ENCODING.UTF16_LE for e in entries))
+        self.assertTrue(all(e.encoding == lief.StringEntry.ENCODING.ASCII for e in lief.extract_strings(raw, utf16=False)))
+
+        for path in ('ELF/ELF64_x86-64_binary_ls.bin', 'PE/PE64_x86-64_binary_ConsoleApplication1.exe'):
+            binary = TestAbstract.get_abstract_binary(lief.parse(get_sample(path)))
+            with open(get_sample(path), "rb") as f:
+                raw = f.read()
+
+            for entry in binary.extract_strings():
+                self.assertTrue(entry.size >= 4)
+                data = raw[entry.offset:entry.offset + entry.size]
+                if entry.encoding == lief.StringEntry.ENCODING.UTF16_LE:
+                    data = data.decode("utf-16-le").encode("ascii")
+                self.assertEqual(len(data), entry.length)
+                self.assertTrue(all(c == 0x09 or 0x20 <= c <= 0x7e for c in data))
+
+    def test_threads(self):
+        samples = [get_sample(s) for s in ('ELF/ELF64_x86-64_binary_ls.bin',
+                                           'ELF/ELF32_ARM_binary-pie_ls.bin',
+                                           'MachO/MachO64_x86-64_binary_id.bin',
+                                           'PE/PE64_x86-64_binary_ConsoleApplication1.exe',
+                                           'PE/PE32_x86_binary_cmd.exe')] * 4
+
+        def summary(path):
+            binary = TestAbstract.get_abstract_binary(lief.parse(path))
+            return (binary.format, binary.entrypoint, len(binary.sections), len(binary.symbols))
+
+        expected = [summary(path) for path in samples]
+        with concurrent.futures.ThreadPoolExecutor(max_workers=4) as pool:
+            self.assertEqual(list(pool.map(summary, samples)), expected)
+
+        results = {}
+        def callback(idx, path, binary, error, duration):
+            self.assertEqual(path, samples[idx])
+            self.assertEqual(error, "")
+            self.assertTrue(duration >= 0)
+            binary = TestAbstract.get_abstract_binary(binary)
+            results[idx] = (binary.format, binary.entrypoint)
+
+        lief.parse_many(samples, callback, threads=4)
+        self.assertEqual([results[i] for i in range(len(samples))], [e[:2] for e in expected])
+
+        def failing(idx, path, binary, error, duration):
+            raise ValueError(path)
+
+        with self.assertRaises(ValueError):
+            lief.parse_many(samples, failing, threads=4)
+
+
 if __name__ == '__main__':
 
     root_logger = logging.getLogger()
@@ -160,6 +160,20 @@ class TestELF(TestCase):
         self.assertTrue(all(s in symbols for s in dynamic_symbols))
         self.assertTrue(all(s in symbols for s in static_symbols))
 
+    def test_symbols_rename(self):
+        ls = lief.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin'))
+
+        symbol = ls.dynamic_symbols[-1]
+        name   = symbol.name
+        self.assertTrue(ls.has_dynamic_symbol(name))
+
+        symbol.name = "lief_renamed"
+        self.assertFalse(ls.has_dynamic_symbol(name))
+        self.assertEqual(ls.get_dynamic_symbol("lief_renamed").value, symbol.value)
+
+        ls.remove_dynamic_symbol("lief_renamed")
+        self.assertFalse(ls.has_dynamic_symbol("lief_renamed"))
+
     def test_relocation_size(self):
         aarch64_toybox = lief.parse(get_sample('ELF/ELF64_AARCH64_piebinary_toybox.pie'))
         arm_ls         = lief.parse(get_sample('ELF/ELF32_ARM_binary_ls.bin'))
@@ -41,6 +41,215 @@ class TestBuilder(TestCase):
     def test_gcc(self):
         binall = lief.parse(get_sample('ELF/ELF32_x86_binary_gcc.bin'))
 
+    def test_unmodified(self):
+        path   = get_sample('ELF/ELF64_x86-64_binary_ls.bin')
+        binary = lief.ELF.parse(path)
+        text   = binary.get_section(".text")
+        binary.patch_address(text.virtual_address, [0xcc])
+
+        builder = lief.ELF.Builder(binary)
+        builder.build()
+        rebuilt = lief.ELF.parse(builder.get_build(), "rebuilt")
+
+        original = lief.ELF.parse(path)
+        self.assertEqual(rebuilt.get_content_from_virtual_address(text.virtual_address, 1), [0xcc])
+        self.assertEqual([s.name for s in rebuilt.dynamic_symbols], [s.name for s in original.dynamic_symbols])
+        self.assertEqual(len(rebuilt.relocations), len(original.relocations))
+        self.assertEqual(rebuilt.get_section(".dynstr").content, original.get_section(".dynstr").content)
+
+    def test_modified_symbol(self):
+        binary = lief.ELF.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin'))
+        symbol = binary.dynamic_symbols[1]
+        symbol.name = "lief_renamed"
+
+        builder = lief.ELF.Builder(binary)
+        builder.build()
+        rebuilt = lief.ELF.parse(builder.get_build(), "rebuilt")
+        self.assertTrue(rebuilt.has_dynamic_symbol("lief_renamed"))
+
+    def test_threads(self):
+        def build(nb_threads):
+            binary = lief.ELF.parse(get_sample('ELF/ELF64_x86-64_object_builder.o'))
+            # Flag the static symbols and the relocations as modified
+            self.assertGreater(len(binary.static_symbols), 0)
+            self.assertGreater(len(binary.object_relocations), 0)
+            builder = lief.ELF.Builder(binary).threads(nb_threads)
+            builder.build()
+            return builder.get_build()
+
+        self.assertEqual(build(1), build(4))
+
+    def test_strip_object(self):
+        binary  = lief.ELF.parse(get_sample('ELF/ELF64_x86-64_object_builder.o'))
+        symbols = list(binary.static_symbols)
+        names   = [s.name for s in symbols]
+        nb_relocations = len(binary.object_relocations)
+        self.assertTrue(any(r.has_symbol for r in binary.object_relocations))
+
+        binary.strip()
+        self.assertEqual(len(binary.static_symbols), 0)
+
+        # The stripped symbols are still valid but the relocations no longer reference them
+        self.assertEqual([s.name for s in symbols], names)
+        self.assertEqual(len(binary.object_relocations), nb_relocations)
+        self.assertFalse(any(r.has_symbol for r in binary.object_relocations))
+
+        builder = lief.ELF.Builder(binary)
+        builder.build()
+        rebuilt = lief.ELF.parse(builder.get_build(), "rebuilt")
+        self.assertEqual(len(rebuilt.object_relocations), nb_relocations)
+
+    def test_hash_lookup(self):
+        path  = get_sample('ELF/ELF64_x86-64_binary_ls.bin')
+        names = [s.name for s in lief.ELF.parse(path).dynamic_symbols]
+
+        binary = lief.ELF.parse(path)
+        self.assertTrue(binary.use_gnu_hash)
+        symndx = binary.gnu_hash.symbol_index
+
+        for name in names[symndx:]:
+            self.assertEqual(binary.lookup_dynamic_symbol(name).name, name)
+
+        # Like ld.so, the symbols that are not in the GNU hash table are not resolved
+        self.assertIsNone(binary.lookup_dynamic_symbol(names[symndx - 1]))
+        self.assertIsNone(binary.lookup_dynamic_symbol("lief_not_a_symbol"))
+
+        symbols = binary.lookup_dynamic_symbols(names[symndx:] + ["lief_not_a_symbol"])
+        self.assertEqual([s.name for s in symbols[:-1]], names[symndx:])
+        self.assertIsNone(symbols[-1])
+
+    def test_hash_lookup_after_read(self):
+        binary = lief.ELF.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin'))
+        names  = [s.name for s in binary.dynamic_symbols]
+        symndx = binary.gnu_hash.symbol_index
+
+        # Reading (or changing the value of) the symbols keeps the hash table in use
+        binary.get_dynamic_symbol(names[-1]).value += 1
+        self.assertIsNone(binary.lookup_dynamic_symbol(names[symndx - 1]))
+        self.assertEqual(binary.lookup_dynamic_symbol(names[-1]).name, names[-1])
+
+        # A rename makes the parsed table stale: the lookup falls back on the name index
+        # which resolves the same (defined) symbols
+        binary.get_dynamic_symbol(names[-1]).name = "lief_renamed"
+        self.assertEqual(binary.lookup_dynamic_symbol("lief_renamed").name, "lief_renamed")
+        self.assertIsNone(binary.lookup_dynamic_symbol(names[-1]))
+        self.assertIsNone(binary.lookup_dynamic_symbol(names[symndx - 1]))
+        self.assertEqual(binary.lookup_dynamic_symbol(names[symndx]).name, names[symndx])
+
+    def test_hash_lookup_rebuilt(self):
+        binary = lief.ELF.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin'))
+        text   = binary.get_section(".text")
+        binary.add_exported_function(text.virtual_address, "lief_exported")
+
+        # The tables are modified: the lookup falls back on the name index
+        self.assertEqual(binary.lookup_dynamic_symbol("lief_exported").value, text.virtual_address)
+
+        builder = lief.ELF.Builder(binary)
+        builder.build()
+        raw = builder.get_build()
+
+        names   = [s.name for s in lief.ELF.parse(raw, "rebuilt").dynamic_symbols]
+        rebuilt = lief.ELF.parse(raw, "rebuilt")
+        symndx  = rebuilt.gnu_hash.symbol_index
+
+        # Check that the table generated by Builder::build_symbol_gnuhash is consistent
+        self.assertIn("lief_exported", names[symndx:])
+        symbols = rebuilt.lookup_dynamic_symbols(names[symndx:])
+        self.assertEqual([s.name for s in symbols], names[symndx:])
+        self.assertEqual(rebuilt.lookup_dynamic_symbol("lief_exported").value, text.virtual_address)
+
+    def test_in_place(self):
+        sample = get_sample('ELF/ELF64_x86-64_binary_ls.bin')
+        with open(sample, "rb") as f:
+            original = bytearray(f.read())
+
+        with tempfile.NamedTemporaryFile(suffix=".bin", delete=False) as output:
+            output.write(original)
+
+        binary = lief.ELF.parse(output.name)
+        text   = binary.get_section(".text")
+        binary.patch_address(text.virtual_address, [0xcc, 0xcc])
+
+        builder = lief.ELF.Builder(binary)
+        builder.in_place()
+        builder.build()
+        self.assertTrue(builder.is_in_place)
+        self.assertEqual(builder.patches, [(text.file_offset, [0xcc, 0xcc])])
+
+        self.assertTrue(builder.apply_in_place(output.name))
+        original[text.file_offset:text.file_offset + 2] = b"\xcc\xcc"
+        with open(output.name, "rb") as f:
+            self.assertEqual(f.read(), bytes(original))
+        os.remove(output.name)
+
+    def test_in_place_fallback(self):
+        binary = lief.ELF.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin'))
+        binary.add_library("libfoo_in_place.so")
+
+        builder = lief.ELF.Builder(binary)
+        builder.in_place()
+        builder.build()
+        self.assertFalse(builder.is_in_place)
+        self.assertEqual(len(builder.patches), 0)
+        rebuilt = lief.ELF.parse(builder.get_build(), "rebuilt")
+        self.assertTrue(rebuilt.has_library("libfoo_in_place.so"))
+
+    def test_in_place_fallback_mapped(self):
+        with tempfile.NamedTemporaryFile(suffix=".bin", delete=False) as output:
+            with open(get_sample('ELF/ELF64_x86-64_binary_ls.bin'), "rb") as f:
+                output.write(f.read())
+
+        # The binary reads its content from the mapping of output.name
+        binary = lief.ELF.parse(output.name)
+        text   = bytes(binary.get_section(".text").content)
+        binary.add_library("libfoo_in_place.so")
+
+        builder = lief.ELF.Builder(binary)
+        builder.in_place()
+        builder.build()
+        self.assertFalse(builder.is_in_place)
+        self.assertTrue(builder.apply_in_place(output.name))
+
+        # The binary is still valid once its file has been rewritten
+        self.assertEqual(bytes(binary.get_section(".text").content), text)
+        rebuilt = lief.ELF.parse(output.name)
+        self.assertTrue(rebuilt.has_library("libfoo_in_place.so"))
+        os.remove(output.name)
+
+    def test_write_extents(self):
+        sample = get_sample('ELF/ELF64_x86-64_binary_ls.bin')
+        with open(sample, "rb") as f:
+            original = bytearray(f.read())
+
+        def check(builder, expected=None):
+            with tempfile.NamedTemporaryFile(suffix=".bin", delete=False) as output:
+                pass
+            builder.write(output.name)
+            with open(output.name, "rb") as f:
+                written = f.read()
+            os.remove(output.name)
+            self.assertEqual(written, bytes(builder.get_build()))
+            if expected is not None:
+                self.assertEqual(written, bytes(expected))
+
+        # Full rebuild: the unmodified sections are copied from the input file
+        binary = lief.ELF.parse(sample)
+        binary.add_library("libfoo_extents.so")
+        builder = lief.ELF.Builder(binary)
+        builder.build()
+        check(builder)
+
+        # In-place build
+        binary = lief.ELF.parse(sample)
+        text   = binary.get_section(".text")
+        binary.patch_address(text.virtual_address, [0xcc])
+        builder = lief.ELF.Builder(binary)
+        builder.in_place()
+        builder.build()
+        self.assertTrue(builder.is_in_place)
+        original[text.file_offset] = 0xcc
+        check(builder, original)
+
 
 if __name__ == '__main__':
 
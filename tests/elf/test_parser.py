@@ -237,6 +237,74 @@ class TestAllRelocs(TestCase):
         self.assertTrue(relocations[30].has_section)
         self.assertEqual(relocations[30].address,0x2068)
 
+class TestParserConfig(TestCase):
+    def test_quick(self):
+        path   = get_sample('ELF/ELF32_x86_binary_all.bin')
+        full   = lief.ELF.parse(path)
+        config = lief.ELF.ParserConfig.quick
+        quick  = lief.ELF.parse(path, config)
+
+        self.assertEqual(len(quick.sections), len(full.sections))
+        self.assertEqual(len(quick.dynamic_entries), len(full.dynamic_entries))
+
+        # Skipped tables are parsed on their first access
+        self.assertEqual(len(quick.static_symbols), len(full.static_symbols))
+        self.assertEqual(len(quick.relocations), len(full.relocations))
+        self.assertEqual(len(quick.symbols_version), len(full.symbols_version))
+        self.assertEqual(len(quick.notes), len(full.notes))
+
+        address = full.relocations[0].address
+        self.assertEqual(quick.get_relocation(address), full.get_relocation(address))
+
+    def test_quick_modified(self):
+        path  = get_sample('ELF/ELF64_x86-64_binary_all.bin')
+        full  = lief.ELF.parse(path)
+        quick = lief.ELF.parse(path, lief.ELF.ParserConfig.quick)
+
+        # The deferred tables are loaded from the original layout
+        for section in quick.sections:
+            if section.type in (lief.ELF.SECTION_TYPES.SYMTAB, lief.ELF.SECTION_TYPES.RELA):
+                section.offset = 0
+                section.size   = 0
+
+        self.assertEqual(len(quick.static_symbols), len(full.static_symbols))
+        self.assertEqual(len(quick.relocations), len(full.relocations))
+
+    def test_quick_build(self):
+        path  = get_sample('ELF/ELF64_x86-64_binary_all.bin')
+        full  = lief.ELF.parse(path)
+        quick = lief.ELF.parse(path, lief.ELF.ParserConfig.quick)
+
+        builder = lief.ELF.Builder(quick)
+        builder.build()
+        rebuilt = lief.ELF.parse(builder.get_build(), "rebuilt")
+        self.assertEqual(len(rebuilt.relocations), len(full.relocations))
+        self.assertEqual(len(rebuilt.static_symbols), len(full.static_symbols))
+
+class TestSymbolNames(TestCase):
+    def test_shared_names(self):
+        binary  = lief.ELF.parse(get_sample('ELF/ELF64_x86-64_binary_all.bin'))
+        statics = {s.name: s for s in binary.static_symbols if s.name}
+        shared  = [s for s in binary.dynamic_symbols if s.name in statics]
+        self.assertGreater(len(shared), 0)
+
+        # The names read from .dynstr and .strtab are interned: renaming a symbol
+        # must not rename the symbols that share its name
+        dynsym = shared[0]
+        name   = dynsym.name
+        dynsym.name = "lief_renamed"
+        self.assertEqual(dynsym.name, "lief_renamed")
+        self.assertEqual(statics[name].name, name)
+        self.assertEqual(binary.get_static_symbol(name).name, name)
+        self.assertEqual(binary.get_dynamic_symbol("lief_renamed").name, "lief_renamed")
+
+        builder = lief.ELF.Builder(binary)
+        builder.build()
+        rebuilt = lief.ELF.parse(builder.get_build(), "rebuilt")
+        self.assertTrue(rebuilt.has_dynamic_symbol("lief_renamed"))
+        self.assertTrue(rebuilt.has_static_symbol(name))
+
+
 if __name__ == '__main__':
 
     root_logger = logging.getLogger()
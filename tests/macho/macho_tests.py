@@ -233,6 +233,43 @@ class TestMachO(TestCase):
         self.assertEqual(large_bss.segment_from_offset(0xc000).name, "__LINKEDIT")
         self.assertEqual(large_bss.segment_from_offset(0xc001).name, "__LINKEDIT")
 
+    def test_section_from_virtual_address(self):
+        binary = lief.parse(get_sample('MachO/MachO64_x86-64_binary_dd.bin'))
+
+        def check_sections():
+            for section in binary.sections:
+                if section.size == 0:
+                    continue
+                found = binary.section_from_virtual_address(section.virtual_address)
+                self.assertIsNotNone(found)
+                self.assertEqual(found.name, section.name)
+
+        check_sections()
+
+        # The index must follow the layout modifications
+        binary.extend_segment(binary.get_segment("__TEXT"), 0x1000)
+        check_sections()
+
+        section = binary.sections[0]
+        section.virtual_address = 0xdead0000
+        self.assertEqual(binary.section_from_virtual_address(0xdead0000).name, section.name)
+
+    def test_parallel_fat(self):
+        sample = get_sample('MachO/FAT_MachO_x86_x86-64_library_libdyld.dylib')
+
+        config = lief.MachO.ParserConfig.deep
+        sequential = lief.MachO.parse(sample, config=config)
+
+        config.parallel_fat = True
+        parallel = lief.MachO.parse(sample, config=config)
+
+        self.assertEqual(parallel.size, sequential.size)
+        for lhs, rhs in zip(sequential, parallel):
+            self.assertEqual(lhs.header.cpu_type, rhs.header.cpu_type)
+            self.assertEqual(lhs.fat_offset, rhs.fat_offset)
+            self.assertEqual(len(lhs.commands), len(rhs.commands))
+            self.assertEqual(len(lhs.symbols), len(rhs.symbols))
+
 
 
 if __name__ == '__main__':
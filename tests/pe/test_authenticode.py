@@ -1,4 +1,5 @@
 #!/usr/bin/env python
+import hashlib
 import itertools
 import logging
 import os
@@ -42,6 +43,12 @@ class TestAuthenticode(TestCase):
         self.assertEqual(avast.authentihash(lief.PE.ALGORITHMS.SHA_512), from_hex("2a:e7:4c:81:0d:65:7b:6a:49:48:94:ab:b9:7d:fa:03:18:5d:48:cf:cd:4e:c2:99:f6:49:5f:db:30:64:78:03:f6:60:90:ab:04:84:01:36:7e:b0:6e:f6:29:b1:d1:a8:49:51:c3:4e:b3:75:89:c9:74:62:a2:2e:d2:ac:6e:96"))
         self.assertEqual(avast.authentihash(lief.PE.ALGORITHMS.SHA_512), avast.authentihash_sha512)
 
+        algorithms = [lief.PE.ALGORITHMS.MD5, lief.PE.ALGORITHMS.SHA_1, lief.PE.ALGORITHMS.SHA_256,
+                      lief.PE.ALGORITHMS.MD5, lief.PE.ALGORITHMS.SHA_512]
+        self.assertEqual(avast.authentihash(algorithms), [avast.authentihash(algo) for algo in algorithms])
+        self.assertEqual(avast.authentihash([lief.PE.ALGORITHMS.SHA_1, lief.PE.ALGORITHMS.MD4]),
+                         [avast.authentihash_sha1, b""])
+
         self.assertEqual(len(avast.signatures), 1)
         sig = avast.signatures[0]
 
@@ -250,6 +257,60 @@ class TestAuthenticode(TestCase):
         self.assertEqual(cert_ca.verify(cert_signer), lief.PE.x509.VERIFICATION_FLAGS.OK)
         self.assertEqual(cert_ca.is_trusted_by(ca_bundles), lief.PE.x509.VERIFICATION_FLAGS.BADCERT_NOT_TRUSTED)
 
+    def test_verification_cache(self):
+        avast = lief.PE.parse(get_sample("PE/PE32_x86-64_binary_avast-free-antivirus-setup-online.exe"))
+        ca_bundles = lief.PE.x509.parse(get_sample("pkcs7/windows-ca-bundle.pem"))
+        cert_ca, cert_signer = avast.signatures[0].certificates
+
+        self.assertEqual(len(cert_ca.fingerprint), 32)
+        self.assertEqual(cert_ca.fingerprint, hashlib.sha256(cert_ca.raw).digest())
+
+        cache = lief.PE.VerificationCache(max_entries=16)
+        self.assertEqual(cache.max_entries, 16)
+
+        # Signature verification
+        self.assertEqual(avast.verify_signature(cache=cache), lief.PE.Signature.VERIFICATION_FLAGS.OK)
+        first = cache.stats
+        self.assertGreater(first.misses, 0)
+        self.assertEqual(first.entries, first.misses)
+        lookups = first.hits + first.misses
+
+        # The keys of the signers are reused, not the results of the signature checks
+        self.assertEqual(avast.verify_signature(cache=cache), lief.PE.Signature.VERIFICATION_FLAGS.OK)
+        self.assertEqual(avast.signatures[0].check(cache=cache), lief.PE.Signature.VERIFICATION_FLAGS.OK)
+        self.assertEqual(cache.stats.misses, first.misses)
+        self.assertEqual(cache.stats.hits, first.hits + 2 * lookups)
+        self.assertEqual(cache.stats.entries, first.entries)
+
+        # A corrupted signature is checked with the memoized key of the genuine one
+        altered = lief.parse(get_sample("PE/PE32_x86-64_binary_avast-free-antivirus-setup-online-altered-encrypted-digest.exe"))
+        self.assertEqual(altered.verify_signature(cache=cache), altered.verify_signature())
+        self.assertEqual(cache.stats.misses, first.misses)
+
+        # Chain validation
+        for _ in range(2):
+            self.assertEqual(cache.verify(cert_ca, cert_signer), cert_ca.verify(cert_signer))
+            self.assertEqual(cache.verify(cert_ca, cert_ca), cert_ca.verify(cert_ca))
+            self.assertEqual(cache.is_trusted_by(cert_ca, ca_bundles), cert_ca.is_trusted_by(ca_bundles))
+            self.assertEqual(cache.is_trusted_by(cert_signer, [cert_ca]), cert_signer.is_trusted_by([cert_ca]))
+
+        cache.reset_stats()
+        self.assertEqual(cache.is_trusted_by(cert_ca, ca_bundles), lief.PE.x509.VERIFICATION_FLAGS.OK)
+        self.assertEqual(cache.stats.hits, 1)
+        self.assertEqual(cache.stats.misses, 0)
+
+        # Eviction
+        small = lief.PE.VerificationCache(max_entries=1)
+        small.verify(cert_ca, cert_signer)
+        small.verify(cert_ca, cert_ca)
+        small.verify(cert_ca, cert_signer)
+        self.assertEqual(small.stats.misses, 3)
+        self.assertEqual(small.stats.evictions, 2)
+        self.assertEqual(small.stats.entries, 1)
+
+        cache.clear()
+        self.assertEqual(cache.stats.entries, 0)
+
     def test_rsa_info(self):
         avast = lief.PE.parse(get_sample("PE/PE32_x86-64_binary_avast-free-antivirus-setup-online.exe"))
         cert_ca, cert_signer = avast.signatures[0].certificates
@@ -136,6 +136,45 @@ class TestPe(TestCase):
         self.assertEqual(pe.sections[0].name, ".text")
         self.assertEqual(pe.sections[0].fullname.encode("utf8"), b".text\x00\x00\x00")
 
+    def test_section_lookup(self):
+        def from_rva(pe, rva):
+            return next((s for s in pe.sections if s.virtual_address <= rva < s.virtual_address + s.virtual_size), None)
+
+        def from_offset(pe, offset):
+            return next((s for s in pe.sections if s.offset <= offset < s.offset + s.sizeof_raw_data), None)
+
+        def check(pe):
+            end = max(s.virtual_address + max(s.virtual_size, s.sizeof_raw_data) for s in pe.sections)
+            for value in list(range(0, end + 0x1000, 0x80)) + [s.virtual_address for s in pe.sections]:
+                expected = from_rva(pe, value)
+                if expected is None:
+                    with self.assertRaises(lief.not_found):
+                        pe.section_from_rva(value)
+                else:
+                    self.assertEqual(pe.section_from_rva(value).name, expected.name)
+
+                expected = from_offset(pe, value)
+                if expected is None:
+                    self.assertEqual(pe.offset_to_virtual_address(value), value)
+                else:
+                    self.assertEqual(pe.section_from_offset(value).name, expected.name)
+                    self.assertEqual(pe.offset_to_virtual_address(value), value - expected.offset + expected.virtual_address)
+
+        pe = lief.parse(get_sample("PE/PE64_x86-64_binary_cmd.exe"))
+        check(pe)
+
+        # The index must follow the modifications of the layout
+        text = pe.get_section(".text")
+        text.virtual_address += 0x100000
+        check(pe)
+
+        pe.add_section(lief.PE.Section([0xcc] * 0x3000, ".lief"))
+        check(pe)
+        self.assertEqual(pe.section_from_rva(pe.get_section(".lief").virtual_address).name, ".lief")
+
+        pe.remove_section(".lief")
+        check(pe)
+
     def tearDown(self):
         # Delete it
         try: